@@ -418,6 +418,11 @@ if(veccore)
 else()
   set(hasveccore undef)
 endif()
+if(clad)
+  set(hasclad define)
+else()
+  set(hasclad undef)
+endif()
 if(dataframe)
   set(hasdataframe define)
 else()
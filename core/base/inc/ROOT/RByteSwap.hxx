@@ -0,0 +1,31 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RByteSwap
+#define ROOT_RByteSwap
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+
+/// Copy n elements of 2, 4 or 8 bytes from `src` to `dst`, reversing the byte order of every element.
+/// This converts arrays between the host byte order and the big endian byte order of the ROOT file format
+/// on little endian machines. The copy uses SIMD byte shuffles when the CPU supports them (SSSE3 or AVX2 on
+/// x86-64, selected at runtime; NEON on aarch64).
+/// `src` and `dst` can be equal (in-place byte swap) but must not otherwise overlap; they need not be aligned.
+void ByteSwapCopy16(void *dst, const void *src, std::size_t n);
+void ByteSwapCopy32(void *dst, const void *src, std::size_t n);
+void ByteSwapCopy64(void *dst, const void *src, std::size_t n);
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,196 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RByteSwap.hxx"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(__INTEL_COMPILER)
+#define R__BYTESWAP_X86
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define R__BYTESWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+inline std::uint16_t Swap(std::uint16_t x)
+{
+   return std::uint16_t((x >> 8) | (x << 8));
+}
+
+inline std::uint32_t Swap(std::uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_bswap32(x);
+#else
+   return ((x & 0xff000000u) >> 24) | ((x & 0x00ff0000u) >> 8) | ((x & 0x0000ff00u) << 8) | ((x & 0x000000ffu) << 24);
+#endif
+}
+
+inline std::uint64_t Swap(std::uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_bswap64(x);
+#else
+   return (std::uint64_t(Swap(std::uint32_t(x))) << 32) | Swap(std::uint32_t(x >> 32));
+#endif
+}
+
+/// Byte-swap n elements of type T one by one; used for the tail of the SIMD kernels.
+template <typename T>
+void ByteSwapScalar(char *dst, const char *src, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i, dst += sizeof(T), src += sizeof(T)) {
+      T x;
+      std::memcpy(&x, src, sizeof(T));
+      x = Swap(x);
+      std::memcpy(dst, &x, sizeof(T));
+   }
+}
+
+#ifdef R__BYTESWAP_X86
+
+/// The pshufb mask that reverses the bytes of each element of the given size within 16 bytes.
+template <std::size_t N>
+__m128i SwapMask();
+
+template <>
+__m128i SwapMask<2>()
+{
+   return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+}
+
+template <>
+__m128i SwapMask<4>()
+{
+   return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+}
+
+template <>
+__m128i SwapMask<8>()
+{
+   return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+/// Shuffle all the complete 16 bytes blocks of [src, src + nbytes) into dst; returns the number of bytes done.
+__attribute__((target("ssse3"))) std::size_t ByteSwapSSSE3(char *dst, const char *src, std::size_t nbytes, __m128i mask)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(v, mask));
+   }
+   return i;
+}
+
+/// As ByteSwapSSSE3, in blocks of 64 bytes; the shuffle mask applies to both 128 bits lanes.
+__attribute__((target("avx2"))) std::size_t ByteSwapAVX2(char *dst, const char *src, std::size_t nbytes, __m128i mask)
+{
+   const __m256i mask256 = _mm256_broadcastsi128_si256(mask);
+   std::size_t i = 0;
+   for (; i + 64 <= nbytes; i += 64) {
+      __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+      __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(v0, mask256));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 32), _mm256_shuffle_epi8(v1, mask256));
+   }
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(v, mask));
+   }
+   return i;
+}
+
+using SIMDKernel_t = std::size_t (*)(char *, const char *, std::size_t, __m128i);
+
+SIMDKernel_t SelectKernel()
+{
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return ByteSwapAVX2;
+   if (__builtin_cpu_supports("ssse3"))
+      return ByteSwapSSSE3;
+   return nullptr;
+}
+
+/// Chosen once at library load. Before its dynamic initialization it is null, in which case the scalar code is used.
+const SIMDKernel_t gSIMDKernel = SelectKernel();
+
+#elif defined(R__BYTESWAP_NEON)
+
+template <std::size_t N>
+uint8x16_t SwapBlock(uint8x16_t v);
+
+template <>
+uint8x16_t SwapBlock<2>(uint8x16_t v)
+{
+   return vrev16q_u8(v);
+}
+
+template <>
+uint8x16_t SwapBlock<4>(uint8x16_t v)
+{
+   return vrev32q_u8(v);
+}
+
+template <>
+uint8x16_t SwapBlock<8>(uint8x16_t v)
+{
+   return vrev64q_u8(v);
+}
+
+template <std::size_t N>
+std::size_t ByteSwapNEON(char *dst, const char *src, std::size_t nbytes)
+{
+   std::size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t *>(src + i));
+      vst1q_u8(reinterpret_cast<std::uint8_t *>(dst + i), SwapBlock<N>(v));
+   }
+   return i;
+}
+
+#endif
+
+template <typename T>
+void ByteSwapCopyImpl(void *dst, const void *src, std::size_t n)
+{
+   auto d = static_cast<char *>(dst);
+   auto s = static_cast<const char *>(src);
+   const std::size_t nbytes = n * sizeof(T);
+   std::size_t done = 0;
+#if defined(R__BYTESWAP_X86)
+   if (gSIMDKernel)
+      done = gSIMDKernel(d, s, nbytes, SwapMask<sizeof(T)>());
+#elif defined(R__BYTESWAP_NEON)
+   done = ByteSwapNEON<sizeof(T)>(d, s, nbytes);
+#endif
+   ByteSwapScalar<T>(d + done, s + done, (nbytes - done) / sizeof(T));
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::ByteSwapCopy16(void *dst, const void *src, std::size_t n)
+{
+   ByteSwapCopyImpl<std::uint16_t>(dst, src, n);
+}
+
+void ROOT::Internal::ByteSwapCopy32(void *dst, const void *src, std::size_t n)
+{
+   ByteSwapCopyImpl<std::uint32_t>(dst, src, n);
+}
+
+void ROOT::Internal::ByteSwapCopy64(void *dst, const void *src, std::size_t n)
+{
+   ByteSwapCopyImpl<std::uint64_t>(dst, src, n);
+}
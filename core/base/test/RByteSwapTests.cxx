@@ -0,0 +1,48 @@
+#include "ROOT/RByteSwap.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+template <typename T>
+static T Reversed(T x)
+{
+   T result;
+   auto from = reinterpret_cast<const unsigned char *>(&x);
+   auto to = reinterpret_cast<unsigned char *>(&result);
+   for (std::size_t i = 0; i < sizeof(T); ++i)
+      to[i] = from[sizeof(T) - 1 - i];
+   return result;
+}
+
+template <typename T>
+static void CheckByteSwapCopy(void (*byteSwapCopy)(void *, const void *, std::size_t))
+{
+   // Cover the SIMD blocks, their tails and unaligned input
+   for (std::size_t n : {0, 1, 3, 7, 8, 9, 31, 32, 33, 100}) {
+      std::vector<T> values(n);
+      for (std::size_t i = 0; i < n; ++i)
+         values[i] = T(0x0102030405060708ULL * (i + 1));
+
+      std::vector<char> unaligned(n * sizeof(T) + 1);
+      if (n > 0)
+         std::memcpy(unaligned.data() + 1, values.data(), n * sizeof(T));
+      std::vector<T> swapped(n);
+      byteSwapCopy(swapped.data(), unaligned.data() + 1, n);
+      for (std::size_t i = 0; i < n; ++i)
+         EXPECT_EQ(swapped[i], Reversed(values[i])) << "n = " << n << ", i = " << i;
+
+      // In place, and back
+      byteSwapCopy(swapped.data(), swapped.data(), n);
+      EXPECT_EQ(swapped, values) << "n = " << n;
+   }
+}
+
+TEST(RByteSwap, ByteSwapCopy)
+{
+   CheckByteSwapCopy<std::uint16_t>(ROOT::Internal::ByteSwapCopy16);
+   CheckByteSwapCopy<std::uint32_t>(ROOT::Internal::ByteSwapCopy32);
+   CheckByteSwapCopy<std::uint64_t>(ROOT::Internal::ByteSwapCopy64);
+}
@@ -18,6 +18,7 @@
 #include <cstring>
 #include <lz4.h>
 #include <lz4hc.h>
+#include <memory>
 #include <xxhash.h>
 
 // Header consists of:
@@ -30,6 +31,25 @@ static const int kChecksumOffset = 2 + 1 + 3 + 3;
 static const int kChecksumSize = sizeof(XXH64_canonical_t);
 static const int kHeaderSize = kChecksumOffset + kChecksumSize;
 
+namespace {
+
+// The compression functions that allocate their state internally (LZ4_compress_HC allocates and initializes a
+// 256 kB LZ4HC state on the heap for every call) are replaced by the "extState" variants, with a state per thread.
+void *GetThreadState()
+{
+   thread_local std::unique_ptr<LZ4_stream_t, decltype(&LZ4_freeStream)> state{LZ4_createStream(), &LZ4_freeStream};
+   return state.get();
+}
+
+void *GetThreadStateHC()
+{
+   thread_local std::unique_ptr<LZ4_streamHC_t, decltype(&LZ4_freeStreamHC)> state{LZ4_createStreamHC(),
+                                                                                   &LZ4_freeStreamHC};
+   return state.get();
+}
+
+} // anonymous namespace
+
 void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
    int LZ4_version = LZ4_versionNumber();
@@ -52,9 +72,11 @@ void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, in
       cxlevel = 9;
    }
    if (cxlevel >= 4) {
-      returnStatus = LZ4_compress_HC(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, cxlevel);
+      returnStatus =
+         LZ4_compress_HC_extStateHC(GetThreadStateHC(), src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, cxlevel);
    } else {
-      returnStatus = LZ4_compress_default(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize);
+      returnStatus =
+         LZ4_compress_fast_extState(GetThreadState(), src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, 1);
    }
 
    if (R__unlikely(returnStatus == 0)) { /* LZ4 compression failed */
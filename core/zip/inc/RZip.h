@@ -10,6 +10,8 @@
  *************************************************************************/
 #include "Compression.h"
 
+#include <stddef.h>
+
 /**
  * These are definitions of various free functions for the C-style compression routines in ROOT.
  */
@@ -23,6 +25,34 @@ extern "C" unsigned long R__memcompress(char *tgt, unsigned long tgtsize, char *
 
 extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues);
 
+/**
+ * Like R__zipMultipleAlgorithm, compressing with the given dictionary. Only ZSTD supports dictionaries; for the other
+ * algorithms the dictionary is ignored. Buffers compressed with a dictionary can only be uncompressed by R__unzipDict,
+ * given the same dictionary.
+ */
+extern "C" void R__zipMultipleAlgorithmDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                            ROOT::RCompressionSetting::EAlgorithm::EValues, const char *dict,
+                                            int dictsize);
+
+/**
+ * Train a ZSTD dictionary of at most dictcapacity bytes from nsamples samples, stored one after the other in samples.
+ * Returns the size of the dictionary, or 0 if the training failed (e.g. because there is too little sample data).
+ */
+extern "C" int R__trainZSTDDict(char *dict, int dictcapacity, const char *samples, const size_t *samplesizes,
+                                unsigned nsamples);
+
+/**
+ * Digest a ZSTD dictionary for R__unzipDict. The returned handle must be released with R__deleteZSTDDDict.
+ */
+extern "C" void *R__createZSTDDDict(const char *dict, int dictsize);
+
+extern "C" void R__deleteZSTDDDict(void *ddict);
+
+/**
+ * Return the ID of the ZSTD dictionary the compressed block src was compressed with, 0 if none.
+ */
+extern "C" unsigned R__getZSTDDictID(int srcsize, const unsigned char *src);
+
 /**
  * This is a historical definition, prior to ROOT supporting multiple algorithms in a single file.  Use
  * R__zipMultipleAlgorithm instead.
@@ -31,6 +61,14 @@ extern "C" void R__zip(int cxlevel, int *srcsize, char *src, int *tgtsize, char
 
 extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
 
+/**
+ * Like R__unzip, decompressing the blocks compressed with a ZSTD dictionary with ddict, as returned by
+ * R__createZSTDDDict. The block must have been compressed with the same dictionary; ddict can be null if it was
+ * compressed without dictionary.
+ */
+extern "C" void R__unzipDict(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep,
+                             const void *ddict);
+
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
 enum { kMAXZIPBUF = 0xffffff };
@@ -110,6 +110,27 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
   }
 }
 
+/* Like R__zipMultipleAlgorithm, using the dictionary dict if the algorithm supports it (only ZSTD does) */
+void R__zipMultipleAlgorithmDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                 ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm, const char *dict,
+                                 int dictsize)
+{
+  if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
+    compressionAlgorithm = R__ZipMode;
+  }
+
+  if (!dict || dictsize <= 0 || compressionAlgorithm != ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
+    R__zipMultipleAlgorithm(cxlevel, srcsize, src, tgtsize, tgt, irep, compressionAlgorithm);
+    return;
+  }
+
+  if (*srcsize < 1 + HDRSIZE + 1 || cxlevel <= 0) {
+    *irep = 0;
+    return;
+  }
+  R__zipZSTDDict(cxlevel, srcsize, src, tgtsize, tgt, irep, dict, dictsize);
+}
+
   // The very old algorithm for backward compatibility
   // 0 for selecting with R__ZipMode in a backward compatible way
   // 3 for selecting in other cases
@@ -320,6 +341,12 @@ int R__unzip_header(int *srcsize, uch *src, int *tgtsize)
 // N.B. (Brian) - I have kept the original note out of complete awe of the
 // age of the original code...
 void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
+{
+   R__unzipDict(srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+/* Like R__unzip, decompressing blocks compressed with a ZSTD dictionary with ddict (see R__createZSTDDDict) */
+void R__unzipDict(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep, const void *ddict)
 {
    long isize;
    uch *ibufptr, *obufptr;
@@ -367,7 +394,7 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
       R__unzipLZ4(srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_zstd(src)) {
-      R__unzipZSTD(srcsize, src, tgtsize, tgt, irep);
+      R__unzipZSTDDict(srcsize, src, tgtsize, tgt, irep, ddict);
       return;
    }
 
@@ -10,6 +10,8 @@
 #ifndef ROOT_ZipZSTD
 #define ROOT_ZipZSTD
 
+#include <stddef.h>
+
 // NOTE: the ROOT compression libraries aren't consistently written in C++; hence the
 // #ifdef's to avoid problems with C code.
 #ifdef __cplusplus
@@ -17,6 +19,13 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, const char *dict,
+                    int dictsize);
+int R__trainZSTDDict(char *dict, int dictcapacity, const char *samples, const size_t *samplesizes, unsigned nsamples);
+void *R__createZSTDDDict(const char *dict, int dictsize);
+void R__deleteZSTDDDict(void *ddict);
+unsigned R__getZSTDDictID(int srcsize, const unsigned char *src);
+void R__unzipZSTDDict(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep, const void *ddict);
 #ifdef __cplusplus
 }
 #endif
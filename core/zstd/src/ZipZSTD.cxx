@@ -14,7 +14,11 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include <iostream>
 
@@ -22,17 +26,76 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+using CCtx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
+using DCtx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
+using CDict_ptr = std::unique_ptr<ZSTD_CDict, decltype(&ZSTD_freeCDict)>;
+
+// Creating a context allocates and initializes several hundred kB of tables; baskets are often much smaller than
+// that. Every thread therefore keeps its compression and decompression context for all the buffers it processes.
+ZSTD_CCtx *GetThreadCCtx()
+{
+   thread_local CCtx_ptr ctx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+   return ctx.get();
+}
+
+ZSTD_DCtx *GetThreadDCtx()
+{
+   thread_local DCtx_ptr ctx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+   return ctx.get();
+}
+
+/// A digested compression dictionary, and the dictionary it was created from
+struct RCDictEntry {
+   std::string fDict;
+   CDict_ptr fCDict{nullptr, &ZSTD_freeCDict};
+};
+
+/// Digested compression dictionaries of the current thread, by dictionary ID and compression level.
+/// Dictionary IDs are random and can clash: the content of the dictionary is compared too.
+ZSTD_CDict *GetThreadCDict(const char *dict, int dictsize, int level)
+{
+   thread_local std::unordered_map<std::uint64_t, RCDictEntry> cdicts;
+   const auto key = (static_cast<std::uint64_t>(ZSTD_getDictID_fromDict(dict, dictsize)) << 32) |
+                    static_cast<std::uint32_t>(level);
+   auto &entry = cdicts[key];
+   if (!entry.fCDict || entry.fDict.size() != static_cast<size_t>(dictsize) ||
+       std::memcmp(entry.fDict.data(), dict, dictsize) != 0) {
+      entry.fDict.assign(dict, dictsize);
+      entry.fCDict.reset(ZSTD_createCDict(dict, dictsize, level));
+   }
+   return entry.fCDict.get();
+}
+
+void WriteHeader(char *tgt, size_t deflate_size, size_t inflate_size)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+   tgt[0] = 'Z';
+   tgt[1] = 'S';
+   tgt[2] = '\1';
+   tgt[3] = deflate_size & 0xff;
+   tgt[4] = (deflate_size >> 8) & 0xff;
+   tgt[5] = (deflate_size >> 16) & 0xff;
+   tgt[6] = inflate_size & 0xff;
+   tgt[7] = (inflate_size >> 8) & 0xff;
+   tgt[8] = (inflate_size >> 16) & 0xff;
+}
 
+void ZipWithContext(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ZSTD_CDict *cdict)
+{
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    size_t retval;
+    if (cdict) {
+       retval = ZSTD_compress_usingCDict(GetThreadCCtx(),
+                                         &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                         src, static_cast<size_t>(*srcsize), cdict);
+    } else {
+       retval = ZSTD_compressCCtx(GetThreadCCtx(),
+                                  &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                  src, static_cast<size_t>(*srcsize),
+                                  2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -45,23 +108,55 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
         *irep = static_cast<size_t>(retval + kHeaderSize);
     }
 
-    size_t deflate_size = retval;
-    size_t inflate_size = static_cast<size_t>(*srcsize);
-    tgt[0] = 'Z';
-    tgt[1] = 'S';
-    tgt[2] = '\1';
-    tgt[3] = deflate_size & 0xff;
-    tgt[4] = (deflate_size >> 8) & 0xff;
-    tgt[5] = (deflate_size >> 16) & 0xff;
-    tgt[6] = inflate_size & 0xff;
-    tgt[7] = (inflate_size >> 8) & 0xff;
-    tgt[8] = (inflate_size >> 16) & 0xff;
+    WriteHeader(tgt, retval, static_cast<size_t>(*srcsize));
+}
+
+} // anonymous namespace
+
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    ZipWithContext(cxlevel, srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, const char *dict,
+                    int dictsize)
+{
+    ZSTD_CDict *cdict = (dict && dictsize > 0) ? GetThreadCDict(dict, dictsize, 2*cxlevel) : nullptr;
+    ZipWithContext(cxlevel, srcsize, src, tgtsize, tgt, irep, cdict);
+}
+
+int R__trainZSTDDict(char *dict, int dictcapacity, const char *samples, const size_t *samplesizes, unsigned nsamples)
+{
+    size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(dictcapacity), samples, samplesizes, nsamples);
+    if (ZDICT_isError(retval))
+        return 0;
+    return static_cast<int>(retval);
+}
+
+void *R__createZSTDDDict(const char *dict, int dictsize)
+{
+    return ZSTD_createDDict(dict, static_cast<size_t>(dictsize));
+}
+
+void R__deleteZSTDDDict(void *ddict)
+{
+    ZSTD_freeDDict(static_cast<ZSTD_DDict *>(ddict));
+}
+
+unsigned R__getZSTDDictID(int srcsize, const unsigned char *src)
+{
+    if (srcsize <= kHeaderSize || src[0] != 'Z' || src[1] != 'S')
+        return 0;
+    return ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(srcsize - kHeaderSize));
 }
 
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    R__unzipZSTDDict(srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+void R__unzipZSTDDict(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep, const void *dict)
+{
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
@@ -77,9 +172,29 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    const size_t frameSize = static_cast<size_t>(*srcsize - kHeaderSize);
+    const unsigned dictId = ZSTD_getDictID_fromFrame(&src[kHeaderSize], frameSize);
+    size_t retval;
+    if (dictId != 0) {
+        const ZSTD_DDict *ddict = static_cast<const ZSTD_DDict *>(dict);
+        if (R__unlikely(!ddict)) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictId <<
+            ", which was not given." << std::endl;
+            return;
+        }
+        if (R__unlikely(ZSTD_getDictID_fromDDict(ddict) != dictId)) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictId <<
+            ", not with the given dictionary " << ZSTD_getDictID_fromDDict(ddict) << "." << std::endl;
+            return;
+        }
+        retval = ZSTD_decompress_usingDDict(GetThreadDCtx(),
+                                            (char *)tgt, static_cast<size_t>(*tgtsize),
+                                            (char *)&src[kHeaderSize], frameSize, ddict);
+    } else {
+        retval = ZSTD_decompressDCtx(GetThreadDCtx(),
+                                     (char *)tgt, static_cast<size_t>(*tgtsize),
+                                     (char *)&src[kHeaderSize], frameSize);
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
@@ -148,6 +148,9 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function at n points passing their coordinates x and vector of parameters
+         void DoEvalParN(unsigned int n, const T *x, const double *p, T *result) const;
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
@@ -209,6 +212,24 @@ namespace ROOT {
          }
       };
 
+      /**
+       * Auxiliar class to evaluate the TF1 at several points at once with TF1::EvalPar(Int_t, const Double_t *, ...),
+       * which exists only for double. The general implementation returns false and the points are evaluated one by one.
+       */
+      template <class T>
+      struct TF1EvalParN {
+         static bool EvalPar(TF1 *, unsigned int, const T *, const double *, T *) { return false; }
+      };
+
+      template <>
+      struct TF1EvalParN<double> {
+         static bool EvalPar(TF1 *func, unsigned int n, const double *x, const double *p, double *result)
+         {
+            func->EvalPar(n, x, p, result);
+            return true;
+         }
+      };
+
       // implementations for WrappedMultiTF1Templ<T>
       template<class T>
       WrappedMultiTF1Templ<T>::WrappedMultiTF1Templ(TF1 &f, unsigned int dim)  :
@@ -314,6 +335,16 @@ namespace ROOT {
             return GeneralLinearFunctionDerivation<T>::DoParameterDerivative(this, x, ipar);
          }
       }
+      template <class T>
+      void WrappedMultiTF1Templ<T>::DoEvalParN(unsigned int n, const T *x, const double *p, T *result) const
+      {
+         // the TF1 can evaluate the points at once only when its dimension is the one of the points
+         if (fDim == static_cast<unsigned int>(fFunc->GetNdim()) && TF1EvalParN<T>::EvalPar(fFunc, n, x, p, result))
+            return;
+         for (unsigned int i = 0; i < n; ++i)
+            result[i] = fFunc->EvalPar(x + i * fDim, p);
+      }
+
       template<class T>
       void WrappedMultiTF1Templ<T>::SetDerivPrecision(double eps)
       {
@@ -0,0 +1,171 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THistConcurrentFill
+#define ROOT_THistConcurrentFill
+
+#include "TH1.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class THnBase;
+
+namespace ROOT {
+
+class THistConcurrentFiller;
+
+/**
+ \class ROOT::THistConcurrentFillManager
+ \ingroup Hist
+ \brief Fills one histogram from several threads, without a copy of the histogram per thread.
+
+ Each thread fills the histogram through its own THistConcurrentFiller, obtained from MakeFiller().
+ Two modes are available:
+  - kBuffered (the default): a filler keeps the coordinates and weights of up to `bufferSize` entries,
+    then fills them into the histogram at once (with TH1::FillN for TH1, TH2 and TH3 histograms, which
+    computes the bins of a batch of entries at once), holding a lock. The bin contents and the statistics
+    of the histogram are updated together by each flush. THn and THnSparse histograms use this mode.
+  - kAtomic: the fillers add the weights to a single array of bin contents (and sums of squares of weights)
+    shared by all threads, with atomic operations and without lock, which is best when the entries are spread
+    over many bins. The statistics are accumulated by each filler and added by its Flush(). Flush() of the
+    manager then adds the shared bin contents and the statistics to the histogram. This mode requires a TH1,
+    TH2 or TH3 whose axes cannot be extended and that has no buffer (see TH1::SetBuffer), and no profile;
+    otherwise the buffered mode is used.
+
+ In both modes the memory needed does not grow with the size of the histogram times the number of threads:
+ the buffered mode needs `bufferSize` entries per filler, the atomic mode one additional array of bin contents, and
+ a second one once a weight different from 1 has been filled.
+
+ The histogram must not be used directly while it is being filled. All the entries are in the histogram once
+ all the fillers have been flushed or destroyed and, in atomic mode, the manager has been flushed or destroyed.
+
+ ~~~{.cpp}
+ TH2D h("h", "h", 1000, 0, 1, 1000, 0, 1);
+ ROOT::THistConcurrentFillManager manager(h, ROOT::THistConcurrentFillManager::EMode::kAtomic);
+ auto work = [&]() {
+    auto filler = manager.MakeFiller();
+    for (int i = 0; i < 1000000; ++i)
+       filler.Fill(gRandom->Rndm(), gRandom->Rndm());
+ };
+ std::thread t1(work), t2(work);
+ t1.join();
+ t2.join();
+ manager.Flush();
+ ~~~
+*/
+
+class THistConcurrentFillManager {
+public:
+   enum class EMode { kBuffered, kAtomic };
+
+   THistConcurrentFillManager(TH1 &hist, EMode mode = EMode::kBuffered, Int_t bufferSize = 1024);
+   THistConcurrentFillManager(THnBase &hist, Int_t bufferSize = 1024);
+   THistConcurrentFillManager(const THistConcurrentFillManager &) = delete;
+   THistConcurrentFillManager &operator=(const THistConcurrentFillManager &) = delete;
+   ~THistConcurrentFillManager();
+
+   /// Returns a filler for one thread; fillers cannot be shared between threads.
+   THistConcurrentFiller MakeFiller();
+
+   /// In atomic mode, adds the shared bin contents and the statistics flushed by the fillers to the histogram.
+   void Flush();
+
+   EMode GetMode() const { return fMode; }
+   Int_t GetNdimensions() const { return fNdim; }
+
+private:
+   friend class THistConcurrentFiller;
+
+   void FillN(Int_t n, const Double_t *x, const Double_t *w, Int_t stride);
+   void AddStats(const Double_t *stats, Double_t entries);
+   void AllocateSumw2();
+
+   TH1 *fTH1 = nullptr;       ///< The filled histogram, if it is a TH1
+   THnBase *fTHn = nullptr;   ///< The filled histogram, if it is a THnBase
+   Int_t fNdim = 0;           ///< Number of coordinates of an entry
+   EMode fMode;               ///< Filling mode
+   Int_t fBufferSize;         ///< Number of entries buffered by a filler in buffered mode
+   Bool_t fStatOverflows = kFALSE; ///< Whether the under- and overflows are used in the statistics
+   std::mutex fMutex;         ///< Protects the histogram and the statistics below
+   std::unique_ptr<std::atomic<Double_t>[]> fContents; ///< Bin contents filled in atomic mode
+   std::unique_ptr<std::atomic<Double_t>[]> fSumw2;    ///< Sums of w * (w - 1) filled in atomic mode, see AllocateSumw2
+   std::atomic<bool> fWeighted{false};                 ///< Whether fSumw2 was allocated
+   Double_t fStats[TH1::kNstat] = {0};                 ///< Statistics flushed by the fillers in atomic mode
+   Double_t fEntries = 0;                              ///< Number of entries flushed by the fillers in atomic mode
+};
+
+/**
+ \class ROOT::THistConcurrentFiller
+ \ingroup Hist
+ \brief Fills the histogram of a THistConcurrentFillManager from one thread.
+
+ The Fill() arguments are the coordinates of the entry, optionally followed by its weight, like the ones of TH1::Fill
+ for the dimension of the histogram: Fill(x) or Fill(x, w) for a 1D histogram, Fill(x, y) or Fill(x, y, w) for a 2D
+ histogram, and so on. The remaining buffered entries (in buffered mode) or statistics (in atomic mode) are flushed
+ on destruction.
+*/
+
+class THistConcurrentFiller {
+public:
+   THistConcurrentFiller(THistConcurrentFiller &&other);
+   THistConcurrentFiller(const THistConcurrentFiller &) = delete;
+   THistConcurrentFiller &operator=(const THistConcurrentFiller &) = delete;
+   ~THistConcurrentFiller() { Flush(); }
+
+   void Fill(Double_t x0)
+   {
+      const Double_t args[] = {x0};
+      FillArgs(1, args);
+   }
+   void Fill(Double_t x0, Double_t x1)
+   {
+      const Double_t args[] = {x0, x1};
+      FillArgs(2, args);
+   }
+   void Fill(Double_t x0, Double_t x1, Double_t x2)
+   {
+      const Double_t args[] = {x0, x1, x2};
+      FillArgs(3, args);
+   }
+   void Fill(Double_t x0, Double_t x1, Double_t x2, Double_t x3)
+   {
+      const Double_t args[] = {x0, x1, x2, x3};
+      FillArgs(4, args);
+   }
+   /// Fill the entry with the GetNdimensions() coordinates x, as THnBase::Fill.
+   void Fill(const Double_t *x, Double_t w = 1.);
+
+   /// Fill the buffered entries into the histogram (buffered mode), or hand over the statistics to the manager
+   /// (atomic mode).
+   void Flush();
+
+private:
+   friend class THistConcurrentFillManager;
+
+   THistConcurrentFiller(THistConcurrentFillManager &manager);
+
+   void FillArgs(Int_t nargs, const Double_t *args);
+   void FillAtomic(const Double_t *x, Double_t w);
+
+   THistConcurrentFillManager *fManager; ///< The manager of the filled histogram
+   Int_t fNdim;                          ///< Number of coordinates of an entry
+   Int_t fNBuffered = 0;                 ///< Number of buffered entries
+   std::vector<Double_t> fCoords;        ///< Buffered coordinates, fManager->fBufferSize per dimension
+   std::vector<Double_t> fWeights;       ///< Buffered weights
+   Double_t fStats[TH1::kNstat] = {0};   ///< Statistics of the entries filled in atomic mode
+   Double_t fEntries = 0;                ///< Number of entries filled in atomic mode
+};
+
+} // namespace ROOT
+
+#endif
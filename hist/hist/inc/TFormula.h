@@ -104,11 +104,16 @@ private:
    std::string       fGradGenerationInput;         ///<! Input query to clad to generate a gradient
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   std::unique_ptr<TMethodCall> fBatchMethod;      ///<! Pointer to the methodcall evaluating the formula at several points
+   CallFuncSignature fBatchFuncPtr = nullptr;      ///<! Function pointer evaluating the formula at several points, owned by the JIT.
+   std::atomic<Bool_t> fBatchPrepared{false};      ///<! Transient flag set once fBatchFuncPtr has been looked up
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
    void     InputFormulaIntoCling();
    Bool_t   PrepareEvalMethod();
+   void     PrepareBatchEvalMethod();
+   void     ResetBatchEvalMethod();
    void     FillDefaults();
    void     HandlePolN(TString &formula);
    void     HandleParametrizedFunctions(TString &formula);
@@ -194,6 +199,8 @@ public:
    Double_t       Eval(Double_t x, Double_t y , Double_t z) const;
    Double_t       Eval(Double_t x, Double_t y , Double_t z , Double_t t ) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params=0) const;
+   void           EvalPar(Int_t n, const Double_t *x, const Double_t *params, Double_t *result) const;
+   void           EvalPar(Int_t n, const Double_t *x, Int_t stride, const Double_t *params, Double_t *result) const;
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
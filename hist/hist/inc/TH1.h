@@ -54,6 +54,10 @@ class TVirtualFFT;
 class TVirtualHistPainter;
 class TRandom;
 
+namespace ROOT {
+class THistConcurrentFillManager;
+}
+
 
 class TH1 : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
@@ -83,6 +87,7 @@ public:
    };
 
    friend class TH1Merger;
+   friend class ROOT::THistConcurrentFillManager;
 
 protected:
     Int_t         fNcells;          ///<  Number of bins(1D), cells (2D) +U/Overflows
@@ -149,6 +154,11 @@ protected:
                                Option_t * opt, Bool_t doerr = kFALSE) const;
 
    virtual void     DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
+   void             DoFillBins(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
+   virtual void     AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
+   enum {
+      kNFillBatch = 256  ///< Number of entries for which FillN computes the bins at once
+   };
    Bool_t    GetStatOverflowsBehaviour() const { return EStatOverflows::kNeutral == fStatOverflows ? fgStatOverflows : EStatOverflows::kConsider == fStatOverflows; }
 
    static bool CheckAxisLimits(const TAxis* a1, const TAxis* a2);
@@ -601,6 +611,7 @@ public:
    friend  TH1F     operator/(const TH1F &h1, const TH1F &h2);
 
 protected:
+   virtual void     AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
    virtual Double_t RetrieveBinContent(Int_t bin) const { return Double_t (fArray[bin]); }
    virtual void     UpdateBinContent(Int_t bin, Double_t content) { fArray[bin] = Float_t (content); }
 };
@@ -644,6 +655,7 @@ public:
    friend  TH1D     operator/(const TH1D &h1, const TH1D &h2);
 
 protected:
+   virtual void     AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
    virtual Double_t RetrieveBinContent(Int_t bin) const { return fArray[bin]; }
    virtual void     UpdateBinContent(Int_t bin, Double_t content) { fArray[bin] = content; }
 };
@@ -280,6 +280,7 @@ public:
    friend  TH2F     operator/(TH2F &h1, TH2F &h2);
 
 protected:
+   virtual void     AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
    virtual Double_t RetrieveBinContent(Int_t bin) const { return Double_t (fArray[bin]); }
    virtual void     UpdateBinContent(Int_t bin, Double_t content) { fArray[bin] = Float_t (content); }
 
@@ -321,6 +322,7 @@ public:
    friend  TH2D     operator/(TH2D &h1, TH2D &h2);
 
 protected:
+   virtual void     AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
    virtual Double_t RetrieveBinContent(Int_t bin) const { return fArray[bin]; }
    virtual void     UpdateBinContent(Int_t bin, Double_t content) { fArray[bin] = content; }
 
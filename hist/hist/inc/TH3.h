@@ -87,6 +87,8 @@ public:
    virtual Int_t    Fill(const char *namex, Double_t y, Double_t z, Double_t w);
    virtual Int_t    Fill(Double_t x, const char *namey, Double_t z, Double_t w);
    virtual Int_t    Fill(Double_t x, Double_t y, const char *namez, Double_t w);
+   using TH1::FillN;
+   virtual void     FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride=1);
 
    virtual void     FillRandom(const char *fname, Int_t ntimes=5000, TRandom * rng = nullptr);
    virtual void     FillRandom(TH1 *h, Int_t ntimes=5000, TRandom * rng = nullptr);
@@ -294,6 +296,7 @@ public:
    friend  TH3F      operator/(TH3F &h1, TH3F &h2);
 
 protected:
+   virtual void     AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
    virtual Double_t RetrieveBinContent(Int_t bin) const { return Double_t (fArray[bin]); }
    virtual void     UpdateBinContent(Int_t bin, Double_t content) { fArray[bin] = Float_t (content); }
 
@@ -331,6 +334,7 @@ public:
    friend  TH3D      operator/(TH3D &h1, TH3D &h2);
 
 protected:
+   virtual void     AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride);
    virtual Double_t RetrieveBinContent(Int_t bin) const { return fArray[bin]; }
    virtual void     UpdateBinContent(Int_t bin, Double_t content) { fArray[bin] = content; }
 
@@ -31,6 +31,7 @@
 #include "TArrayS.h"
 #include "TArrayC.h"
 
+class THnSparseBinTable;
 class THnSparseCompactBinCoord;
 
 class THnSparse: public THnBase {
@@ -38,8 +39,7 @@ class THnSparse: public THnBase {
    Int_t      fChunkSize;                   ///<  Number of entries for each chunk
    Long64_t   fFilledBins;                  ///<  Number of filled bins
    TObjArray  fBinContent;                  ///<  Array of THnSparseArrayChunk
-   TExMap     fBins;                        ///<! Filled bins
-   TExMap     fBinsContinued;               ///<! Filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   THnSparseBinTable *fBinTable;            ///<! Bin index of the filled bins, by compact coordinate
    THnSparseCompactBinCoord *fCompactCoord; ///<! Compact coordinate
 
    THnSparse(const THnSparse&); // Not implemented
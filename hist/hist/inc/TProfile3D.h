@@ -61,6 +61,7 @@ protected:
    Int_t             Fill(Double_t, const char *, const char *, Double_t) {return TH3::Fill(0); } //MayNotUse
    Int_t             Fill(Double_t, const char *, Double_t, Double_t) {return TH3::Fill(0); } //MayNotUse
    Int_t             Fill(Double_t, Double_t, const char *, Double_t) {return TH3::Fill(0); } //MayNotUse
+   void              FillN(Int_t, const Double_t *, const Double_t *, const Double_t *, const Double_t *, Int_t) { MayNotUse("FillN(Int_t, Double_t*, Double_t*, Double_t*, Double_t*, Int_t)"); }
 
    virtual Double_t RetrieveBinContent(Int_t bin) const { return (fBinEntries.fArray[bin] > 0) ? fArray[bin]/fBinEntries.fArray[bin] : 0; }
    //virtual void     UpdateBinContent(Int_t bin, Double_t content);
@@ -107,6 +108,7 @@ public:
    virtual void      ExtendAxis(Double_t x, TAxis *axis);
    virtual Int_t     Fill(Double_t x, Double_t y, Double_t z, Double_t t);
    virtual Int_t     Fill(Double_t x, Double_t y, Double_t z, Double_t t, Double_t w);
+   using TH3::FillN;
    virtual Double_t  GetBinContent(Int_t bin) const;
    virtual Double_t  GetBinContent(Int_t,Int_t) const
                      { MayNotUse("GetBinContent(Int_t, Int_t"); return -1; }
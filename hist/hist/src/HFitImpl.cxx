@@ -62,6 +62,10 @@ namespace HFit {
 
    void CheckGraphFitOptions(Foption_t &fitOption);
 
+   bool GenerateCladGradient(TF1 *f1);
+
+   bool UseCladGradient(TF1 *f1, const Foption_t &fitOption, const ROOT::Math::MinimizerOptions &minOption);
+
 
    void GetDrawingRange(TH1 * h1, ROOT::Fit::DataRange & range);
    void GetDrawingRange(TGraph * gr, ROOT::Fit::DataRange & range);
@@ -117,6 +121,32 @@ int HFit::CheckFitFunction(const TF1 * f1, int dim) {
 }
 
 
+bool HFit::GenerateCladGradient(TF1 *f1) {
+   // Generate with clad (automatic differentiation) the gradient with respect to the parameters of the
+   // formula of f1, which is then used by TF1::GradientPar. Return true if the gradient is available.
+#ifdef R__HAS_CLAD
+   TFormula *formula = f1->GetFormula();
+   if (!formula || formula->TestBit(TFormula::kLambda) || formula->IsVectorized() || f1->IsEvalNormalized())
+      return false;
+   return formula->GenerateGradientPar();
+#else
+   (void)f1;
+   return false;
+#endif
+}
+
+bool HFit::UseCladGradient(TF1 *f1, const Foption_t &fitOption, const ROOT::Math::MinimizerOptions &minOption) {
+   // Check if a fit, whose objective function supports the gradient, uses by default the gradient of the
+   // formula generated by clad: Minuit2 then gets the gradient of the objective function instead of
+   // computing it numerically.
+   // The gradient is not used in multi-thread fits, since WrappedMultiTF1::ParameterGradient sets the
+   // parameters of the shared TF1.
+   if (fitOption.NoGradient || fitOption.User || fitOption.More) return false;
+   if (fitOption.ExecPolicy != ROOT::EExecutionPolicy::kSequential) return false;
+   if (minOption.MinimizerType() != "Minuit2") return false;
+   return HFit::GenerateCladGradient(f1);
+}
+
 void HFit::GetFunctionRange(const TF1 & f1, ROOT::Fit::DataRange & range) {
    // get the range form the function and fill and return the DataRange object
    Double_t fxmin, fymin, fzmin, fxmax, fymax, fzmax;
@@ -230,9 +260,19 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
    }
 
 
+   // use by default the gradient of the formula generated by clad in chi2 fits
+   // (the gradient of the chi2 does not support coordinate errors, expected errors or bin integrals)
+   bool cladGradient = false;
+   if (fitOption.Gradient)
+      HFit::GenerateCladGradient(f1);
+   else if (!linear && !fitOption.Like && !fitOption.PChi2 && !fitOption.Integral &&
+            (fitdata->GetErrorType() == ROOT::Fit::BinData::kValueError ||
+             fitdata->GetErrorType() == ROOT::Fit::BinData::kNoError))
+      cladGradient = HFit::UseCladGradient(f1, fitOption, minOption);
+
    // set the fit function
    // if option grad is specified use gradient
-   if ( (linear || fitOption.Gradient) )
+   if ( (linear || fitOption.Gradient || cladGradient) )
       fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*f1));
 #ifdef R__HAS_VECCORE
    else if(f1->IsVectorized())
@@ -694,6 +734,11 @@ void ROOT::Fit::FitOptionsMake(EFitObjectType type, const char *option, Foption_
    TString opt = option;
    opt.ToUpper();
 
+   if (opt.Contains("NOGRAD")) {
+      fitOption.NoGradient = 1;  // do not use by default the gradient generated by clad
+      opt.ReplaceAll("NOGRAD","");
+   }
+
    // parse firt the specific options
    if (type == kHistogram) {
 
@@ -839,10 +884,18 @@ TFitResultPtr ROOT::Fit::UnBinFit(ROOT::Fit::UnBinData * data, TF1 * fitfunc, Fo
    // dimension is given by data because TF1 pointer can have wrong one
    unsigned int dim = fitdata->NDim();
 
+   // use by default the gradient of the formula generated by clad in not extended and not weighted fits
+   // (the gradient of the likelihood does not support them)
+   bool cladGradient = false;
+   if (fitOption.Gradient)
+      HFit::GenerateCladGradient(fitfunc);
+   else if ((fitOption.Like & 3) == 0 && (int) dim == fitfunc->GetNdim())
+      cladGradient = HFit::UseCladGradient(fitfunc, fitOption, minOption);
+
    // set the fit function
    // if option grad is specified use gradient
    // need to create a wrapper for an automatic  normalized TF1 ???
-   if ( fitOption.Gradient ) {
+   if ( fitOption.Gradient || cladGradient ) {
       assert ( (int) dim == fitfunc->GetNdim() );
       fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*fitfunc) );
    }
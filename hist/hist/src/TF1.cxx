@@ -16,6 +16,8 @@
 #include "TBuffer.h"
 #include "TMath.h"
 #include "TF1.h"
+#include "TF2.h"
+#include "TF3.h"
 #include "TH1.h"
 #include "TGraph.h"
 #include "TVirtualPad.h"
@@ -1529,6 +1531,36 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate function at n points, with the parameters in array params
+/// (or the internal values of the parameters if params is null), and
+/// store the n values in array result.
+/// The array x contains the GetNdim() coordinates of the first point, followed
+/// by the ones of the second point, and so on.
+///
+/// A TF1, TF2 or TF3 defined by a formula evaluates all the points at once with
+/// TFormula::EvalPar(Int_t, const Double_t *, const Double_t *, Double_t *),
+/// which is much faster than evaluating them one by one. The other functions
+/// are evaluated by calling EvalPar for each point.
+
+void TF1::EvalPar(Int_t n, const Double_t *x, const Double_t *params, Double_t *result)
+{
+   // classes deriving from TF1 with a formula (e.g. TF12) may override EvalPar
+   TClass *cl = IsA();
+   if (fType == EFType::kFormula && (cl == TF1::Class() || cl == TF2::Class() || cl == TF3::Class())) {
+      assert(fFormula);
+      // the formula can have fewer dimensions than the function, e.g. a TF2 of x only
+      fFormula->EvalPar(n, x, fNdim, params, result);
+      if (fNormalized && fNormIntegral != 0) {
+         for (Int_t i = 0; i < n; ++i)
+            result[i] /= fNormIntegral;
+      }
+      return;
+   }
+   for (Int_t i = 0; i < n; ++i)
+      result[i] = EvalPar(x + i * fNdim, params);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -21,6 +21,7 @@
 #include "TInterpreterValue.h"
 #include "TFormula.h"
 #include "TRegexp.h"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <iostream>
@@ -707,6 +708,11 @@ void TFormula::Copy(TObject &obj) const
    fnew.fGradGenerationInput = fGradGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
 
+   TMethodCall *bm = (fBatchMethod) ? new TMethodCall(*fBatchMethod) : nullptr;
+   fnew.fBatchMethod.reset(bm);
+   fnew.fBatchFuncPtr = fBatchFuncPtr;
+   fnew.fBatchPrepared = fBatchPrepared.load();
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -723,6 +729,7 @@ void TFormula::Clear(Option_t * )
 
    fMethod.reset();
    fGradMethod.reset();
+   ResetBatchEvalMethod();
 
    fClingVariables.clear();
    fClingParameters.clear();
@@ -817,6 +824,34 @@ bool TFormula::PrepareEvalMethod()
    return fFuncPtr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Sets the function pointer to the loop evaluating the formula at several points,
+/// declared into Cling together with the formula (see InputFormulaIntoCling).
+/// If it is not available, EvalPar on arrays evaluates the points one by one.
+
+void TFormula::PrepareBatchEvalMethod()
+{
+   if (!fClingInitialized && fLazyInitialization)
+      ReInitializeEvalMethod();
+   if (fClingInitialized && !fBatchMethod) {
+      fBatchMethod = std::unique_ptr<TMethodCall>(new TMethodCall());
+      fBatchMethod->InitWithPrototype(fClingName + "_batch", "Int_t,const Double_t*,Int_t,Double_t*,Double_t*");
+      if (fBatchMethod->IsValid())
+         fBatchFuncPtr = prepareFuncPtr(fBatchMethod.get());
+   }
+   fBatchPrepared = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the loop evaluating the formula at several points, when the formula is recompiled.
+
+void TFormula::ResetBatchEvalMethod()
+{
+   fBatchMethod.reset();
+   fBatchFuncPtr = nullptr;
+   fBatchPrepared = false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///    Inputs formula, transfered to C++ code into Cling
 
@@ -837,7 +872,28 @@ void TFormula::InputFormulaIntoCling()
 
       // Now that all libraries and headers are loaded, Declare() a performant version
       // of the same code:
-      gCling->Declare(fClingInput);
+      TString clingInput = fClingInput;
+      if (!fVectorized) {
+         // Add the loop used by EvalPar on arrays of points: declared together with the formula,
+         // the formula can be inlined in the loop, which can then be vectorized by the compiler.
+         TString args1, args;
+         if (fNdim > 0 || fNpar > 0) {
+            args1 = (fNpar > 0) ? "v + i, p" : "v + i";
+            args = (fNpar > 0) ? "v + i * stride, p" : "v + i * stride";
+         }
+         clingInput += TString::Format(
+            "\nvoid %s_batch(Int_t n, const Double_t *x, Int_t stride, Double_t *p, Double_t *__restrict result) {\n"
+            "   Double_t *v = const_cast<Double_t *>(x);\n"
+            "   if (stride == 1) {\n"
+            "      for (Int_t i = 0; i < n; ++i) result[i] = %s(%s);\n"
+            "   } else {\n"
+            "      for (Int_t i = 0; i < n; ++i) result[i] = %s(%s);\n"
+            "   }\n"
+            "}\n",
+            fClingName.Data(), fClingName.Data(), args1.Data(), fClingName.Data(),
+            args.Data());
+      }
+      gCling->Declare(clingInput);
       fClingInitialized = PrepareEvalMethod();
       if (!fClingInitialized) Error("InputFormulaIntoCling","Error compiling formula expression in Cling");
    }
@@ -2294,6 +2350,7 @@ void TFormula::ProcessFormula(TString &formula)
          // set the cling name using hash of the static formulae map
          auto hasher = gClingFunctions.hash_function();
          fClingName = TString::Format("%s__id%zu", gNamePrefix.Data(), hasher(inputFormulaVecFlag));
+         ResetBatchEvalMethod();
 
          fClingInput = TString::Format("%s %s(%s){ return %s ; }", argType.Data(), fClingName.Data(),
                                        argumentsPrototype.Data(), inputFormula.c_str());
@@ -3073,6 +3130,7 @@ void TFormula::SetVectorized(Bool_t vectorized)
       fClingInput = fFormula;
 
       fMethod.reset();
+      ResetBatchEvalMethod();
       // should I add fGradMethod.reset() ?
 
       FillVecFunctionsShurtCuts();   // to replace with the right vectorized signature (e.g. sin  -> vecCore::math::Sin)
@@ -3129,6 +3187,61 @@ Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at n points with the same parameters, and store the n values in result.
+/// The array x contains the variables of the first point, followed by the ones of the second point,
+/// and so on (GetNdim() values per point). If x is null the stored variables are used for all points,
+/// if params is null the stored parameters are used.
+///
+/// The points are evaluated by a single call to a loop compiled together with the formula, in which
+/// the formula expression is inlined and which can be vectorized by the compiler: this is much faster
+/// than calling EvalPar for each point, in particular for simple expressions.
+/// Lambda expressions and vectorized formulas are evaluated point by point.
+
+void TFormula::EvalPar(Int_t n, const Double_t *x, const Double_t *params, Double_t *result) const
+{
+   EvalPar(n, x, fNdim, params, result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at n points with the same parameters, and store the n values in result.
+/// The variables of point i start at x[i * stride], which allows to evaluate the formula on
+/// points with more coordinates than the formula uses (stride > GetNdim()), e.g. for a TF2
+/// defined by a formula of x only.
+
+void TFormula::EvalPar(Int_t n, const Double_t *x, Int_t stride, const Double_t *params, Double_t *result) const
+{
+   if (n <= 0)
+      return;
+
+   CallFuncSignature batchFuncPtr = nullptr;
+   if (fReadyToExecute && !fVectorized && !TestBit(TFormula::kLambda)) {
+      if (!fBatchPrepared) {
+         R__LOCKGUARD(gROOTMutex);
+         // check again in case another thread has looked up the function
+         if (!fBatchPrepared) {
+            auto thisFormula = const_cast<TFormula*>(this);
+            thisFormula->PrepareBatchEvalMethod();
+         }
+      }
+      batchFuncPtr = fBatchFuncPtr;
+   }
+
+   if (!batchFuncPtr) {
+      for (Int_t i = 0; i < n; ++i)
+         result[i] = EvalPar(x ? x + i * stride : fClingVariables.data(), params);
+      return;
+   }
+
+   Int_t npoints = n;
+   if (!x)
+      stride = 0;
+   double *vars = (x) ? const_cast<double *>(x) : const_cast<double *>(fClingVariables.data());
+   double *pars = (params) ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+   void *args[5] = {&npoints, &vars, &stride, &pars, &result};
+   (*batchFuncPtr)(0, 5, args, nullptr);
+}
+
 bool TFormula::fIsCladRuntimeIncluded = false;
 
 static bool functionExists(const string &Name) {
@@ -3231,6 +3344,8 @@ void TFormula::GradientPar(const Double_t *x, Double_t *result)
       // }
       const double *pars = fClingParameters.data();
       args[1] = &pars;
+      // the gradient generated by clad adds the derivatives to the result
+      std::fill(result, result + fNpar, 0.);
       args[2] = &result;
       (*fGradFuncPtr)(0, 3, args, /*ret*/nullptr); // We do not use ret in a return-void func.
    }
@@ -3432,6 +3547,7 @@ void TFormula::ReInitializeEvalMethod() {
       return;
    }
    fMethod.reset();
+   ResetBatchEvalMethod();
 
    if (!fLazyInitialization)   Warning("ReInitializeEvalMethod", "Formula is NOT properly initialized - try calling again TFormula::PrepareEvalMethod");
    //else  Info("ReInitializeEvalMethod", "Compile now the formula expression using Cling");
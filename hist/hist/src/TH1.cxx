@@ -17,6 +17,7 @@
 #include <sstream>
 #include <cmath>
 #include <iostream>
+#include <algorithm>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -3477,6 +3478,11 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method to fill histogram content from a vector
 /// called directly by TH1::BufferEmpty
+///
+/// Unless the axis can be extended, the entries are filled in batches of
+/// kNFillBatch: the bins of a batch are computed at once by TAxis::FindFixBins,
+/// then the bin contents and the sums of squares of weights are incremented
+/// by DoFillBins.
 
 void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
@@ -3485,22 +3491,99 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin, ww);
-      if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+
+   if (fXaxis.CanExtend()) {
+      // the axis limits can change while filling: find the bins one by one
+      ntimes *= stride;
+      for (i=0;i<ntimes;i+=stride) {
+         bin =fXaxis.FindBin(x[i]);
+         if (bin <0) continue;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (bin == 0 || bin > nbins) {
+            if (!statOverflows) continue;
+         }
+         Double_t z= ww;
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+      }
+      return;
+   }
+
+   Int_t bins[kNFillBatch];
+   for (Int_t first = 0; first < ntimes; first += kNFillBatch) {
+      const Int_t n = std::min<Int_t>(kNFillBatch, ntimes - first);
+      const Double_t *xb = x + first * stride;
+      const Double_t *wb = w ? w + first * stride : nullptr;
+      fXaxis.FindFixBins(n, xb, bins, stride);
+      DoFillBins(n, bins, wb, stride);
+      for (i = 0; i < n; ++i) {
+         bin = bins[i];
+         if (!statOverflows && (bin == 0 || bin > nbins)) continue;
+         const Double_t xi = xb[i * stride];
+         Double_t z = wb ? wb[i * stride] : 1.;
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*xi;
+         fTsumwx2 += z*xi*xi;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of the n (global) bins `bins` by the weights
+/// w[0], w[stride], ..., w[(n-1)*stride], or by 1 if w is null, as well as
+/// the sums of squares of weights. The storage of the sums of squares of
+/// weights is triggered as in Fill, at the first weight that is not 1.
+/// Used by FillN; the statistics are not updated.
+
+void TH1::DoFillBins(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   Int_t first = 0;
+   if (w && !fSumw2.fN && !TestBit(TH1::kIsNotW)) {
+      while (first < n && w[first * stride] == 1.0) ++first;
+      if (first < n) {
+         // fill the entries of weight 1 before creating the sums of squares of weights
+         AddBinContentN(first, bins, w, stride);
+         Sumw2();
+      } else {
+         first = 0;
+      }
+   }
+   if (fSumw2.fN) {
+      Double_t *sumw2 = fSumw2.fArray;
+      if (w) {
+         for (Int_t i = first; i < n; ++i) {
+            const Double_t ww = w[i * stride];
+            sumw2[bins[i]] += ww * ww;
+         }
+      } else {
+         for (Int_t i = first; i < n; ++i)
+            sumw2[bins[i]] += 1.;
       }
-      Double_t z= ww;
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
+   }
+   AddBinContentN(n - first, bins + first, w ? w + first * stride : nullptr, stride);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of the n bins `bins` by the weights w[0], w[stride], ...,
+/// w[(n-1)*stride], or by 1 if w is null.
+/// The classes holding the bin contents in an array override this function to
+/// update the array directly instead of calling AddBinContent for each bin.
+
+void TH1::AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   if (w) {
+      for (Int_t i = 0; i < n; ++i)
+         AddBinContent(bins[i], w[i * stride]);
+   } else {
+      for (Int_t i = 0; i < n; ++i)
+         AddBinContent(bins[i]);
    }
 }
 
@@ -3952,12 +4035,23 @@ TFitResultPtr TH1::Fit(const char *fname ,Option_t *option ,Option_t *goption, D
 ///        - "C"  In case of linear fitting, don't calculate the chisquare
 ///          (saves time)
 ///        - "F"  If fitting a polN, switch to minuit fitter
+///        - "G"  Use the gradient of the fit function with respect to the parameters to compute the
+///          gradient of the chi2 or likelihood. For a function defined by a formula, the gradient
+///          of the formula is generated by clad (automatic differentiation) if available.
+///          This is done by default for chi2 fits with Minuit2 (see below)
+///        - "NOGRAD" Do not use by default the gradient of the formula generated by clad
 ///        - "S"  The result of the fit is returned in the TFitResultPtr
 ///          (see below Access to the Fit Result)
 /// \param[in] goption specify a list of graphics options. See TH1::Draw for a complete list of these options.
 /// \param[in] xxmin range
 /// \param[in] xxmax range
 ///
+/// When ROOT is built with clad, the chi2 fits with Minuit2 (without the options "L", "I", "P", "U" and "M", and
+/// not multi-threaded) of a function defined by a formula, not normalized, generate the gradient of the formula
+/// with respect to the parameters with automatic differentiation. Minuit2 then gets the gradient of the chi2,
+/// instead of computing it numerically with two evaluations of the chi2 per parameter, which reduces considerably
+/// the number of function calls in fits with many parameters. Use the option "NOGRAD" to switch this off.
+///
 /// In order to use the Range option, one must first create a function
 /// with the expression to be fitted. For example, if your histogram
 /// has a defined range between -4 and 4 and you want to fit a gaussian
@@ -9933,6 +10027,20 @@ TH1F::~TH1F()
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of n bins, see TH1::AddBinContentN.
+
+void TH1F::AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   if (w) {
+      for (Int_t i = 0; i < n; ++i)
+         fArray[bins[i]] += Float_t (w[i * stride]);
+   } else {
+      for (Int_t i = 0; i < n; ++i)
+         ++fArray[bins[i]];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy this to newth1.
 
@@ -10112,6 +10220,20 @@ TH1D::TH1D(const TH1D &h1d) : TH1(), TArrayD()
    ((TH1D&)h1d).Copy(*this);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of n bins, see TH1::AddBinContentN.
+
+void TH1D::AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   if (w) {
+      for (Int_t i = 0; i < n; ++i)
+         fArray[bins[i]] += Double_t (w[i * stride]);
+   } else {
+      for (Int_t i = 0; i < n; ++i)
+         ++fArray[bins[i]];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy this to newth1
 
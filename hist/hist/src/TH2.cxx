@@ -28,6 +28,8 @@
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
 
+#include <algorithm>
+
 ClassImp(TH2);
 
 /** \addtogroup Hist
@@ -627,6 +629,44 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
          return;
    }
 
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+
+   if (!fXaxis.CanExtend() && !fYaxis.CanExtend()) {
+      // the axis limits cannot change: compute the bins of a batch of entries at once, see TH1::DoFillN
+      const Int_t nentries = (ntimes - ifirst) / stride;
+      fEntries += nentries;
+      Int_t binsx[kNFillBatch], binsy[kNFillBatch], bins[kNFillBatch];
+      for (Int_t first = 0; first < nentries; first += kNFillBatch) {
+         const Int_t n = std::min<Int_t>(kNFillBatch, nentries - first);
+         const Int_t offset = ifirst + first * stride;
+         const Double_t *xb = x + offset;
+         const Double_t *yb = y + offset;
+         const Double_t *wb = w ? w + offset : nullptr;
+         fXaxis.FindFixBins(n, xb, binsx, stride);
+         fYaxis.FindFixBins(n, yb, binsy, stride);
+         for (i = 0; i < n; ++i)
+            bins[i] = binsy[i] * (nbinsx + 2) + binsx[i];
+         DoFillBins(n, bins, wb, stride);
+         for (i = 0; i < n; ++i) {
+            if (!statOverflows && (binsx[i] == 0 || binsx[i] > nbinsx || binsy[i] == 0 || binsy[i] > nbinsy))
+               continue;
+            const Double_t xi = xb[i * stride];
+            const Double_t yi = yb[i * stride];
+            Double_t z = wb ? wb[i * stride] : 1.;
+            fTsumw   += z;
+            fTsumw2  += z*z;
+            fTsumwx  += z*xi;
+            fTsumwx2 += z*xi*xi;
+            fTsumwy  += z*yi;
+            fTsumwy2 += z*yi*yi;
+            fTsumwxy += z*xi*yi;
+         }
+      }
+      return;
+   }
+
    Double_t ww = 1;
    for (i=ifirst;i<ntimes;i+=stride) {
       fEntries++;
@@ -639,10 +679,10 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
       if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
       AddBinContent(bin,ww);
       if (binx == 0 || binx > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         if (!statOverflows) continue;
       }
       if (biny == 0 || biny > fYaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         if (!statOverflows) continue;
       }
       Double_t z= ww; //(ww > 0 ? ww : -ww);
       fTsumw   += z;
@@ -3655,6 +3695,20 @@ TH2F::TH2F(const TH2F &h2f) : TH2(), TArrayF()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of n bins, see TH1::AddBinContentN.
+
+void TH2F::AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   if (w) {
+      for (Int_t i = 0; i < n; ++i)
+         fArray[bins[i]] += Float_t (w[i * stride]);
+   } else {
+      for (Int_t i = 0; i < n; ++i)
+         ++fArray[bins[i]];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy.
 
@@ -3927,6 +3981,20 @@ TH2D::TH2D(const TH2D &h2d) : TH2(), TArrayD()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of n bins, see TH1::AddBinContentN.
+
+void TH2D::AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   if (w) {
+      for (Int_t i = 0; i < n; ++i)
+         fArray[bins[i]] += Double_t (w[i * stride]);
+   } else {
+      for (Int_t i = 0; i < n; ++i)
+         ++fArray[bins[i]];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy.
 
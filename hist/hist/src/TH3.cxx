@@ -25,6 +25,8 @@
 #include "TMath.h"
 #include "TObjString.h"
 
+#include <algorithm>
+
 ClassImp(TH3);
 
 /** \addtogroup Hist
@@ -767,6 +769,76 @@ Int_t TH3::Fill(Double_t x, Double_t y, const char *namez, Double_t w)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a 3-D histogram with an array of values and weights.
+///
+///  - ntimes:  number of entries in arrays x, y, z and w (array size must be ntimes*stride)
+///  - x:       array of x values to be histogrammed
+///  - y:       array of y values to be histogrammed
+///  - z:       array of z values to be histogrammed
+///  - w:       array of weights
+///  - stride:  step size through arrays x, y, z and w
+///
+/// This is equivalent to calling Fill(x[i], y[i], z[i], w[i]) for each entry.
+/// If w is NULL each entry is assumed a weight=1. Unless the histogram has a
+/// buffer or an axis that can be extended, the bins of a batch of entries are
+/// computed at once, see TH1::DoFillN.
+
+void TH3::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride)
+{
+   Int_t i;
+   if (fBuffer || fXaxis.CanExtend() || fYaxis.CanExtend() || fZaxis.CanExtend()) {
+      for (i = 0; i < ntimes; ++i) {
+         const Int_t j = i * stride;
+         Fill(x[j], y[j], z[j], w ? w[j] : 1.);
+      }
+      return;
+   }
+
+   const Int_t nbinsx = fXaxis.GetNbins();
+   const Int_t nbinsy = fYaxis.GetNbins();
+   const Int_t nbinsz = fZaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+
+   fEntries += ntimes;
+   Int_t binsx[kNFillBatch], binsy[kNFillBatch], binsz[kNFillBatch], bins[kNFillBatch];
+   for (Int_t first = 0; first < ntimes; first += kNFillBatch) {
+      const Int_t n = std::min<Int_t>(kNFillBatch, ntimes - first);
+      const Int_t offset = first * stride;
+      const Double_t *xb = x + offset;
+      const Double_t *yb = y + offset;
+      const Double_t *zb = z + offset;
+      const Double_t *wb = w ? w + offset : nullptr;
+      fXaxis.FindFixBins(n, xb, binsx, stride);
+      fYaxis.FindFixBins(n, yb, binsy, stride);
+      fZaxis.FindFixBins(n, zb, binsz, stride);
+      for (i = 0; i < n; ++i)
+         bins[i] = binsx[i] + (nbinsx + 2) * (binsy[i] + (nbinsy + 2) * binsz[i]);
+      DoFillBins(n, bins, wb, stride);
+      for (i = 0; i < n; ++i) {
+         if (!statOverflows && (binsx[i] == 0 || binsx[i] > nbinsx || binsy[i] == 0 || binsy[i] > nbinsy ||
+                                binsz[i] == 0 || binsz[i] > nbinsz))
+            continue;
+         const Double_t xi = xb[i * stride];
+         const Double_t yi = yb[i * stride];
+         const Double_t zi = zb[i * stride];
+         const Double_t v = wb ? wb[i * stride] : 1.;
+         fTsumw   += v;
+         fTsumw2  += v*v;
+         fTsumwx  += v*xi;
+         fTsumwx2 += v*xi*xi;
+         fTsumwy  += v*yi;
+         fTsumwy2 += v*yi*yi;
+         fTsumwxy += v*xi*yi;
+         fTsumwz  += v*zi;
+         fTsumwz2 += v*zi*zi;
+         fTsumwxz += v*xi*zi;
+         fTsumwyz += v*yi*zi;
+      }
+   }
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill histogram following distribution in function fname.
 ///
@@ -4203,6 +4275,20 @@ TH3F::TH3F(const TH3F &h3f) : TH3(), TArrayF()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of n bins, see TH1::AddBinContentN.
+
+void TH3F::AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   if (w) {
+      for (Int_t i = 0; i < n; ++i)
+         fArray[bins[i]] += Float_t (w[i * stride]);
+   } else {
+      for (Int_t i = 0; i < n; ++i)
+         ++fArray[bins[i]];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy this 3-D histogram structure to newth3.
 
@@ -4418,6 +4504,20 @@ TH3D::TH3D(const TH3D &h3d) : TH3(), TArrayD()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of n bins, see TH1::AddBinContentN.
+
+void TH3D::AddBinContentN(Int_t n, const Int_t *bins, const Double_t *w, Int_t stride)
+{
+   if (w) {
+      for (Int_t i = 0; i < n; ++i)
+         fArray[bins[i]] += Double_t (w[i * stride]);
+   } else {
+      for (Int_t i = 0; i < n; ++i)
+         ++fArray[bins[i]];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy this 3-D histogram structure to newth3.
 
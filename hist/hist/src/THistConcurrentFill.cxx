@@ -0,0 +1,307 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/THistConcurrentFill.hxx"
+
+#include "TError.h"
+#include "TH2Poly.h"
+#include "TH3.h"
+#include "THnBase.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfile2Poly.h"
+#include "TProfile3D.h"
+
+#include <algorithm>
+
+namespace {
+
+/// Atomically add x to a; std::atomic<double>::fetch_add only exists since C++20.
+inline void AtomicAdd(std::atomic<Double_t> &a, Double_t x)
+{
+   Double_t old = a.load(std::memory_order_relaxed);
+   while (!a.compare_exchange_weak(old, old + x, std::memory_order_relaxed)) {
+   }
+}
+
+std::unique_ptr<std::atomic<Double_t>[]> MakeZeroedArray(Int_t n)
+{
+   std::unique_ptr<std::atomic<Double_t>[]> array(new std::atomic<Double_t>[n]);
+   for (Int_t i = 0; i < n; ++i)
+      array[i].store(0., std::memory_order_relaxed);
+   return array;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the concurrent filling of a TH1, TH2 or TH3 histogram (including TProfile and TH2Poly).
+/// The atomic mode is not available for profiles, TH2Poly, histograms with a buffer and histograms with
+/// axes that can be extended: the buffered mode is used instead. TProfile2D and TProfile3D are not supported.
+
+ROOT::THistConcurrentFillManager::THistConcurrentFillManager(TH1 &hist, EMode mode, Int_t bufferSize)
+   : fTH1(&hist), fNdim(hist.GetDimension()), fMode(mode), fBufferSize(std::max(bufferSize, 1))
+{
+   if (hist.InheritsFrom(TProfile2D::Class()) || hist.InheritsFrom(TProfile3D::Class()) ||
+       hist.InheritsFrom(TProfile2Poly::Class())) {
+      Error("THistConcurrentFillManager", "concurrent filling of a %s is not supported", hist.ClassName());
+      fTH1 = nullptr;
+      fNdim = 0;
+      fMode = EMode::kBuffered;
+      return;
+   }
+   // the entries of a TProfile have a value in addition to their x coordinate
+   const Bool_t isProfile = hist.InheritsFrom(TProfile::Class());
+   if (isProfile)
+      fNdim = 2;
+
+   if (fMode != EMode::kAtomic)
+      return;
+   const char *reason = nullptr;
+   if (isProfile || hist.InheritsFrom(TH2Poly::Class()))
+      reason = "profiles and TH2Poly";
+   else if (hist.GetBuffer())
+      reason = "histograms with a buffer";
+   else if (hist.GetXaxis()->CanExtend() || (fNdim > 1 && hist.GetYaxis()->CanExtend()) ||
+            (fNdim > 2 && hist.GetZaxis()->CanExtend()))
+      reason = "histograms with axes that can be extended";
+   if (reason) {
+      Warning("THistConcurrentFillManager", "the atomic mode is not available for %s, using the buffered mode",
+              reason);
+      fMode = EMode::kBuffered;
+      return;
+   }
+   fStatOverflows = hist.GetStatOverflowsBehaviour();
+   fContents = MakeZeroedArray(hist.GetNcells());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the concurrent filling of a THn or THnSparse, in buffered mode.
+
+ROOT::THistConcurrentFillManager::THistConcurrentFillManager(THnBase &hist, Int_t bufferSize)
+   : fTHn(&hist), fNdim(hist.GetNdimensions()), fMode(EMode::kBuffered), fBufferSize(std::max(bufferSize, 1))
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Flush the entries filled in atomic mode. All the fillers must have been destroyed.
+
+ROOT::THistConcurrentFillManager::~THistConcurrentFillManager()
+{
+   Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The filler must only be used by one thread, and must be destroyed before the manager.
+
+ROOT::THistConcurrentFiller ROOT::THistConcurrentFillManager::MakeFiller()
+{
+   return THistConcurrentFiller(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// In atomic mode, add the bin contents filled so far, and the statistics and number of entries flushed by the
+/// fillers, to the histogram. The statistics of the histogram are consistent with its bin contents if all the
+/// fillers have been flushed (or destroyed) before. Nothing to do in buffered mode, where the fillers fill the
+/// histogram when they are flushed.
+
+void ROOT::THistConcurrentFillManager::Flush()
+{
+   if (fMode != EMode::kAtomic)
+      return;
+
+   std::lock_guard<std::mutex> lock(fMutex);
+   TH1 &hist = *fTH1;
+   // The statistics are taken before adding the bin contents, as TH1::GetStats might compute them from the bins
+   Double_t stats[TH1::kNstat] = {0};
+   hist.GetStats(stats);
+
+   // as in TH1::Fill, the sum of weights squared is created by the first weight different from 1
+   const bool weighted = fWeighted.load(std::memory_order_relaxed);
+   if (weighted && hist.GetSumw2N() == 0 && !hist.TestBit(TH1::kIsNotW))
+      hist.Sumw2();
+   Double_t *sumw2 = hist.GetSumw2N() ? hist.GetSumw2()->GetArray() : nullptr;
+   for (Int_t bin = 0; bin < hist.GetNcells(); ++bin) {
+      const Double_t content = fContents[bin].exchange(0., std::memory_order_relaxed);
+      const Double_t excess = weighted ? fSumw2[bin].exchange(0., std::memory_order_relaxed) : 0.;
+      if (content == 0. && excess == 0.)
+         continue;
+      hist.AddBinContent(bin, content);
+      if (sumw2)
+         sumw2[bin] += content + excess;
+   }
+
+   for (Int_t i = 0; i < TH1::kNstat; ++i) {
+      stats[i] += fStats[i];
+      fStats[i] = 0;
+   }
+   hist.PutStats(stats);
+   hist.SetEntries(hist.GetEntries() + fEntries);
+   fEntries = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill n buffered entries: the coordinates of the d-th dimension are at x + d * stride.
+
+void ROOT::THistConcurrentFillManager::FillN(Int_t n, const Double_t *x, const Double_t *w, Int_t stride)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (fTHn) {
+      std::vector<Double_t> point(fNdim);
+      for (Int_t i = 0; i < n; ++i) {
+         for (Int_t d = 0; d < fNdim; ++d)
+            point[d] = x[d * stride + i];
+         fTHn->Fill(point.data(), w[i]);
+      }
+      return;
+   }
+   if (!fTH1)
+      return;
+   switch (fNdim) {
+   case 1: fTH1->FillN(n, x, w); break;
+   case 2: fTH1->FillN(n, x, x + stride, w, 1); break;
+   case 3: static_cast<TH3 *>(fTH1)->FillN(n, x, x + stride, x + 2 * stride, w); break;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the statistics and number of entries of a filler in atomic mode.
+
+void ROOT::THistConcurrentFillManager::AddStats(const Double_t *stats, Double_t entries)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (Int_t i = 0; i < TH1::kNstat; ++i)
+      fStats[i] += stats[i];
+   fEntries += entries;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate the sums of weights squared of the atomic mode, on the first weight different from 1. To save memory
+/// and atomic operations, they only hold the sums of w * (w - 1): the sum of w * w of a bin is its content plus this
+/// excess, which is 0 for the entries of weight 1. The entries filled before the allocation, or whose excess is
+/// added after a Flush() took their content, thus need no special treatment.
+
+void ROOT::THistConcurrentFillManager::AllocateSumw2()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (!fSumw2)
+      fSumw2 = MakeZeroedArray(fTH1->GetNcells());
+   fWeighted.store(true, std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::THistConcurrentFiller::THistConcurrentFiller(THistConcurrentFillManager &manager)
+   : fManager(&manager), fNdim(manager.fNdim)
+{
+   if (manager.fMode == THistConcurrentFillManager::EMode::kBuffered) {
+      fCoords.resize(fNdim * manager.fBufferSize);
+      fWeights.resize(manager.fBufferSize);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The entries buffered or the statistics accumulated by `other` are moved to the new filler.
+
+ROOT::THistConcurrentFiller::THistConcurrentFiller(THistConcurrentFiller &&other)
+   : fManager(other.fManager), fNdim(other.fNdim), fNBuffered(other.fNBuffered), fCoords(std::move(other.fCoords)),
+     fWeights(std::move(other.fWeights)), fEntries(other.fEntries)
+{
+   std::copy(other.fStats, other.fStats + TH1::kNstat, fStats);
+   std::fill(other.fStats, other.fStats + TH1::kNstat, 0.);
+   other.fNBuffered = 0;
+   other.fEntries = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ROOT::THistConcurrentFiller::FillArgs(Int_t nargs, const Double_t *args)
+{
+   if (nargs == fNdim)
+      Fill(args, 1.);
+   else if (nargs == fNdim + 1)
+      Fill(args, args[fNdim]);
+   else
+      Error("THistConcurrentFiller::Fill", "%d arguments given to fill a histogram with entries of %d coordinates",
+            nargs, fNdim);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ROOT::THistConcurrentFiller::Fill(const Double_t *x, Double_t w)
+{
+   if (fManager->fMode == THistConcurrentFillManager::EMode::kAtomic) {
+      FillAtomic(x, w);
+      return;
+   }
+   const Int_t bufferSize = fManager->fBufferSize;
+   for (Int_t d = 0; d < fNdim; ++d)
+      fCoords[d * bufferSize + fNBuffered] = x[d];
+   fWeights[fNBuffered] = w;
+   if (++fNBuffered == bufferSize)
+      Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the weight to the shared bin contents, and the entry to the statistics of the filler, as TH1::Fill does.
+
+void ROOT::THistConcurrentFiller::FillAtomic(const Double_t *x, Double_t w)
+{
+   TH1 &hist = *fManager->fTH1;
+   const TAxis *axes[3] = {hist.GetXaxis(), hist.GetYaxis(), hist.GetZaxis()};
+   Int_t bins[3] = {0, 0, 0};
+   Bool_t inRange = kTRUE;
+   for (Int_t d = 0; d < fNdim; ++d) {
+      bins[d] = axes[d]->FindFixBin(x[d]);
+      if (bins[d] == 0 || bins[d] > axes[d]->GetNbins())
+         inRange = kFALSE;
+   }
+   const Int_t bin = hist.GetBin(bins[0], bins[1], bins[2]);
+   if (w != 1.) {
+      if (!fManager->fWeighted.load(std::memory_order_acquire))
+         fManager->AllocateSumw2();
+      AtomicAdd(fManager->fSumw2[bin], w * (w - 1.));
+   }
+   AtomicAdd(fManager->fContents[bin], w);
+
+   ++fEntries;
+   if (!inRange && !fManager->fStatOverflows)
+      return;
+   fStats[0] += w;
+   fStats[1] += w * w;
+   fStats[2] += w * x[0];
+   fStats[3] += w * x[0] * x[0];
+   if (fNdim > 1) {
+      fStats[4] += w * x[1];
+      fStats[5] += w * x[1] * x[1];
+      fStats[6] += w * x[0] * x[1];
+   }
+   if (fNdim > 2) {
+      fStats[7] += w * x[2];
+      fStats[8] += w * x[2] * x[2];
+      fStats[9] += w * x[0] * x[2];
+      fStats[10] += w * x[1] * x[2];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ROOT::THistConcurrentFiller::Flush()
+{
+   if (fNBuffered) {
+      fManager->FillN(fNBuffered, fCoords.data(), fWeights.data(), fManager->fBufferSize);
+      fNBuffered = 0;
+   }
+   if (fEntries) {
+      fManager->AddStats(fStats, fEntries);
+      std::fill(fStats, fStats + TH1::kNstat, 0.);
+      fEntries = 0;
+   }
+}
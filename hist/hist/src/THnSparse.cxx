@@ -16,6 +16,9 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -318,9 +321,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin table.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the bin table's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -329,12 +332,14 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
       return hash1;
    }
 
-   // else: doesn't fit into a Long64_t:
-   ULong64_t hash = 5381;
-   const Char_t* str = buf;
-   while (str - buf < fCoordBufferSize) {
-      hash *= 5;
-      hash += *(str++);
+   // else: doesn't fit into a Long64_t: mix in the buffer 8 bytes at a
+   // time, such that each bit of the coordinates affects the whole hash.
+   ULong64_t hash = 0;
+   for (Int_t offset = 0; offset < fCoordBufferSize; offset += 8) {
+      ULong64_t word = 0;
+      memcpy(&word, buf + offset, std::min(8, fCoordBufferSize - offset));
+      hash = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+      hash ^= hash >> 29;
    }
    return hash;
 }
@@ -409,6 +414,95 @@ THnSparseCompactBinCoord::~THnSparseCompactBinCoord()
    delete [] fCurrentBin;
 }
 
+
+/** \class THnSparseBinTable
+THnSparseBinTable is a class used by THnSparse internally. It maps the
+hash of the compact bin coordinates to the linear bin index. It is a flat
+open addressing hash table with linear probing: each slot holds a hash
+and its bin index next to each other, such that a lookup usually reads a
+single cache line, and collisions do not need any further allocation. At
+most half of the slots are used, their number is a power of two.
+*/
+
+class THnSparseBinTable {
+public:
+   THnSparseBinTable() { Resize(kMinSlots); }
+
+   /// Return the bin index for "hash" for which "matches(index)" is true,
+   /// or -1 if there is none; "slot" is then where to Insert() it.
+   template <class MATCHES>
+   Long64_t Find(ULong64_t hash, const MATCHES& matches, ULong64_t& slot) const {
+      for (slot = GetFirstSlot(hash);; slot = (slot + 1) & fMask) {
+         const Entry& entry = fEntries[slot];
+         if (!entry.fIndexPlusOne)
+            return -1;
+         if (entry.fHash == hash && matches(entry.fIndexPlusOne - 1))
+            return entry.fIndexPlusOne - 1;
+      }
+   }
+
+   /// Store "index" for "hash" in the "slot" returned by Find().
+   void Insert(ULong64_t slot, ULong64_t hash, Long64_t index) {
+      fEntries[slot].fHash = hash;
+      fEntries[slot].fIndexPlusOne = index + 1;
+      if (2 * (ULong64_t) ++fSize > fEntries.size())
+         Resize(2 * fEntries.size());
+   }
+
+   /// Store "index" for "hash", for a bin that is not yet in the table.
+   void Add(ULong64_t hash, Long64_t index) {
+      ULong64_t slot = GetFirstSlot(hash);
+      while (fEntries[slot].fIndexPlusOne)
+         slot = (slot + 1) & fMask;
+      Insert(slot, hash, index);
+   }
+
+   /// Make room for "nbins" bins.
+   void Reserve(Long64_t nbins) {
+      ULong64_t nslots = fEntries.size();
+      while (nslots < 2 * (ULong64_t) nbins)
+         nslots *= 2;
+      if (nslots != fEntries.size())
+         Resize(nslots);
+   }
+
+   /// Return the allocated memory in bytes.
+   Long64_t GetMemorySize() const { return fEntries.size() * sizeof(Entry); }
+
+private:
+   enum { kMinSlots = 16 };
+
+   struct Entry {
+      ULong64_t fHash;         // hash of the compact bin coordinates
+      Long64_t  fIndexPlusOne; // bin index + 1; 0 for an empty slot
+   };
+
+   /// Fibonacci hashing: take the high bits of the product, which depend on
+   /// all bits of the hash - the hash is the compact coordinate itself for
+   /// up to 8 bytes, whose low bits only depend on the first axes.
+   ULong64_t GetFirstSlot(ULong64_t hash) const {
+      return (hash * 0x9E3779B97F4A7C15ull) >> fShift;
+   }
+
+   void Resize(ULong64_t nslots) {
+      std::vector<Entry> old(nslots, Entry{0, 0});
+      fEntries.swap(old);
+      fMask = nslots - 1;
+      fShift = 64;
+      while (nslots >>= 1)
+         --fShift;
+      fSize = 0;
+      for (const Entry& entry: old)
+         if (entry.fIndexPlusOne)
+            Add(entry.fHash, entry.fIndexPlusOne - 1);
+   }
+
+   std::vector<Entry> fEntries; // slots of the table
+   ULong64_t fMask = 0;         // number of slots - 1
+   Int_t     fShift = 64;       // 64 - log2(number of slots)
+   Long64_t  fSize = 0;         // number of used slots
+};
+
 /** \class THnSparseArrayChunk
 THnSparseArrayChunk is used internally by THnSparse.
 THnSparse stores its (dynamic size) array of bin coordinates and their
@@ -570,14 +664,13 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open addressing hash
+table fBinTable (see THnSparseBinTable); it is rebuilt from the chunks when
+needed, e.g. after reading the histogram. If the compact bin coordinates are
+larger than 8 bytes, two coordinates can have the same hash - which is
+extremely unlikely but possible. The table therefore compares the coordinates
+of each bin with an equal hash to the ones passed to GetBin(), until the
+matching bin is found.
 */
 
 
@@ -587,7 +680,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(1024), fFilledBins(0), fBinTable(0), fCompactCoord(0)
 {
    fBinContent.SetOwner();
 }
@@ -604,7 +697,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(chunksize), fFilledBins(0), fBinTable(0), fCompactCoord(0)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -614,6 +707,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 /// Destruct a THnSparse
 
 THnSparse::~THnSparse() {
+   delete fBinTable;
    delete fCompactCoord;
 }
 
@@ -650,36 +744,25 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+///Set up fBinTable from the bins in the chunks, e.g. if we have been streamed
 
 void THnSparse::FillExMap()
 {
+   delete fBinTable;
+   fBinTable = new THnSparseBinTable();
+   fBinTable->Reserve(GetNbins());
+
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = 0;
-   THnSparseCoordCompression compactCoord(*GetCompactCoord());
+   const THnSparseCoordCompression* compactCoord = GetCompactCoord();
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBinTable->Add(compactCoord->GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -687,12 +770,9 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
+   if (!fBinTable)
       FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   fBinTable->Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -790,21 +870,16 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
+   if (!fBinTable)
       FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
-   }
-   if (!allocate) return -1;
+   const Char_t* buf = cc->GetBuffer();
+   // up to 8 bytes the hash is the compact coordinate: an equal hash is the bin
+   const Bool_t hashIsCoord = cc->GetBufferSize() <= 8;
+   ULong64_t slot = 0;
+   Long64_t linidx = fBinTable->Find(hash, [&](Long64_t idx) {
+         return hashIsCoord || GetChunk(idx / fChunkSize)->Matches(idx % fChunkSize, buf);
+      }, slot);
+   if (linidx >= 0 || !allocate) return linidx;
 
    ++fFilledBins;
 
@@ -819,16 +894,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBinTable->Insert(slot, hash, newidx);
    return newidx;
 }
 
@@ -880,7 +946,8 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   if (fBinTable)
+      size += fBinTable->GetMemorySize();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +1029,8 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   delete fBinTable;
+   fBinTable = 0;
    fBinContent.Delete();
    ResetBase(option);
 }
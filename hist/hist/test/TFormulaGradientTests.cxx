@@ -21,6 +21,7 @@
 #include <TFormula.h>
 #include <TF1.h>
 #include <TFitResult.h>
+#include <TH1.h>
 
 TEST(TFormulaGradientPar, Sanity)
 {
@@ -144,3 +145,36 @@ TEST(TFormulaGradientPar, GetGradFormula)
 #endif // R__WIN32
 }
 
+
+TEST(TFormulaGradientPar, Minuit2FitUsesGradient)
+{
+   std::string defaultMinimizer = ROOT::Math::MinimizerOptions::DefaultMinimizerType();
+   ROOT::Math::MinimizerOptions::SetDefaultMinimizer("Minuit2");
+
+   TH1D h("h", "h", 100, -5, 5);
+   TF1 gen("gen", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]", -5, 5);
+   gen.SetParameters(100, 0.5, 1.2, 10);
+   h.FillRandom("gen", 20000);
+
+   // Minuit2 chi2 fits of a formula use by default the gradient generated by clad
+   TF1 f1("f1", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]", -5, 5);
+   f1.SetParameters(50, 0, 1, 1);
+   TFitResultPtr r1 = h.Fit(&f1, "Q S N");
+
+   // and the numerical gradient with the option NOGRAD
+   TF1 f2("f2", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]", -5, 5);
+   f2.SetParameters(50, 0, 1, 1);
+   TFitResultPtr r2 = h.Fit(&f2, "Q S N NOGRAD");
+
+   ROOT::Math::MinimizerOptions::SetDefaultMinimizer(defaultMinimizer.c_str());
+
+   ASSERT_EQ(r1->Status(), 0);
+   ASSERT_EQ(r2->Status(), 0);
+   EXPECT_TRUE(f1.GetFormula()->HasGeneratedGradient());
+   EXPECT_FALSE(f2.GetFormula()->HasGeneratedGradient());
+   EXPECT_NEAR(r1->MinFcnValue(), r2->MinFcnValue(), 0.01);
+   for (int i = 0; i < 4; ++i)
+      EXPECT_NEAR(r1->Parameter(i), r2->Parameter(i), 0.1 * r2->ParError(i)) << "parameter " << i;
+   // the minimizer does not compute the gradient from evaluations of the chi2
+   EXPECT_LT(r1->NCalls(), r2->NCalls());
+}
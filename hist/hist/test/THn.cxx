@@ -1,8 +1,10 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TList.h"
 
 // Filling THn
 TEST(THn, Fill) {
@@ -111,3 +113,59 @@ TEST(THn, Projection) {
    }
 
 }
+
+
+// Filling and looking up THnSparse bins, with compact coordinates of more than 8 bytes
+TEST(THnSparse, FillAndFindBins) {
+   const Int_t dim = 10;
+   Int_t bins[dim];
+   Double_t xmin[dim];
+   Double_t xmax[dim];
+   for (Int_t d = 0; d < dim; ++d) {
+      bins[d] = 1000;
+      xmin[d] = 0.;
+      xmax[d] = 1000.;
+   }
+   // small chunks, to check the lookup across chunks
+   THnSparseD hs("hs", "hs", dim, bins, xmin, xmax, 64);
+
+   const Int_t nbins = 5000;
+   Double_t x[dim];
+   for (Int_t i = 0; i < nbins; ++i) {
+      x[0] = i % 1000 + 0.5;
+      x[1] = i / 1000 + 0.5;
+      for (Int_t d = 2; d < dim; ++d)
+         x[d] = (i * (d + 1) * 7919) % 1000 + 0.5;
+      hs.Fill(x, 1.);
+      hs.Fill(x, 2.);
+   }
+   EXPECT_EQ(nbins, hs.GetNbins());
+   EXPECT_EQ(2 * nbins, hs.GetEntries());
+
+   Int_t coord[dim];
+   for (Long64_t bin = 0; bin < hs.GetNbins(); ++bin) {
+      EXPECT_DOUBLE_EQ(3., hs.GetBinContent(bin, coord));
+      EXPECT_EQ(bin, hs.GetBin(coord, kFALSE));
+   }
+
+   // a bin that was not filled
+   for (Int_t d = 0; d < dim; ++d)
+      coord[d] = 1000;
+   EXPECT_EQ(-1, hs.GetBin(coord, kFALSE));
+
+   // the bin lookup is rebuilt for a copy, and for merging
+   THnSparse *clone = (THnSparse*) hs.Clone("clone");
+   TList list;
+   list.Add(clone);
+   hs.Merge(&list);
+   EXPECT_EQ(nbins, hs.GetNbins());
+   for (Long64_t bin = 0; bin < hs.GetNbins(); ++bin)
+      EXPECT_DOUBLE_EQ(6., hs.GetBinContent(bin));
+   delete clone;
+
+   hs.Reset();
+   EXPECT_EQ(0, hs.GetNbins());
+   hs.Fill(x);
+   EXPECT_EQ(1, hs.GetNbins());
+   EXPECT_EQ(0, hs.GetBin(x, kFALSE));
+}
@@ -1,9 +1,158 @@
 #include "gtest/gtest.h"
 
 #include "TFormula.h"
+#include "TF1.h"
+#include "TF2.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TRandom3.h"
+#include "Fit/BinData.h"
+#include "Fit/Chi2FCN.h"
+#include "Fit/LogLikelihoodFCN.h"
+#include "Fit/UnBinData.h"
+#include "HFitInterface.h"
+#include "Math/Util.h"
+#include "Math/WrappedMultiTF1.h"
+
+#include <cmath>
+#include <vector>
 
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Evaluating a formula at several points at once must give the same values as point by point
+TEST(TFormula, EvalParBatch)
+{
+   TFormula f1("f1", "[0] + [1] * x + [2] * x * x");
+   TFormula f2("f2", "[0] * exp(-0.5 * ((x - [1]) / [2]) ** 2) * sin(y)");
+   TFormula f3("f3", "x * y - z");
+   const double p1[] = {1., -2., 0.5};
+   const double p2[] = {3., 0.2, 1.5};
+   f1.SetParameters(p1);
+
+   const int n = 1000;
+   std::vector<double> x(3 * n), result(n);
+   for (int i = 0; i < 3 * n; ++i)
+      x[i] = -5. + 10. * i / (3 * n);
+
+   f1.EvalPar(n, x.data(), nullptr, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f1.EvalPar(&x[i]), result[i]) << "point " << i;
+
+   f2.EvalPar(n, x.data(), p2, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f2.EvalPar(&x[2 * i], p2), result[i]) << "point " << i;
+
+   f3.EvalPar(n, x.data(), nullptr, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f3.EvalPar(&x[3 * i]), result[i]) << "point " << i;
+
+   // without coordinates, the stored variables are used for all points
+   f1.SetVariable("x", 2.);
+   f1.EvalPar(10, nullptr, nullptr, result.data());
+   for (int i = 0; i < 10; ++i)
+      EXPECT_DOUBLE_EQ(f1.Eval(2.), result[i]);
+
+   // a copy evaluates its own parameters
+   TFormula f4(f1);
+   const double p4[] = {0., 1., 0.};
+   f4.SetParameters(p4);
+   f4.EvalPar(n, x.data(), nullptr, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(x[i], result[i]) << "point " << i;
+}
+
+TEST(TF1, EvalParBatch)
+{
+   TF1 f("f", "gaus", -5, 5);
+   f.SetParameters(2., 0.5, 1.2);
+   const int n = 500;
+   std::vector<double> x(n), result(n);
+   for (int i = 0; i < n; ++i)
+      x[i] = -5. + 10. * i / n;
+
+   for (bool normalized : {false, true}) {
+      f.SetNormalized(normalized);
+      f.EvalPar(n, x.data(), nullptr, result.data());
+      for (int i = 0; i < n; ++i)
+         EXPECT_DOUBLE_EQ(f.EvalPar(&x[i]), result[i]) << "point " << i;
+   }
+
+   // functions not defined by a formula are evaluated point by point
+   TF1 fl("fl", [](double *xx, double *p) { return p[0] * xx[0]; }, -5, 5, 1);
+   fl.SetParameter(0, 3.);
+   fl.EvalPar(n, x.data(), nullptr, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(3. * x[i], result[i]) << "point " << i;
+
+   // a TF2 defined by a formula of x only takes points with two coordinates
+   TF2 f2("f2", "[0] + [1] * x", -5, 5, -5, 5);
+   f2.SetParameters(1., 2.);
+   std::vector<double> xy(2 * n);
+   for (int i = 0; i < n; ++i) {
+      xy[2 * i] = x[i];
+      xy[2 * i + 1] = -x[i];
+   }
+   f2.EvalPar(n, xy.data(), nullptr, result.data());
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(1. + 2. * x[i], result[i]) << "point " << i;
+}
+
+// The chi2 and likelihood of a fit evaluate the model function on blocks of points
+TEST(TF1, EvalParBatchFit)
+{
+   TH1D h("h", "h", 100, -5, 5);
+   TRandom3 rng(1);
+   for (int i = 0; i < 10000; ++i)
+      h.Fill(rng.Gaus(0.3, 1.1));
+
+   TF1 f("f", "gaus", -5, 5);
+   const double p[] = {400., 0.3, 1.1};
+   ROOT::Math::WrappedMultiTF1 wf(f, 1);
+
+   ROOT::Fit::BinData data;
+   ROOT::Fit::FillData(data, &h, &f);
+   ROOT::Fit::Chi2Function chi2(data, wf);
+   double expected = 0;
+   for (unsigned int i = 0; i < data.Size(); ++i) {
+      const double r = (data.Value(i) - f.EvalPar(data.GetCoordComponent(i, 0), p)) * data.InvError(i);
+      expected += r * r;
+   }
+   EXPECT_NEAR(expected, chi2(p), 1e-12 * expected);
+
+   ROOT::Fit::UnBinData unbinned(1000);
+   for (int i = 0; i < 1000; ++i)
+      unbinned.Add(rng.Gaus(0.3, 1.1));
+   ROOT::Fit::LogLikelihoodFunction logl(unbinned, wf);
+   double expectedLogL = 0;
+   for (unsigned int i = 0; i < unbinned.Size(); ++i)
+      expectedLogL -= ROOT::Math::Util::EvalLog(f.EvalPar(unbinned.GetCoordComponent(i, 0), p));
+   EXPECT_NEAR(expectedLogL, logl(p), 1e-12 * std::abs(expectedLogL));
+}
+
+// The points of a two-dimensional fit have two coordinates even if the formula depends only on x
+TEST(TF1, EvalParBatchFit2DOneDimFormula)
+{
+   TH2D h("h", "h", 20, -5, 5, 20, -5, 5);
+   TRandom3 rng(2);
+   for (int i = 0; i < 10000; ++i)
+      h.Fill(rng.Gaus(0.3, 1.1), rng.Uniform(-5, 5));
+
+   TF2 f("f", "[0] * exp(-0.5 * ((x - [1]) / [2]) ** 2)", -5, 5, -5, 5);
+   const double p[] = {25., 0.3, 1.1};
+   ROOT::Math::WrappedMultiTF1 wf(f, 2);
+
+   ROOT::Fit::BinData data;
+   ROOT::Fit::FillData(data, &h, &f);
+   ROOT::Fit::Chi2Function chi2(data, wf);
+   double expected = 0;
+   for (unsigned int i = 0; i < data.Size(); ++i) {
+      const double xx[] = {*data.GetCoordComponent(i, 0), *data.GetCoordComponent(i, 1)};
+      const double r = (data.Value(i) - f.EvalPar(xx, p)) * data.InvError(i);
+      expected += r * r;
+   }
+   EXPECT_NEAR(expected, chi2(p), 1e-12 * expected);
+}
@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TRandom3.h"
+
+#include <cmath>
+#include <vector>
+
+// FillN computes the bins of batches of entries at once: the results must be identical
+// to filling the entries one by one.
+
+namespace {
+
+constexpr int kNValues = 1000;
+
+std::vector<double> MakeValues(TRandom &rng)
+{
+   std::vector<double> values(kNValues);
+   for (auto &v : values)
+      v = rng.Uniform(-2, 12);
+   // corner cases: the axis limits, NaN and infinities
+   values[10] = 0;
+   values[11] = 10;
+   values[12] = std::nan("");
+   values[13] = INFINITY;
+   values[14] = -INFINITY;
+   return values;
+}
+
+std::vector<double> MakeWeights(TRandom &rng)
+{
+   // the first weights are 1, so that the sum of weights squared is created while filling a batch
+   std::vector<double> weights(kNValues, 1.);
+   for (int i = 300; i < kNValues; ++i)
+      weights[i] = rng.Uniform(0, 2);
+   return weights;
+}
+
+void ExpectEqualHistograms(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   EXPECT_EQ(h1.GetSumw2N(), h2.GetSumw2N());
+   Double_t stats1[TH1::kNstat] = {0};
+   Double_t stats2[TH1::kNstat] = {0};
+   h1.GetStats(stats1);
+   h2.GetStats(stats2);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_EQ(stats1[i], stats2[i]) << "statistic " << i;
+}
+
+} // namespace
+
+TEST(TH1, FillN)
+{
+   TRandom3 rng(1);
+   const auto x = MakeValues(rng);
+   const auto w = MakeWeights(rng);
+
+   TH1D h1("h1", "h1", 7, 0, 10);
+   TH1D h2("h2", "h2", 7, 0, 10);
+   for (int i = 0; i < kNValues; ++i)
+      h1.Fill(x[i]);
+   h2.FillN(kNValues, x.data(), nullptr);
+   ExpectEqualHistograms(h1, h2);
+
+   TH1F h3("h3", "h3", 7, 0, 10);
+   TH1F h4("h4", "h4", 7, 0, 10);
+   for (int i = 0; i < kNValues; ++i)
+      h3.Fill(x[i], w[i]);
+   h4.FillN(kNValues, x.data(), w.data());
+   ExpectEqualHistograms(h3, h4);
+   EXPECT_GT(h4.GetSumw2N(), 0);
+}
+
+TEST(TH1, FillNVariableBinsAndStride)
+{
+   TRandom3 rng(2);
+   auto x = MakeValues(rng);
+   const auto w = MakeWeights(rng);
+   const double edges[] = {0, 0.5, 1, 2, 4, 7, 10};
+   // the statistics include the under/overflows: a NaN or an infinity would make them NaN in both histograms
+   x[12] = -1;
+   x[14] = 11;
+
+   TH1D h1("h1", "h1", 6, edges);
+   TH1D h2("h2", "h2", 6, edges);
+   h1.SetStatOverflows(TH1::EStatOverflows::kConsider);
+   h2.SetStatOverflows(TH1::EStatOverflows::kConsider);
+   // every second value and weight
+   for (int i = 0; i < kNValues; i += 2)
+      h1.Fill(x[i], w[i]);
+   h2.FillN(kNValues / 2, x.data(), w.data(), 2);
+   ExpectEqualHistograms(h1, h2);
+}
+
+TEST(TH2, FillN)
+{
+   TRandom3 rng(3);
+   const auto x = MakeValues(rng);
+   const auto y = MakeValues(rng);
+   const auto w = MakeWeights(rng);
+   const double yedges[] = {-1, 0, 3, 5, 11};
+
+   TH2D h1("h1", "h1", 5, 0, 10, 4, yedges);
+   TH2D h2("h2", "h2", 5, 0, 10, 4, yedges);
+   for (int i = 0; i < kNValues; ++i)
+      h1.Fill(x[i], y[i], w[i]);
+   h2.FillN(kNValues, x.data(), y.data(), w.data());
+   ExpectEqualHistograms(h1, h2);
+}
+
+TEST(TH3, FillN)
+{
+   TRandom3 rng(4);
+   const auto x = MakeValues(rng);
+   const auto y = MakeValues(rng);
+   const auto z = MakeValues(rng);
+   const auto w = MakeWeights(rng);
+
+   TH3F h1("h1", "h1", 3, 0, 10, 4, 0, 10, 5, 0, 10);
+   TH3F h2("h2", "h2", 3, 0, 10, 4, 0, 10, 5, 0, 10);
+   for (int i = 0; i < kNValues; ++i)
+      h1.Fill(x[i], y[i], z[i]);
+   h2.FillN(kNValues, x.data(), y.data(), z.data(), nullptr);
+   ExpectEqualHistograms(h1, h2);
+
+   TH3D h3("h3", "h3", 3, 0, 10, 4, 0, 10, 5, 0, 10);
+   TH3D h4("h4", "h4", 3, 0, 10, 4, 0, 10, 5, 0, 10);
+   for (int i = 0; i < kNValues; ++i)
+      h3.Fill(x[i], y[i], z[i], w[i]);
+   h4.FillN(kNValues, x.data(), y.data(), z.data(), w.data());
+   ExpectEqualHistograms(h3, h4);
+}
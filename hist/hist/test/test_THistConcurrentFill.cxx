@@ -0,0 +1,214 @@
+#include "gtest/gtest.h"
+
+#include "ROOT/THistConcurrentFill.hxx"
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "THn.h"
+#include "TRandom3.h"
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+// Fill histograms from several threads and compare them with filling the same entries sequentially.
+// The weights are multiples of 1/4, so that the bin contents do not depend on the order of the additions.
+
+namespace {
+
+constexpr int kNThreads = 4;
+constexpr int kNEntries = 20000; // per thread
+
+struct Entries {
+   std::vector<double> fX, fY, fZ, fW;
+};
+
+Entries MakeEntries(int seed, bool weighted)
+{
+   TRandom3 rng(seed);
+   Entries entries;
+   for (int i = 0; i < kNEntries; ++i) {
+      entries.fX.push_back(rng.Uniform(-1, 11));
+      entries.fY.push_back(rng.Gaus(5, 3));
+      entries.fZ.push_back(rng.Uniform(0, 10));
+      entries.fW.push_back(weighted ? 0.25 * rng.Integer(8) : 1.);
+   }
+   return entries;
+}
+
+/// Fill the entries of each thread with a filler, from kNThreads threads.
+template <typename FILL>
+void FillConcurrently(ROOT::THistConcurrentFillManager &manager, const std::vector<Entries> &entries, FILL fill)
+{
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         auto filler = manager.MakeFiller();
+         for (int i = 0; i < kNEntries; ++i)
+            fill(filler, entries[t], i);
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   manager.Flush();
+}
+
+void ExpectEqualHistograms(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin)) << "bin " << bin;
+   }
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   EXPECT_EQ(h1.GetSumw2N(), h2.GetSumw2N());
+   Double_t stats1[TH1::kNstat] = {0};
+   Double_t stats2[TH1::kNstat] = {0};
+   h1.GetStats(stats1);
+   h2.GetStats(stats2);
+   // the sums of w * x depend on the order of the additions
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_NEAR(stats1[i], stats2[i], 1e-9 * std::abs(stats1[i])) << "statistic " << i;
+}
+
+std::vector<Entries> MakeAllEntries(bool weighted)
+{
+   std::vector<Entries> entries;
+   for (int t = 0; t < kNThreads; ++t)
+      entries.push_back(MakeEntries(t + 1, weighted));
+   return entries;
+}
+
+} // namespace
+
+TEST(THistConcurrentFill, TH1Buffered)
+{
+   const auto entries = MakeAllEntries(true);
+   TH1D expected("expected", "", 50, 0, 10);
+   for (const auto &e : entries)
+      for (int i = 0; i < kNEntries; ++i)
+         expected.Fill(e.fX[i], e.fW[i]);
+
+   TH1D h("h", "", 50, 0, 10);
+   ROOT::THistConcurrentFillManager manager(h, ROOT::THistConcurrentFillManager::EMode::kBuffered, 100);
+   FillConcurrently(manager, entries, [](ROOT::THistConcurrentFiller &filler, const Entries &e, int i) {
+      filler.Fill(e.fX[i], e.fW[i]);
+   });
+   ExpectEqualHistograms(expected, h);
+}
+
+TEST(THistConcurrentFill, TH1Atomic)
+{
+   for (bool weighted : {false, true}) {
+      const auto entries = MakeAllEntries(weighted);
+      TH1F expected("expected", "", 50, 0, 10);
+      for (const auto &e : entries)
+         for (int i = 0; i < kNEntries; ++i)
+            expected.Fill(e.fX[i], e.fW[i]);
+
+      TH1F h("h", "", 50, 0, 10);
+      ROOT::THistConcurrentFillManager manager(h, ROOT::THistConcurrentFillManager::EMode::kAtomic);
+      EXPECT_EQ(manager.GetMode(), ROOT::THistConcurrentFillManager::EMode::kAtomic);
+      FillConcurrently(manager, entries, [](ROOT::THistConcurrentFiller &filler, const Entries &e, int i) {
+         filler.Fill(e.fX[i], e.fW[i]);
+      });
+      ExpectEqualHistograms(expected, h);
+   }
+}
+
+TEST(THistConcurrentFill, AtomicWeightsAfterFlush)
+{
+   // the sums of weights squared are only created by the first weight different from 1, here after a Flush
+   TH1D expected("expected", "", 10, 0, 10);
+   TH1D h("h", "", 10, 0, 10);
+   ROOT::THistConcurrentFillManager manager(h, ROOT::THistConcurrentFillManager::EMode::kAtomic);
+   auto filler = manager.MakeFiller();
+   for (int i = 0; i < 100; ++i) {
+      expected.Fill(i % 10 + 0.5);
+      filler.Fill(i % 10 + 0.5);
+   }
+   filler.Flush();
+   manager.Flush();
+   EXPECT_EQ(h.GetSumw2N(), 0);
+   for (int i = 0; i < 100; ++i) {
+      expected.Fill(i % 7 + 0.5, 0.25 * (i % 8));
+      filler.Fill(i % 7 + 0.5, 0.25 * (i % 8));
+   }
+   filler.Flush();
+   manager.Flush();
+   ExpectEqualHistograms(expected, h);
+}
+
+TEST(THistConcurrentFill, TH2AndTH3)
+{
+   const auto entries = MakeAllEntries(true);
+   for (auto mode : {ROOT::THistConcurrentFillManager::EMode::kBuffered,
+                     ROOT::THistConcurrentFillManager::EMode::kAtomic}) {
+      TH2D expected2("expected2", "", 20, 0, 10, 30, 0, 10);
+      TH3D expected3("expected3", "", 10, 0, 10, 10, 0, 10, 10, 0, 10);
+      expected2.SetStatOverflows(TH1::EStatOverflows::kConsider);
+      for (const auto &e : entries) {
+         for (int i = 0; i < kNEntries; ++i) {
+            expected2.Fill(e.fX[i], e.fY[i], e.fW[i]);
+            expected3.Fill(e.fX[i], e.fY[i], e.fZ[i], e.fW[i]);
+         }
+      }
+
+      TH2D h2("h2", "", 20, 0, 10, 30, 0, 10);
+      TH3D h3("h3", "", 10, 0, 10, 10, 0, 10, 10, 0, 10);
+      h2.SetStatOverflows(TH1::EStatOverflows::kConsider);
+      {
+         ROOT::THistConcurrentFillManager manager2(h2, mode, 64);
+         ROOT::THistConcurrentFillManager manager3(h3, mode, 64);
+         FillConcurrently(manager2, entries, [](ROOT::THistConcurrentFiller &filler, const Entries &e, int i) {
+            filler.Fill(e.fX[i], e.fY[i], e.fW[i]);
+         });
+         FillConcurrently(manager3, entries, [](ROOT::THistConcurrentFiller &filler, const Entries &e, int i) {
+            filler.Fill(e.fX[i], e.fY[i], e.fZ[i], e.fW[i]);
+         });
+      }
+      ExpectEqualHistograms(expected2, h2);
+      ExpectEqualHistograms(expected3, h3);
+   }
+}
+
+TEST(THistConcurrentFill, AtomicFallsBackToBuffered)
+{
+   TH1D h("h", "", 10, 0, 1);
+   h.SetCanExtend(TH1::kAllAxes);
+   ROOT::THistConcurrentFillManager manager(h, ROOT::THistConcurrentFillManager::EMode::kAtomic);
+   EXPECT_EQ(manager.GetMode(), ROOT::THistConcurrentFillManager::EMode::kBuffered);
+   {
+      auto filler = manager.MakeFiller();
+      filler.Fill(5.);
+   }
+   EXPECT_EQ(h.GetEntries(), 1);
+   EXPECT_GT(h.GetXaxis()->GetXmax(), 5.);
+}
+
+TEST(THistConcurrentFill, THn)
+{
+   const auto entries = MakeAllEntries(true);
+   const Int_t nbins[3] = {10, 10, 10};
+   const Double_t xmin[3] = {0, 0, 0};
+   const Double_t xmax[3] = {10, 10, 10};
+   THnD expected("expected", "", 3, nbins, xmin, xmax);
+   for (const auto &e : entries) {
+      for (int i = 0; i < kNEntries; ++i) {
+         const Double_t x[3] = {e.fX[i], e.fY[i], e.fZ[i]};
+         expected.Fill(x, e.fW[i]);
+      }
+   }
+
+   THnD h("h", "", 3, nbins, xmin, xmax);
+   ROOT::THistConcurrentFillManager manager(h);
+   FillConcurrently(manager, entries, [](ROOT::THistConcurrentFiller &filler, const Entries &e, int i) {
+      const Double_t x[3] = {e.fX[i], e.fY[i], e.fZ[i]};
+      filler.Fill(x, e.fW[i]);
+   });
+   EXPECT_EQ(expected.GetEntries(), h.GetEntries());
+   for (Long64_t bin = 0; bin < expected.GetNbins(); ++bin) {
+      EXPECT_EQ(expected.GetBinContent(bin), h.GetBinContent(bin)) << "bin " << bin;
+      EXPECT_EQ(expected.GetBinError2(bin), h.GetBinError2(bin)) << "bin " << bin;
+   }
+}
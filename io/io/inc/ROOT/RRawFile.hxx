@@ -66,6 +66,9 @@ public:
       ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1) {}
    };
 
+   /// Hints about the expected access pattern of a memory region returned by Map(), see AdviseMap()
+   enum class EMapAdvice { kNormal, kSequential, kRandom, kWillNeed, kDontNeed };
+
    /// Used for vector reads from multiple offsets into multiple buffers. This is unlike readv(), which scatters a
    /// single byte range from disk into multiple buffers.
    struct RIOVec {
@@ -134,6 +137,8 @@ protected:
    virtual void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset);
    /// Derived classes with mmap support must be able to unmap the memory area handed out by Map()
    virtual void UnmapImpl(void *region, size_t nbytes);
+   /// Derived classes with mmap support can forward the hint to the operating system; by default it is ignored
+   virtual void AdviseMapImpl(void * /* region */, size_t /* nbytes */, EMapAdvice /* advice */) {}
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
@@ -179,6 +184,9 @@ public:
    void *Map(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset);
    /// Receives a pointer returned by Map() and should have nbytes set to the full length of the mapping
    void Unmap(void *region, size_t nbytes);
+   /// Hints the expected use of (a page aligned part of) a region returned by Map(), e.g. that it will be needed soon
+   /// and should be read ahead; like madvise(), the hint does not change the content of the mapping
+   void AdviseMap(void *region, size_t nbytes, EMapAdvice advice);
 
    /// Derived classes shall inform the user about the supported functionality, which can possibly depend
    /// on the file at hand
@@ -80,6 +80,12 @@ public:
    /** Returns the current value of the auto save setting in bytes (default = 0). */
    size_t GetAutoSave() const;
 
+   /** Returns the maximum number of bytes allowed in the queue (default = 0, unbounded). */
+   size_t GetMaxBuffered() const
+   {
+      return fMaxBuffered;
+   }
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -93,6 +99,16 @@ public:
     */
    void SetAutoSave(size_t size);
 
+   /** Bounds the amount of data waiting in the merge queue. When a
+    *  TBufferMergerFile pushes its data while more than size bytes are
+    *  buffered, the writing thread waits for the merge in progress to
+    *  finish and then merges the queue itself, instead of returning
+    *  immediately. This applies backpressure to the writing threads and
+    *  caps the memory used by the queue when the merging cannot keep up
+    *  with many writers. A size of 0 (the default) leaves the queue unbounded.
+    */
+   void SetMaxBuffered(size_t size);
+
    /** Sets the merge options. SetMergeOptions("fast") will disable
     * recompression of input data into the output if they have different
     * compression settings.
@@ -160,6 +176,7 @@ private:
 
    bool fCompressTemporaryKeys{false};                           //< Enable compression of the TKeys in the TMemFile (save memory at the expense of time, end result is unchanged)
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
+   size_t fMaxBuffered{0};                                       //< Writers wait for the merge beyond fMaxBuffered bytes in the queue
    std::atomic<size_t> fBuffered{0};                             //< Number of bytes currently buffered
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
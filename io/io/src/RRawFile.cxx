@@ -256,3 +256,10 @@ void ROOT::Internal::RRawFile::Unmap(void *region, size_t nbytes)
       throw std::runtime_error("Cannot unmap, file not open");
    UnmapImpl(region, nbytes);
 }
+
+void ROOT::Internal::RRawFile::AdviseMap(void *region, size_t nbytes, EMapAdvice advice)
+{
+   if (!fIsOpen)
+      throw std::runtime_error("Cannot advise on a mapping, file not open");
+   AdviseMapImpl(region, nbytes, advice);
+}
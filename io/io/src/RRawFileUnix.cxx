@@ -116,9 +116,12 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
+   // Setting up a ring requires several system calls and memory mappings; every thread reuses its ring across calls
+   thread_local std::unique_ptr<RIoUring> ring;
    if (!uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
+         if (!ring)
+            ring = std::make_unique<RIoUring>(); // throws std::runtime_error
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -129,7 +132,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         ring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
@@ -140,6 +143,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
          Warning("RRawFileUnix",
               "io_uring setup failed, falling back to blocking I/O in ReadV");
          uring_failed = true;
+         ring.reset();
       }
    }
 #endif
@@ -177,3 +181,17 @@ void ROOT::Internal::RRawFileUnix::UnmapImpl(void *region, size_t nbytes)
    if (rv != 0)
       throw std::runtime_error(std::string("Cannot remove memory mapping: ") + strerror(errno));
 }
+
+void ROOT::Internal::RRawFileUnix::AdviseMapImpl(void *region, size_t nbytes, EMapAdvice advice)
+{
+   int posixAdvice = POSIX_MADV_NORMAL;
+   switch (advice) {
+   case EMapAdvice::kNormal: posixAdvice = POSIX_MADV_NORMAL; break;
+   case EMapAdvice::kSequential: posixAdvice = POSIX_MADV_SEQUENTIAL; break;
+   case EMapAdvice::kRandom: posixAdvice = POSIX_MADV_RANDOM; break;
+   case EMapAdvice::kWillNeed: posixAdvice = POSIX_MADV_WILLNEED; break;
+   case EMapAdvice::kDontNeed: posixAdvice = POSIX_MADV_DONTNEED; break;
+   }
+   // Only a hint: failures are not fatal
+   posix_madvise(region, nbytes, posixAdvice);
+}
@@ -17,6 +17,7 @@
 The concrete implementation of TBuffer for writing/reading to/from a ROOT file or socket.
 */
 
+#include <algorithm>
 #include <string.h>
 #include <typeinfo>
 #include <string>
@@ -34,15 +35,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TStreamerInfoActions.h"
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
-
-#if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
-     defined(__GNUC__)
-#define USE_BSWAPCPY
-#endif
-
-#ifdef USE_BSWAPCPY
-#include "Bswapcpy.h"
-#endif
+#include "ROOT/RByteSwap.hxx"
 
 
 const UInt_t kNewClassTag       = 0xFFFFFFFF;
@@ -68,6 +61,136 @@ static inline bool Class_Has_StreamerInfo(const TClass* cl)
    return cl->GetStreamerInfos()->GetLast()>1;
 }
 
+namespace {
+
+/// Number of values converted at once by the Float16_t/Double32_t array kernels below:
+/// the integers (or floats) are byte swapped as a block into a stack buffer and then
+/// converted by a loop without dependencies that the compiler can vectorize.
+constexpr Int_t kPackChunk = 256;
+
+/// Copy n big endian 4 bytes words from the buffer to `to` and advance the buffer.
+inline void UnpackWords(char *&buf, void *to, Int_t n)
+{
+#ifdef R__BYTESWAP
+   ROOT::Internal::ByteSwapCopy32(to, buf, n);
+#else
+   memcpy(to, buf, n * sizeof(UInt_t));
+#endif
+   buf += n * sizeof(UInt_t);
+}
+
+/// Copy n 4 bytes words from `from` to the buffer in big endian byte order and advance the buffer.
+inline void PackWords(char *&buf, const void *from, Int_t n)
+{
+#ifdef R__BYTESWAP
+   ROOT::Internal::ByteSwapCopy32(buf, from, n);
+#else
+   memcpy(buf, from, n * sizeof(UInt_t));
+#endif
+   buf += n * sizeof(UInt_t);
+}
+
+/// Read n values stored as integers scaled to a range, see TBufferFile::WriteDouble32.
+template <typename T>
+void UnpackWithFactor(char *&buf, T *ptr, Int_t n, Double_t factor, Double_t minvalue)
+{
+   UInt_t aint[kPackChunk];
+   for (Int_t i = 0; i < n; i += kPackChunk) {
+      const Int_t m = std::min(kPackChunk, n - i);
+      UnpackWords(buf, aint, m);
+      for (Int_t j = 0; j < m; ++j)
+         ptr[i + j] = (T)(aint[j] / factor + minvalue);
+   }
+}
+
+/// Write n values as integers scaled to the range [xmin, xmax], see TBufferFile::WriteDouble32.
+/// The values are clamped to the range in the precision of T, as the element by element code did.
+template <typename T>
+void PackWithFactor(char *&buf, const T *ptr, Int_t n, Double_t factor, Double_t xmin, Double_t xmax)
+{
+   UInt_t aint[kPackChunk];
+   for (Int_t i = 0; i < n; i += kPackChunk) {
+      const Int_t m = std::min(kPackChunk, n - i);
+      for (Int_t j = 0; j < m; ++j) {
+         T x = ptr[i + j];
+         if (x < xmin) x = xmin;
+         if (x > xmax) x = xmax;
+         aint[j] = UInt_t(0.5 + factor * (x - xmin));
+      }
+      PackWords(buf, aint, m);
+   }
+}
+
+/// Read n values stored as floats.
+template <typename T>
+void UnpackFloats(char *&buf, T *ptr, Int_t n)
+{
+   Float_t afloat[kPackChunk];
+   for (Int_t i = 0; i < n; i += kPackChunk) {
+      const Int_t m = std::min(kPackChunk, n - i);
+      UnpackWords(buf, afloat, m);
+      for (Int_t j = 0; j < m; ++j)
+         ptr[i + j] = (T)afloat[j];
+   }
+}
+
+/// Write n values as floats.
+template <typename T>
+void PackFloats(char *&buf, const T *ptr, Int_t n)
+{
+   Float_t afloat[kPackChunk];
+   for (Int_t i = 0; i < n; i += kPackChunk) {
+      const Int_t m = std::min(kPackChunk, n - i);
+      for (Int_t j = 0; j < m; ++j)
+         afloat[j] = (Float_t)ptr[i + j];
+      PackWords(buf, afloat, m);
+   }
+}
+
+/// Read n values stored as an exponent byte and a big endian truncated mantissa of nbits (plus sign) bits,
+/// see TBufferFile::WriteFloat16.
+template <typename T>
+void UnpackWithNbits(char *&buf, T *ptr, Int_t n, Int_t nbits)
+{
+   const UInt_t manMask = (1 << (nbits + 1)) - 1;
+   const UInt_t signBit = 1 << (nbits + 1);
+   for (Int_t i = 0; i < n; ++i, buf += 3) {
+      const UInt_t theExp = (UChar_t)buf[0];
+      const UInt_t theMan = ((UChar_t)buf[1] << 8) | (UChar_t)buf[2];
+      const UInt_t intValue = (theExp << 23) | ((theMan & manMask) << (23 - nbits));
+      Float_t floatValue;
+      memcpy(&floatValue, &intValue, sizeof(Float_t));
+      if (theMan & signBit)
+         floatValue = -floatValue;
+      ptr[i] = (T)floatValue;
+   }
+}
+
+/// Write n values as an exponent byte and a big endian mantissa truncated to nbits (plus sign) bits,
+/// see TBufferFile::WriteFloat16.
+template <typename T>
+void PackWithNbits(char *&buf, const T *ptr, Int_t n, Int_t nbits)
+{
+   for (Int_t i = 0; i < n; ++i, buf += 3) {
+      const Float_t floatValue = (Float_t)ptr[i];
+      UInt_t intValue;
+      memcpy(&intValue, &floatValue, sizeof(Float_t));
+      const UChar_t theExp = (UChar_t)(0x000000ff & ((intValue << 1) >> 24));
+      UShort_t theMan = ((1 << (nbits + 1)) - 1) & (intValue >> (23 - nbits - 1));
+      theMan++;
+      theMan = theMan >> 1;
+      if (theMan & 1 << nbits)
+         theMan = (1 << nbits) - 1;
+      if (floatValue < 0)
+         theMan |= 1 << (nbits + 1);
+      buf[0] = theExp;
+      buf[1] = (char)(theMan >> 8);
+      buf[2] = (char)(theMan & 0xff);
+   }
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create an I/O buffer object. Mode should be either TBuffer::kRead or
 /// TBuffer::kWrite. By default the I/O buffer has a size of
@@ -761,13 +884,8 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    if (!h) h = new Short_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -794,13 +912,8 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    if (!ii) ii = new Int_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy32(ii, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -853,8 +966,8 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwapCopy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -881,13 +994,8 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    if (!f) f = new Float_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy32(f, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -914,8 +1022,8 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwapCopy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1034,13 +1142,8 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    if (!h) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1066,13 +1169,8 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    if (!ii) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1123,8 +1221,8 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwapCopy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1150,13 +1248,8 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    if (!f) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1182,8 +1275,8 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwapCopy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1300,13 +1393,8 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    if (n <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy16(h, fBufCur, n);
    fBufCur += sizeof(Short_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1322,13 +1410,8 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1360,8 +1443,8 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwapCopy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1377,13 +1460,8 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
+   ROOT::Internal::ByteSwapCopy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1399,8 +1477,8 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwapCopy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1417,33 +1495,14 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a float
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
-      }
+      UnpackWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the new float.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         f[i] = fFloatValue;
-      }
+      UnpackWithNbits(fBufCur, f, n, nbits);
    }
 }
 
@@ -1456,9 +1515,7 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
-   }
+   UnpackWithFactor(fBufCur, ptr, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1472,21 +1529,7 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    if (!nbits) nbits = 12;
    //we read the exponent and the truncated mantissa of the float
    //and rebuild the new float.
-   union {
-      Float_t fFloatValue;
-      Int_t   fIntValue;
-   };
-   UChar_t  theExp;
-   UShort_t theMan;
-   for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
-      fIntValue = theExp;
-      fIntValue <<= 23;
-      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-      if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-      ptr[i] = fFloatValue;
-   }
+   UnpackWithNbits(fBufCur, ptr, n, nbits);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1499,40 +1542,17 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a double.
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
-      }
+      UnpackWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) {
          //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
+         UnpackFloats(fBufCur, d, n);
       } else {
          //we read the exponent and the truncated mantissa of the float
          //and rebuild the double.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         UChar_t  theExp;
-         UShort_t theMan;
-         for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
-            fIntValue = theExp;
-            fIntValue <<= 23;
-            fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-            if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-            d[i] = (Double_t)fFloatValue;
-         }
+         UnpackWithNbits(fBufCur, d, n, nbits);
       }
    }
 }
@@ -1546,9 +1566,7 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
-   }
+   UnpackWithFactor(fBufCur, d, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1561,29 +1579,11 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 
    if (!nbits) {
       //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
+      UnpackFloats(fBufCur, d, n);
    } else {
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the double.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         d[i] = (Double_t)fFloatValue;
-      }
+      UnpackWithNbits(fBufCur, d, n, nbits);
    }
 }
 
@@ -1733,13 +1733,8 @@ void TBufferFile::WriteArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
+   ROOT::Internal::ByteSwapCopy16(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
 #else
    memcpy(fBufCur, h, l);
    fBufCur += l;
@@ -1763,13 +1758,8 @@ void TBufferFile::WriteArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
+   ROOT::Internal::ByteSwapCopy32(fBufCur, ii, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
 #else
    memcpy(fBufCur, ii, l);
    fBufCur += l;
@@ -1831,8 +1821,8 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   ROOT::Internal::ByteSwapCopy64(fBufCur, ll, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -1856,13 +1846,8 @@ void TBufferFile::WriteArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
+   ROOT::Internal::ByteSwapCopy32(fBufCur, f, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
 #else
    memcpy(fBufCur, f, l);
    fBufCur += l;
@@ -1886,8 +1871,8 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   ROOT::Internal::ByteSwapCopy64(fBufCur, d, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -1999,13 +1984,8 @@ void TBufferFile::WriteFastArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
+   ROOT::Internal::ByteSwapCopy16(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
 #else
    memcpy(fBufCur, h, l);
    fBufCur += l;
@@ -2023,13 +2003,8 @@ void TBufferFile::WriteFastArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
+   ROOT::Internal::ByteSwapCopy32(fBufCur, ii, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
 #else
    memcpy(fBufCur, ii, l);
    fBufCur += l;
@@ -2075,8 +2050,8 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   ROOT::Internal::ByteSwapCopy64(fBufCur, ll, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -2094,13 +2069,8 @@ void TBufferFile::WriteFastArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
+   ROOT::Internal::ByteSwapCopy32(fBufCur, f, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
 #else
    memcpy(fBufCur, f, l);
    fBufCur += l;
@@ -2118,8 +2088,8 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   ROOT::Internal::ByteSwapCopy64(fBufCur, d, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2141,39 +2111,16 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
       //A range is specified. We normalize the float to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Float_t x = f[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      PackWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
-      Int_t i;
       //a range is not specified, but nbits is.
       //In this case we truncate the mantissa to nbits and we stream
       //the exponent as a UChar_t and the mantissa as a UShort_t.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      for (i = 0; i < n; i++) {
-         fFloatValue = f[i];
-         UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-         UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-         theMan++;
-         theMan = theMan>>1;
-         if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
-         if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-         *this << theExp;
-         *this << theMan;
-      }
+      PackWithNbits(fBufCur, f, n, nbits);
    }
 }
 
@@ -2192,45 +2139,19 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       //A range is specified. We normalize the double to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Double_t x = d[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      PackWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
-      Int_t i;
       if (!nbits) {
          //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
-         }
+         PackFloats(fBufCur, d, n);
       } else {
          //a range is not specified, but nbits is.
          //In this case we truncate the mantissa to nbits and we stream
          //the exponent as a UChar_t and the mantissa as a UShort_t.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         for (i = 0; i < n; i++) {
-            fFloatValue = (Float_t)d[i];
-            UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-            UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-            theMan++;
-            theMan = theMan>>1;
-            if(theMan&1<<nbits) theMan = (1<<nbits) - 1;
-            if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-            *this << theExp;
-            *this << theMan;
-         }
+         PackWithNbits(fBufCur, d, n, nbits);
       }
    }
 }
@@ -16,6 +16,7 @@
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace ROOT {
@@ -79,8 +80,15 @@ void TBufferMerger::Push(TBufferFile *buffer)
       fQueue.push(buffer);
    }
 
-   if (fBuffered > fAutoSave)
+   if (fMaxBuffered && fBuffered > fMaxBuffered) {
+      // Apply backpressure: wait for the merge in progress instead of letting the queue grow,
+      // then merge what is left in the queue unless another waiting thread already did.
+      std::lock_guard<std::mutex> lock(fMergeMutex);
+      if (fBuffered > std::min(fAutoSave, fMaxBuffered))
+         MergeImpl();
+   } else if (fBuffered > fAutoSave) {
       Merge();
+   }
 }
 
 size_t TBufferMerger::GetAutoSave() const
@@ -99,6 +107,11 @@ void TBufferMerger::SetAutoSave(size_t size)
    fAutoSave = size;
 }
 
+void TBufferMerger::SetMaxBuffered(size_t size)
+{
+   fMaxBuffered = size;
+}
+
 void TBufferMerger::SetMergeOptions(const TString& options)
 {
    fMerger.SetMergeOptions(options);
@@ -20,6 +20,13 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+The options set with SetMergeOptions are passed down to the Merge
+functions of the objects. For TTrees, the option "parallel" overlaps
+the reading of the input baskets with the writing of the output ones
+when implicit multi-threading is enabled (see TTreeCloner); when the
+baskets have to be recompressed, this is done by several threads
+whenever implicit multi-threading is enabled.
 */
 
 #include "TFileMerger.h"
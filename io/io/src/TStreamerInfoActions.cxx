@@ -253,6 +253,25 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t ReadBasicArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      // Read a fixed size array or a run of consecutive data members of the same
+      // numerical type (regrouped by TStreamerInfo::Compile) in a single call,
+      // letting the buffer byteswap and copy all of them at once.
+      T *x = (T*)( ((char*)addr) + config->fOffset );
+      buf.ReadFastArray(x, config->fCompInfo->fLength);
+      return 0;
+   }
+
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t WriteBasicArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      T *x = (T *)(((char *)addr) + config->fOffset);
+      buf.WriteFastArray(x, config->fCompInfo->fLength);
+      return 0;
+   }
+
    INLINE_TEMPLATE_ARGS Int_t WriteTextTNamed(TBuffer &buf, void *addr, const TConfiguration *config)
    {
       void *x = (void *)(((char *)addr) + config->fOffset);
@@ -2853,6 +2872,20 @@ static TConfiguredAction GetCollectionReadAction(TVirtualStreamerInfo *info, TSt
       case TStreamerInfo::kULong:   return TConfiguredAction( Looper::template ReadBasicType<ULong_t>,  new TConfiguration(info,i,compinfo,offset) );   break;
       case TStreamerInfo::kULong64: return TConfiguredAction( Looper::template ReadBasicType<ULong64_t>, new TConfiguration(info,i,compinfo,offset) ); break;
       case TStreamerInfo::kBits: return TConfiguredAction( Looper::template ReadAction<TStreamerInfoActions::ReadBasicType<BitsMarker> > , new TBitsConfiguration(info,i,compinfo,offset) ); break;
+      // Read arrays and regrouped runs of basic types.
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Bool_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Char_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Short_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Int_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Long_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Long64_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Float_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<Double_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<UChar_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<UShort_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<UInt_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<ULong_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64: return TConfiguredAction( Looper::template ReadAction<ReadBasicArray<ULong64_t> >, new TConfiguration(info,i,compinfo,offset) ); break;
       case TStreamerInfo::kFloat16: {
          if (element->GetFactor() != 0) {
             return TConfiguredAction( Looper::template ReadAction<ReadBasicType_WithFactor<float> >, new TConfWithFactor(info,i,compinfo,offset,element->GetFactor(),element->GetXmin()) );
@@ -3282,6 +3315,20 @@ void TStreamerInfo::AddReadAction(TStreamerInfoActions::TActionSequence *readSeq
       case TStreamerInfo::kULong:   readSequence->AddAction( ReadBasicType<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );   break;
       case TStreamerInfo::kULong64: readSequence->AddAction( ReadBasicType<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
       case TStreamerInfo::kBits:    readSequence->AddAction( ReadBasicType<BitsMarker>, new TBitsConfiguration(this,i,compinfo,compinfo->fOffset) );     break;
+      // read arrays and regrouped runs of basic types
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool: readSequence->AddAction( ReadBasicArray<Bool_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar: readSequence->AddAction( ReadBasicArray<Char_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort: readSequence->AddAction( ReadBasicArray<Short_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt: readSequence->AddAction( ReadBasicArray<Int_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong: readSequence->AddAction( ReadBasicArray<Long_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64: readSequence->AddAction( ReadBasicArray<Long64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat: readSequence->AddAction( ReadBasicArray<Float_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble: readSequence->AddAction( ReadBasicArray<Double_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar: readSequence->AddAction( ReadBasicArray<UChar_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort: readSequence->AddAction( ReadBasicArray<UShort_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt: readSequence->AddAction( ReadBasicArray<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong: readSequence->AddAction( ReadBasicArray<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64: readSequence->AddAction( ReadBasicArray<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
       case TStreamerInfo::kFloat16: {
          if (element->GetFactor() != 0) {
             readSequence->AddAction( ReadBasicType_WithFactor<float>, new TConfWithFactor(this,i,compinfo,compinfo->fOffset,element->GetFactor(),element->GetXmin()) );
@@ -3601,6 +3648,20 @@ void TStreamerInfo::AddWriteAction(TStreamerInfoActions::TActionSequence *writeS
       case TStreamerInfo::kUInt:    writeSequence->AddAction( WriteBasicType<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
       case TStreamerInfo::kULong:   writeSequence->AddAction( WriteBasicType<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );   break;
       case TStreamerInfo::kULong64: writeSequence->AddAction( WriteBasicType<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      // write arrays and regrouped runs of basic types
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool: writeSequence->AddAction( WriteBasicArray<Bool_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar: writeSequence->AddAction( WriteBasicArray<Char_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort: writeSequence->AddAction( WriteBasicArray<Short_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt: writeSequence->AddAction( WriteBasicArray<Int_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong: writeSequence->AddAction( WriteBasicArray<Long_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64: writeSequence->AddAction( WriteBasicArray<Long64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat: writeSequence->AddAction( WriteBasicArray<Float_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble: writeSequence->AddAction( WriteBasicArray<Double_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar: writeSequence->AddAction( WriteBasicArray<UChar_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort: writeSequence->AddAction( WriteBasicArray<UShort_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt: writeSequence->AddAction( WriteBasicArray<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong: writeSequence->AddAction( WriteBasicArray<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64: writeSequence->AddAction( WriteBasicArray<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
        // case TStreamerInfo::kBits:    writeSequence->AddAction( WriteBasicType<BitsMarker>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
      /*case TStreamerInfo::kFloat16: {
          if (element->GetFactor() != 0) {
@@ -0,0 +1,28 @@
+#ifndef ROOT_IO_TEST_FIXEDARRAYS
+#define ROOT_IO_TEST_FIXEDARRAYS
+
+#include "Rtypes.h"
+
+#include <vector>
+
+/**
+ * FixedArrays and FixedArraysHolder have no purpose except to provide
+ * inputs to the test cases: TStreamerInfo streams fixed size arrays and
+ * runs of consecutive members of the same numerical type as single arrays.
+ */
+
+struct FixedArrays {
+   Int_t fA[5];
+   Double_t fX;
+   Double_t fY;
+   Double_t fZ;
+   Short_t fS;
+   Float_t fF[3];
+};
+
+struct FixedArraysHolder {
+   FixedArrays fSingle;
+   std::vector<FixedArrays> fMany;
+};
+
+#endif
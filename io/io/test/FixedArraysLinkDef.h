@@ -0,0 +1,11 @@
+#ifdef __CINT__
+
+#pragma link off all globals;
+#pragma link off all classes;
+#pragma link off all functions;
+
+#pragma link C++ class FixedArrays+;
+#pragma link C++ class std::vector<FixedArrays>+;
+#pragma link C++ class FixedArraysHolder+;
+
+#endif
@@ -226,5 +226,8 @@ TEST(RRawFile, Mmap)
    ASSERT_NE(region, nullptr);
    EXPECT_EQ("oo", std::string(reinterpret_cast<char *>(region) + innerOffset, 2));
    auto mapdLength = 2 + innerOffset;
+   // Only a hint, the content is unchanged
+   f->AdviseMap(region, mapdLength, RRawFile::EMapAdvice::kWillNeed);
+   EXPECT_EQ("oo", std::string(reinterpret_cast<char *>(region) + innerOffset, 2));
    f->Unmap(region, mapdLength);
 }
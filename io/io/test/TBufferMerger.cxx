@@ -5,6 +5,7 @@
 
 #include "TFile.h"
 #include "TROOT.h"
+#include "TBranch.h"
 #include "TTree.h"
 
 #include <atomic>
@@ -12,6 +13,7 @@
 #include <future>
 #include <memory>
 #include <thread>
+#include <vector>
 #include <sys/stat.h>
 
 #include "gtest/gtest.h"
@@ -266,3 +268,99 @@ TEST(TBufferMerger, SetMaxTreeSize)
 
    RemoveFile("tbuffermerger_setmaxtreesize.root");
 }
+
+TEST(TBufferMerger, FastMergeWithBackpressure)
+{
+   int nthreads = 8;
+   int nflushes = 16;
+   int nevents = 1024;
+   const size_t maxBuffered = 64 * 1024;
+
+   ROOT::EnableThreadSafety();
+
+   std::atomic<size_t> maxSeenBuffered{0}, maxSeenQueueSize{0}, maxFileSize{0};
+   std::atomic<Long64_t> writtenBasketBytes{0};
+   std::atomic<int> writtenBaskets{0};
+   auto updateMax = [](std::atomic<size_t> &max, size_t value) {
+      size_t old = max;
+      while (value > old && !max.compare_exchange_weak(old, value))
+         ;
+   };
+
+   {
+      // TBufferMerger always merges with kKeepCompression: the baskets compressed by the writers are copied as they
+      // are, there is no need for SetMergeOptions("fast")
+      TBufferMerger merger("tbuffermerger_fast.root", "RECREATE", 101);
+      merger.SetMaxBuffered(maxBuffered);
+      // only the backpressure triggers the merge of the queue
+      merger.SetAutoSave(1024 * 1024 * 1024);
+      EXPECT_EQ(merger.GetMaxBuffered(), maxBuffered);
+
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger, &maxSeenBuffered, &maxSeenQueueSize, &maxFileSize, &writtenBasketBytes,
+                               &writtenBaskets, &updateMax]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            int n = 0;
+            auto branch = mytree->Branch("n", &n, "n/I");
+            for (int j = 0; j < nflushes; ++j) {
+               for (int k = 0; k < nevents; ++k) {
+                  n = (i * nflushes + j) * nevents + k;
+                  mytree->Fill();
+               }
+               // the baskets compressed by this thread, which the fast merge copies as they are
+               mytree->FlushBaskets();
+               for (int b = 0; b < branch->GetWriteBasket(); ++b)
+                  writtenBasketBytes += branch->GetBasketBytes()[b];
+               writtenBaskets += branch->GetWriteBasket();
+               updateMax(maxFileSize, myfile->GetSize());
+
+               myfile->Write();
+               updateMax(maxSeenBuffered, merger.GetBuffered());
+               updateMax(maxSeenQueueSize, merger.GetQueueSize());
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+   }
+
+   // The queue never holds more than the configured limit, plus the buffer of each writer that pushed beyond it and
+   // waits for the merge. The buffers also contain the keys and the tree header, hence the margin.
+   const size_t maxPushSize = maxFileSize + 16 * 1024;
+   EXPECT_LE(maxSeenBuffered, maxBuffered + nthreads * maxPushSize);
+   EXPECT_LE(maxSeenQueueSize, size_t(nthreads) + maxBuffered / 512);
+
+   {
+      TFile f("tbuffermerger_fast.root");
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_TRUE(t != nullptr);
+
+      const Long64_t nentries = Long64_t(nthreads) * nflushes * nevents;
+      EXPECT_EQ(t->GetEntries(), nentries);
+
+      // the baskets compressed by the writing threads are kept as they are
+      auto branch = t->GetBranch("n");
+      EXPECT_EQ(branch->GetWriteBasket(), writtenBaskets);
+      Long64_t basketBytes = 0;
+      for (int b = 0; b < branch->GetWriteBasket(); ++b)
+         basketBytes += branch->GetBasketBytes()[b];
+      EXPECT_EQ(basketBytes, writtenBasketBytes);
+      EXPECT_LT(t->GetZipBytes(), t->GetTotBytes());
+
+      int n = 0;
+      Long64_t sum = 0;
+      t->SetBranchAddress("n", &n);
+      for (Long64_t i = 0; i < nentries; ++i) {
+         t->GetEntry(i);
+         sum += n;
+      }
+      t->ResetBranchAddresses();
+      EXPECT_EQ(sum, nentries * (nentries - 1) / 2);
+   }
+
+   RemoveFile("tbuffermerger_fast.root");
+}
@@ -68,3 +68,67 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "TTreeCloner.h"
+
+struct IMTRAII {
+   IMTRAII(UInt_t nThreads) { ROOT::EnableImplicitMT(nThreads); }
+   ~IMTRAII() { ROOT::DisableImplicitMT(); }
+};
+
+static void CreateLargeTuple(TMemFile &file, int first)
+{
+   TTree t("t", "A tree with many baskets");
+   t.SetImplicitMT(false);
+   t.SetDirectory(&file);
+   int i = 0;
+   double x = 0.;
+   t.Branch("i", &i, 500);
+   t.Branch("x", &x, 700);
+   for (int e = 0; e < 5000; ++e) {
+      i = first + e;
+      x = 0.5 * i;
+      t.Fill();
+   }
+   file.Write();
+   t.SetDirectory(nullptr);
+}
+
+TEST(TFileMerger, ParallelFastMerge)
+{
+   TMemFile a("pa.root", "RECREATE");
+   CreateLargeTuple(a, 0);
+   TMemFile b("pb.root", "RECREATE");
+   CreateLargeTuple(b, 5000);
+
+   TFileMerger merger;
+   {
+      IMTRAII _(2);
+      ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("poutput.root", "CREATE"))));
+      merger.AddFile(&a, false);
+      merger.AddFile(&b, false);
+      // The output file has the same compression settings as the inputs: the baskets are copied as they are.
+      merger.SetMergeOptions(TString("parallel"));
+      const auto nPipelinedBefore = ROOT::Internal::GetTTreeClonerNPipelinedBaskets();
+      EXPECT_TRUE(merger.PartialMerge());
+      // The baskets of the inputs, of 500 and 700 bytes each, went through the pipelined transfer.
+      EXPECT_GT(ROOT::Internal::GetTTreeClonerNPipelinedBaskets(), nPipelinedBefore + 2 * 20);
+   }
+
+   auto t = merger.GetOutputFile()->Get<TTree>("t");
+   ASSERT_TRUE(t != nullptr);
+   ASSERT_EQ(10000, t->GetEntries());
+   int i = -1;
+   double x = -1.;
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("x", &x);
+   for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+      t->GetEntry(e);
+      EXPECT_EQ(e, i);
+      EXPECT_DOUBLE_EQ(0.5 * e, x);
+   }
+   t->ResetBranchAddresses();
+}
+#endif
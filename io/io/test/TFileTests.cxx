@@ -1,7 +1,18 @@
+#include "TAttLine.h"
+#include "TAttMarker.h"
+#include "TBufferFile.h"
 #include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TStreamerElement.h"
+
+#include "FixedArrays.h"
 
 #include "gtest/gtest.h"
 
+#include <memory>
+#include <vector>
+
 // Tests ROOT-9857
 TEST(TFile, ReadFromSameFile)
 {
@@ -21,4 +32,149 @@ TEST(TFile, ReadFromSameFile)
    auto o2 = f2.Get(objpath);
 
    EXPECT_TRUE(o1 != o2) << "Same objects read from two different files have the same pointer!";
-}
\ No newline at end of file
+}
+
+// Consecutive data members of the same numerical type are streamed as one array
+TEST(TBufferFile, RegroupedMembers)
+{
+   TAttLine line(2, 3, 4);
+   TAttMarker marker(5, 6, 1.5);
+
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteObjectAny(&line, TAttLine::Class());
+   wbuf.WriteObjectAny(&marker, TAttMarker::Class());
+
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   std::unique_ptr<TAttLine> readLine(static_cast<TAttLine *>(rbuf.ReadObjectAny(TAttLine::Class())));
+   std::unique_ptr<TAttMarker> readMarker(static_cast<TAttMarker *>(rbuf.ReadObjectAny(TAttMarker::Class())));
+   EXPECT_EQ(rbuf.Length(), wbuf.Length());
+
+   ASSERT_TRUE(readLine);
+   EXPECT_EQ(readLine->GetLineColor(), 2);
+   EXPECT_EQ(readLine->GetLineStyle(), 3);
+   EXPECT_EQ(readLine->GetLineWidth(), 4);
+   ASSERT_TRUE(readMarker);
+   EXPECT_EQ(readMarker->GetMarkerColor(), 5);
+   EXPECT_EQ(readMarker->GetMarkerStyle(), 6);
+   EXPECT_FLOAT_EQ(readMarker->GetMarkerSize(), 1.5);
+}
+
+// Float16_t and Double32_t arrays are converted in blocks; check all encodings and partial blocks
+TEST(TBufferFile, Double32Arrays)
+{
+   for (Int_t n : {1, 255, 257, 1000}) {
+      std::vector<Double_t> values(n);
+      for (Int_t i = 0; i < n; ++i)
+         values[i] = -100. + 250. * i / n;
+
+      for (const char *title : {"[-100,150,24]", "[0,0,14]", ""}) {
+         TStreamerElement element("x", title, 0, 0, "Double32_t");
+         TBufferFile wbuf(TBuffer::kWrite);
+         wbuf.WriteFastArrayDouble32(values.data(), n, &element);
+         // Values beyond the range are clamped
+         const Double_t outside[2] = {-1000., 1000.};
+         wbuf.WriteFastArrayDouble32(outside, 2, &element);
+
+         TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+         std::vector<Double_t> readback(n);
+         rbuf.ReadFastArrayDouble32(readback.data(), n, &element);
+         Double_t readOutside[2];
+         rbuf.ReadFastArrayDouble32(readOutside, 2, &element);
+         EXPECT_EQ(rbuf.Length(), wbuf.Length());
+         for (Int_t i = 0; i < n; ++i)
+            EXPECT_NEAR(readback[i], values[i], 0.1) << title << ", entry " << i;
+         if (element.GetFactor() != 0) {
+            EXPECT_DOUBLE_EQ(readOutside[0], -100.);
+            EXPECT_NEAR(readOutside[1], 150., 1e-4);
+         }
+      }
+
+      std::vector<Float_t> fvalues(values.begin(), values.end());
+      for (const char *title : {"[-100,150,20]", "[0,0,10]"}) {
+         TStreamerElement element("x", title, 0, 0, "Float16_t");
+         TBufferFile wbuf(TBuffer::kWrite);
+         wbuf.WriteFastArrayFloat16(fvalues.data(), n, &element);
+         TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+         std::vector<Float_t> readback(n);
+         rbuf.ReadFastArrayFloat16(readback.data(), n, &element);
+         for (Int_t i = 0; i < n; ++i)
+            EXPECT_NEAR(readback[i], fvalues[i], 0.2) << title << ", entry " << i;
+      }
+   }
+}
+
+static FixedArrays MakeFixedArrays(int seed)
+{
+   FixedArrays f;
+   for (int i = 0; i < 5; ++i)
+      f.fA[i] = seed * 10 + i;
+   f.fX = seed + 0.25;
+   f.fY = -seed - 0.5;
+   f.fZ = seed * 1e10;
+   f.fS = static_cast<Short_t>(seed % 1000);
+   for (int i = 0; i < 3; ++i)
+      f.fF[i] = seed + i * 0.125f;
+   return f;
+}
+
+static void ExpectEqual(const FixedArrays &expected, const FixedArrays &actual)
+{
+   for (int i = 0; i < 5; ++i)
+      EXPECT_EQ(expected.fA[i], actual.fA[i]);
+   EXPECT_EQ(expected.fX, actual.fX);
+   EXPECT_EQ(expected.fY, actual.fY);
+   EXPECT_EQ(expected.fZ, actual.fZ);
+   EXPECT_EQ(expected.fS, actual.fS);
+   for (int i = 0; i < 3; ++i)
+      EXPECT_EQ(expected.fF[i], actual.fF[i]);
+}
+
+// Fixed size arrays (kOffsetL) and regrouped runs of numerical members, streamed object-wise and, in the unsplit
+// collection, by the member-wise collection loopers
+TEST(TFile, FixedArraysInTree)
+{
+   const auto filename = "FixedArraysInTree.root";
+   const int nEntries = 100;
+   auto makeHolder = [](int entry) {
+      FixedArraysHolder h;
+      h.fSingle = MakeFixedArrays(entry);
+      for (int i = 0; i < entry % 7; ++i)
+         h.fMany.emplace_back(MakeFixedArrays(entry * 100 + i));
+      return h;
+   };
+
+   for (int splitLevel : {0, 99}) {
+      {
+         TFile f(filename, "RECREATE");
+         TTree t("t", "t");
+         auto holder = new FixedArraysHolder();
+         t.Branch("holder", &holder, 32000, splitLevel);
+         for (int entry = 0; entry < nEntries; ++entry) {
+            *holder = makeHolder(entry);
+            t.Fill();
+         }
+         t.Write();
+         t.ResetBranchAddresses();
+         delete holder;
+      }
+
+      TFile f(filename);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      FixedArraysHolder *holder = nullptr;
+      t->SetBranchAddress("holder", &holder);
+      ASSERT_EQ(nEntries, t->GetEntries());
+      for (int entry = 0; entry < nEntries; ++entry) {
+         SCOPED_TRACE(testing::Message() << "split level " << splitLevel << ", entry " << entry);
+         ASSERT_GT(t->GetEntry(entry), 0);
+         const auto expected = makeHolder(entry);
+         ExpectEqual(expected.fSingle, holder->fSingle);
+         ASSERT_EQ(expected.fMany.size(), holder->fMany.size());
+         for (std::size_t i = 0; i < expected.fMany.size(); ++i)
+            ExpectEqual(expected.fMany[i], holder->fMany[i]);
+      }
+      t->ResetBranchAddresses();
+      delete holder;
+   }
+   gSystem->Unlink(filename);
+}
@@ -20,6 +20,7 @@ The prefix can be optionally followed by B whose casing is ignored, eg. 1k, 1K,
 	parser.add_argument("-O", help="Re-optimize basket size when merging TTree")
 	parser.add_argument("-v", help="Explicitly set the verbosity level: 0 request no output, 99 is the default")
 	parser.add_argument("-j", help="Parallelize the execution in multiple processes")
+	parser.add_argument("-mt", help="Use the given number of threads (all the cores if not specified) to read, recompress and write the TTree baskets")
 	parser.add_argument("-dbg", help="Parallelize the execution in multiple processes in debug mode (Does not delete partial files stored inside working directory)")
 	parser.add_argument("-d", help="Carry out the partial multiprocess execution in the specified directory")
 	parser.add_argument("-n", help="Open at most 'maxopenedfiles' at once (use 0 to request to use the system maximum)")
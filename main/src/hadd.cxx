@@ -27,6 +27,7 @@
   \param -O   Re-optimize basket size when merging TTree
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
   \param -j   Parallelise the execution in multiple processes
+  \param -mt  Use `n` threads (all the cores if not specified) to read, recompress and write the TTree baskets
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
@@ -83,6 +84,14 @@
   If the option -cachesize is used, hadd will resize (or disable if 0) the
   prefetching cache use to speed up I/O operations.
 
+  If the option -mt is used, hadd enables implicit multi-threading. In "fast"
+  mode the raw baskets of the next part of an input TTree are read while the
+  current ones are written to the output file; otherwise the baskets of the
+  different branches are unzipped and recompressed concurrently. The content
+  and layout of the output file are the same as without -mt. The option can be
+  combined with -j: each process then starts its own threads, once the worker
+  processes have been forked.
+
   For options that take a size as argument, a decimal number of bytes is expected.
   If the number ends with a `k`, `m`, `g`, etc., the number is multiplied
   by 1000 (1K), 1000000 (1MB), 1000000000 (1G), etc.
@@ -101,6 +110,7 @@
 #include "ROOT/TIOFeatures.hxx"
 #include "TFile.h"
 #include "THashList.h"
+#include "TROOT.h"
 #include "TKey.h"
 #include "TClass.h"
 #include "TSystem.h"
@@ -139,6 +149,8 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Bool_t multithread = kFALSE;
+   UInt_t nThreads = 0;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
@@ -213,6 +225,33 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-mt") == 0) {
+         // If the number of threads is not specified, use all the cores.
+         // The next argument is only taken as the number of threads if it is a number: it can be the target file.
+         Bool_t hasFollowupNumber = a + 1 != argc && argv[a + 1][0] != '\0';
+         if (hasFollowupNumber) {
+            for (char *c = argv[a + 1]; *c != '\0'; ++c) {
+               if (!isdigit(*c)) {
+                  hasFollowupNumber = kFALSE;
+                  break;
+               }
+            }
+         }
+         if (hasFollowupNumber) {
+            Long_t request = strtol(argv[a + 1], 0, 10);
+            if (request < kMaxUInt && request >= 0) {
+               nThreads = (UInt_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the number of threads passed after -mt: " << argv[a + 1]
+                         << ". We will use the default value (number of logical cores).\n";
+               ++a;
+               ++ffirst;
+            }
+         }
+         multithread = kTRUE;
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -363,6 +402,11 @@ int main( int argc, char **argv )
 
    gSystem->Load("libTreePlayer");
 
+#ifndef R__USE_IMT
+   if (multithread)
+      std::cerr << "Warning: ROOT was built without implicit multi-threading support, -mt is ignored." << std::endl;
+#endif
+
    const char *targetname = 0;
    if (outputPlace) {
       targetname = argv[outputPlace];
@@ -453,7 +497,20 @@ int main( int argc, char **argv )
    }
 #endif
 
+   // Implicit multi-threading is enabled by the processes that merge, right before merging: with -j, the worker
+   // processes must be forked before the thread pool is started.
+   auto enableImplicitMT = [&]() {
+#ifdef R__USE_IMT
+      if (multithread && !ROOT::IsImplicitMTEnabled()) {
+         ROOT::EnableImplicitMT(nThreads);
+         if (verbosity > 1)
+            std::cout << "hadd using " << ROOT::GetThreadPoolSize() << " threads per process" << std::endl;
+      }
+#endif
+   };
+
    auto mergeFiles = [&](TFileMerger &merger) {
+      enableImplicitMT();
       if (reoptimize) {
          merger.SetFastMethod(kFALSE);
       } else {
@@ -464,7 +521,10 @@ int main( int argc, char **argv )
          }
       }
       merger.SetNotrees(noTrees);
-      merger.SetMergeOptions(cacheSize);
+      TString mergeOptions(cacheSize);
+      if (multithread)
+         mergeOptions.Append(" parallel");
+      merger.SetMergeOptions(mergeOptions);
       merger.SetIOFeatures(features);
       Bool_t status;
       if (append)
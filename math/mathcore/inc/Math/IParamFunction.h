@@ -127,6 +127,17 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+            Evaluate the function at n points for given parameters p, storing the n values in result.
+            The array x contains the NDim() coordinates of the first point, followed by the ones of the
+            second point, and so on.
+            Use the virtual function DoEvalParN to implement it
+         */
+         void EvalPar(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            DoEvalParN(n, x, p, result);
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -134,6 +145,17 @@ namespace ROOT {
          */
          virtual T DoEvalPar(const T *x, const double *p) const = 0;
 
+         /**
+            Implementation of the evaluation at several points. By default DoEvalPar is called for each point;
+            derived classes can re-implement it for better efficiency
+         */
+         virtual void DoEvalParN(unsigned int n, const T *x, const double *p, T *result) const
+         {
+            const unsigned int ndim = this->NDim();
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = DoEvalPar(x + i * ndim, p);
+         }
+
          /**
             Implement the ROOT::Math::IBaseFunctionMultiDim interface DoEval(x) using the cached parameter values
          */
@@ -215,6 +215,30 @@ namespace ROOT {
 
 
 
+         // number of points for which the model function is evaluated at once (see IModelFunction::EvalPar)
+         // in the sequential evaluation of the chi2 and of the likelihood
+         const unsigned int kEvalBlockSize = 256;
+
+         // return the coordinates of the npoints points starting from point i0, one point after the other
+         // as needed by IModelFunction::EvalPar; multi-dimensional coordinates are copied in the buffer x.
+         // The data type is a template parameter since UnBinData::NDim excludes the weights from the coordinates
+         template <class Data>
+         const double *GetBlockCoordinates(const Data &data, unsigned int i0, unsigned int npoints,
+                                           std::vector<double> &x)
+         {
+            const unsigned int ndim = data.NDim();
+            // the coordinates of one-dimensional points are contiguous
+            if (ndim == 1)
+               return data.GetCoordComponent(i0, 0);
+            x.resize(npoints * ndim);
+            for (unsigned int j = 0; j < ndim; ++j) {
+               const double *xj = data.GetCoordComponent(i0, j);
+               for (unsigned int i = 0; i < npoints; ++i)
+                  x[i * ndim + j] = xj[i];
+            }
+            return x.data();
+         }
+
       } // end namespace  FitUtil
 
 
@@ -275,61 +299,29 @@ namespace ROOT {
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
-   auto mapFunction = [&](const unsigned i){
+   // compute the center of the bin of point i in xc and return the normalized bin volume
+   auto binCenter = [&](const unsigned i, double *xc) {
+      double binVolume = 1.0;
+      for (unsigned int j = 0; j < data.NDim(); ++j) {
+         double xx = *data.GetCoordComponent(i, j);
+         double x2 = data.GetBinUpEdgeComponent(i, j);
+         binVolume *= std::abs(x2 - xx);
+         xc[j] = 0.5*(x2 + xx);
+      }
+      // normalize the bin volume using a reference value
+      return binVolume * wrefVolume;
+   };
+
+   // compute the chi2 contribution of point i, given the function value fval (normalized by the bin volume)
+   auto pointChi2 = [&](const unsigned i, double fval) {
 
       double chi2{};
-      double fval{};
 
-      const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
       auto invError = data.InvError(i);
 
       //invError = (invError!= 0.0) ? 1.0/invError :1;
 
-      const double * x = nullptr;
-      std::vector<double> xc;
-      double binVolume = 1.0;
-      if (useBinVolume) {
-         unsigned int ndim = data.NDim();
-         xc.resize(data.NDim());
-         for (unsigned int j = 0; j < ndim; ++j) {
-            double xx = *data.GetCoordComponent(i, j);
-            double x2 = data.GetBinUpEdgeComponent(i, j);
-            binVolume *= std::abs(x2 - xx);
-            xc[j] = 0.5*(x2 + xx);
-         }
-         x = xc.data();
-         // normalize the bin volume using a reference value
-         binVolume *= wrefVolume;
-      } else if(data.NDim() > 1) {
-         // multi-dim case (no bin volume)
-         xc.resize(data.NDim());
-         xc[0] = *x1;
-         for (unsigned int j = 1; j < data.NDim(); ++j)
-            xc[j] = *data.GetCoordComponent(i, j);
-         x = xc.data();
-      } else {
-            x = x1;
-      }
-
-
-      if (!useBinIntegral) {
-#ifdef USE_PARAMCACHE
-         fval = func ( x );
-#else
-         fval = func ( x, p );
-#endif
-      }
-      else {
-         // calculate integral normalized by bin volume
-         // need to set function and parameters here in case loop is parallelized
-         std::vector<double> x2(data.NDim());
-         data.GetBinUpEdgeCoordinates(i, x2.data());
-         fval = igEval(x, x2.data());
-      }
-      // normalize result if requested according to bin volume
-      if (useBinVolume) fval *= binVolume;
-
       // expected errors
       if (useExpErrors) {
          double invWeight  = 1.0;
@@ -352,10 +344,10 @@ namespace ROOT {
 
 //#define DEBUG
 #ifdef DEBUG
-      std::cout << x[0] << "  " << y << "  " << 1./invError << " params : ";
+      std::cout << *data.GetCoordComponent(i, 0) << "  " << y << "  " << 1./invError << " params : ";
       for (unsigned int ipar = 0; ipar < func.NPar(); ++ipar)
          std::cout << p[ipar] << "\t";
-      std::cout << "\tfval = " << fval << " bin volume " << binVolume << " ref " << wrefVolume << std::endl;
+      std::cout << "\tfval = " << fval << " ref " << wrefVolume << std::endl;
 #endif
 //#undef DEBUG
 
@@ -374,6 +366,51 @@ namespace ROOT {
          }
       }
       return chi2;
+   };
+
+   auto mapFunction = [&](const unsigned i){
+
+      double fval{};
+
+      const auto x1 = data.GetCoordComponent(i, 0);
+
+      const double * x = nullptr;
+      std::vector<double> xc;
+      double binVolume = 1.0;
+      if (useBinVolume) {
+         xc.resize(data.NDim());
+         binVolume = binCenter(i, xc.data());
+         x = xc.data();
+      } else if(data.NDim() > 1) {
+         // multi-dim case (no bin volume)
+         xc.resize(data.NDim());
+         xc[0] = *x1;
+         for (unsigned int j = 1; j < data.NDim(); ++j)
+            xc[j] = *data.GetCoordComponent(i, j);
+         x = xc.data();
+      } else {
+            x = x1;
+      }
+
+
+      if (!useBinIntegral) {
+#ifdef USE_PARAMCACHE
+         fval = func ( x );
+#else
+         fval = func ( x, p );
+#endif
+      }
+      else {
+         // calculate integral normalized by bin volume
+         // need to set function and parameters here in case loop is parallelized
+         std::vector<double> x2(data.NDim());
+         data.GetBinUpEdgeCoordinates(i, x2.data());
+         fval = igEval(x, x2.data());
+      }
+      // normalize result if requested according to bin volume
+      if (useBinVolume) fval *= binVolume;
+
+      return pointChi2(i, fval);
   };
 
 #ifdef R__USE_IMT
@@ -392,7 +429,26 @@ namespace ROOT {
 #endif
 
   double res{};
-  if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
+  if(executionPolicy == ROOT::EExecutionPolicy::kSequential && !useBinIntegral){
+    // evaluate the function on blocks of points at once, which is faster than point by point
+    const unsigned int ndim = data.NDim();
+    std::vector<double> xc, fval(kEvalBlockSize), binVolume(kEvalBlockSize, 1.0);
+    for (unsigned int i0 = 0; i0 < n; i0 += kEvalBlockSize) {
+      const unsigned int npoints = std::min(kEvalBlockSize, n - i0);
+      const double *x = nullptr;
+      if (useBinVolume) {
+        xc.resize(npoints * ndim);
+        for (unsigned int i = 0; i < npoints; ++i)
+          binVolume[i] = binCenter(i0 + i, &xc[i * ndim]);
+        x = xc.data();
+      } else {
+        x = GetBlockCoordinates(data, i0, npoints, xc);
+      }
+      func.EvalPar(npoints, x, p, fval.data());
+      for (unsigned int i = 0; i < npoints; ++i)
+        res += pointChi2(i0 + i, fval[i] * binVolume[i]);
+    }
+  } else if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
     for (unsigned int i=0; i<n; ++i) {
       res += mapFunction(i);
     }
@@ -972,9 +1028,32 @@ double FitUtil::EvaluateLogL(const IModelFunctionTempl<double> &func, const UnBi
 
          // needed to compue effective global weight in case of extended likelihood
 
-         auto mapFunction = [&](const unsigned i) {
+         // compute the contribution of point i to the log-likelihood, given the function value fval
+         auto pointLogL = [&](const unsigned i, double fval) {
             double W = 0;
             double W2 = 0;
+
+            if (normalizeFunc)
+               fval = fval * (1 / norm);
+
+            // function EvalLog protects against negative or too small values of fval
+            double logval = ROOT::Math::Util::EvalLog(fval);
+            if (iWeight > 0) {
+               double weight = data.Weight(i);
+               logval *= weight;
+               if (iWeight == 2) {
+                  logval *= weight; // use square of weights in likelihood
+                  if (!extended) {
+                     // needed sum of weights and sum of weight square if likelkihood is extended
+                     W = weight;
+                     W2 = weight * weight;
+                  }
+               }
+            }
+            return LikelihoodAux<double>(logval, W, W2);
+         };
+
+         auto mapFunction = [&](const unsigned i) {
             double fval = 0;
 
             if (data.NDim() > 1) {
@@ -997,24 +1076,7 @@ double FitUtil::EvaluateLogL(const IModelFunctionTempl<double> &func, const UnBi
 #endif
             }
 
-            if (normalizeFunc)
-               fval = fval * (1 / norm);
-
-            // function EvalLog protects against negative or too small values of fval
-            double logval = ROOT::Math::Util::EvalLog(fval);
-            if (iWeight > 0) {
-               double weight = data.Weight(i);
-               logval *= weight;
-               if (iWeight == 2) {
-                  logval *= weight; // use square of weights in likelihood
-                  if (!extended) {
-                     // needed sum of weights and sum of weight square if likelkihood is extended
-                     W = weight;
-                     W2 = weight * weight;
-                  }
-               }
-            }
-            return LikelihoodAux<double>(logval, W, W2);
+            return pointLogL(i, fval);
          };
 
 #ifdef R__USE_IMT
@@ -1047,11 +1109,17 @@ double FitUtil::EvaluateLogL(const IModelFunctionTempl<double> &func, const UnBi
   double sumW{};
   double sumW2{};
   if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
-    for (unsigned int i=0; i<n; ++i) {
-      auto resArray = mapFunction(i);
-      logl+=resArray.logvalue;
-      sumW+=resArray.weight;
-      sumW2+=resArray.weight2;
+    // evaluate the function on blocks of points at once, which is faster than point by point
+    std::vector<double> xc, fval(kEvalBlockSize);
+    for (unsigned int i0 = 0; i0 < n; i0 += kEvalBlockSize) {
+      const unsigned int npoints = std::min(kEvalBlockSize, n - i0);
+      func.EvalPar(npoints, GetBlockCoordinates(data, i0, npoints, xc), p, fval.data());
+      for (unsigned int i = 0; i < npoints; ++i) {
+        auto resArray = pointLogL(i0 + i, fval[i]);
+        logl+=resArray.logvalue;
+        sumW+=resArray.weight;
+        sumW2+=resArray.weight2;
+      }
     }
 #ifdef R__USE_IMT
   } else if(executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
@@ -0,0 +1,146 @@
+// @(#)root/test:$Id$
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "snprintf.h"
+#include "TBufferFile.h"
+#include "TStopwatch.h"
+#include "TStreamerElement.h"
+#include "TRandom.h"
+//
+// This program benchmarks the streaming of arrays of basic types with TBufferFile:
+// ReadFastArray/WriteFastArray of Short_t, Int_t, Float_t and Double_t arrays
+// (byte swap on little endian machines) and of Float16_t/Double32_t arrays, with
+// a range (scaled integers), with a number of bits (truncated mantissa) and as floats.
+//
+// Usage: tbufferbm -h                 - to print a usage info
+//        tbufferbm [nvalues] [ntimes] - to run the benchmark
+//
+// parameters:
+//       nvalues       - number of values in the streamed arrays
+//       ntimes        - number of times each array is written and read
+//
+
+int nvalues = 4096;   // Number of values in the arrays.
+int ntimes  = 10000;  // Number of times each array is written and read.
+
+//_____________________________________________________________
+
+void PrintResult(const char *name, TStopwatch &wtimer, TStopwatch &rtimer, Int_t nbytes)
+{
+   const Double_t mbytes = Double_t(nbytes) * ntimes / 1e6;
+   char line[128];
+   snprintf(line, 128, "%-28s %10.1f MB/s %10.1f MB/s", name,
+            mbytes / (wtimer.RealTime() > 0 ? wtimer.RealTime() : 1e-9),
+            mbytes / (rtimer.RealTime() > 0 ? rtimer.RealTime() : 1e-9));
+   std::cout << line << std::endl;
+}
+
+template <typename T>
+void BenchBasic(const char *name)
+{
+   std::vector<T> values(nvalues), readback(nvalues);
+   for (auto &v : values)
+      v = T(gRandom->Uniform(-1000, 1000));
+
+   TBufferFile buf(TBuffer::kWrite, nvalues * sizeof(T) + 64);
+   TStopwatch wtimer, rtimer;
+   wtimer.Reset();
+   rtimer.Reset();
+   for (int i = 0; i < ntimes; ++i) {
+      wtimer.Start(kFALSE);
+      buf.SetWriteMode();
+      buf.SetBufferOffset(0);
+      buf.WriteFastArray(values.data(), nvalues);
+      wtimer.Stop();
+      rtimer.Start(kFALSE);
+      buf.SetReadMode();
+      buf.SetBufferOffset(0);
+      buf.ReadFastArray(readback.data(), nvalues);
+      rtimer.Stop();
+   }
+   if (readback != values)
+      std::cout << name << ": values read back differ!" << std::endl;
+   PrintResult(name, wtimer, rtimer, nvalues * sizeof(T));
+}
+
+void WritePacked(TBufferFile &buf, const Float_t *values, TStreamerElement *element)
+{
+   buf.WriteFastArrayFloat16(values, nvalues, element);
+}
+
+void WritePacked(TBufferFile &buf, const Double_t *values, TStreamerElement *element)
+{
+   buf.WriteFastArrayDouble32(values, nvalues, element);
+}
+
+void ReadPacked(TBufferFile &buf, Float_t *values, TStreamerElement *element)
+{
+   buf.ReadFastArrayFloat16(values, nvalues, element);
+}
+
+void ReadPacked(TBufferFile &buf, Double_t *values, TStreamerElement *element)
+{
+   buf.ReadFastArrayDouble32(values, nvalues, element);
+}
+
+template <typename T>
+void BenchPacked(const char *name, const char *title)
+{
+   std::vector<T> values(nvalues), readback(nvalues);
+   for (auto &v : values)
+      v = T(gRandom->Uniform(-1000, 1000));
+
+   // The range or number of bits is parsed from the title, as for a data member comment
+   TStreamerElement element("x", title, 0, 0, sizeof(T) == sizeof(Float_t) ? "Float16_t" : "Double32_t");
+
+   TBufferFile buf(TBuffer::kWrite, nvalues * sizeof(T) + 64);
+   TStopwatch wtimer, rtimer;
+   wtimer.Reset();
+   rtimer.Reset();
+   Int_t nbytes = 0;
+   for (int i = 0; i < ntimes; ++i) {
+      wtimer.Start(kFALSE);
+      buf.SetWriteMode();
+      buf.SetBufferOffset(0);
+      WritePacked(buf, values.data(), &element);
+      wtimer.Stop();
+      nbytes = buf.Length();
+      rtimer.Start(kFALSE);
+      buf.SetReadMode();
+      buf.SetBufferOffset(0);
+      ReadPacked(buf, readback.data(), &element);
+      rtimer.Stop();
+   }
+   PrintResult(name, wtimer, rtimer, nbytes);
+}
+
+int main(int argc, char **argv)
+{
+   if (argc > 1 && argv[1][0] == '-') {
+      std::cout << "Usage: tbufferbm [nvalues] [ntimes]" << std::endl;
+      return 0;
+   }
+   if (argc > 1)
+      nvalues = atoi(argv[1]);
+   if (argc > 2)
+      ntimes = atoi(argv[2]);
+   if (nvalues <= 0 || ntimes <= 0) {
+      std::cout << "nvalues and ntimes must be positive" << std::endl;
+      return 1;
+   }
+
+   std::cout << "Streaming arrays of " << nvalues << " values " << ntimes << " times" << std::endl;
+   std::cout << "                                  write           read" << std::endl;
+   BenchBasic<Short_t>("Short_t");
+   BenchBasic<Int_t>("Int_t");
+   BenchBasic<Float_t>("Float_t");
+   BenchBasic<Double_t>("Double_t");
+   BenchPacked<Float_t>("Float16_t [-1000,1000,20]", "[-1000,1000,20]");
+   BenchPacked<Float_t>("Float16_t [0,0,14]", "[0,0,14]");
+   BenchPacked<Double_t>("Double32_t [-1000,1000,24]", "[-1000,1000,24]");
+   BenchPacked<Double_t>("Double32_t [0,0,14]", "[0,0,14]");
+   BenchPacked<Double_t>("Double32_t (as float)", "");
+   return 0;
+}
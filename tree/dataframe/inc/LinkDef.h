@@ -27,6 +27,7 @@
 #pragma link C++ class ROOT::Detail::RDF::RJittedFilter-;
 #pragma link C++ class ROOT::Detail::RDF::RDefineBase-;
 #pragma link C++ class ROOT::Detail::RDF::RJittedDefine-;
+#pragma link C++ class ROOT::Internal::RDF::RVariationBase-;
 #pragma link C++ class ROOT::Internal::RDF::CountHelper-;
 #pragma link C++ class ROOT::Detail::RDF::RRangeBase-;
 #pragma link C++ class ROOT::Detail::RDF::RLoopManager-;
@@ -44,11 +44,14 @@
 #include "ROOT/RDF/RMergeableValue.hxx"
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <typeinfo>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -58,6 +61,8 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+class RDataFrame;
+
 namespace Detail {
 namespace RDF {
 template <typename Helper>
@@ -187,6 +192,12 @@ public:
    ULong64_t &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Count"; }
+
+   CountHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ULong64_t> *>(newResult);
+      return CountHelper(result, fCounts.size());
+   }
 };
 
 template <typename ProxiedVal_t>
@@ -305,6 +316,13 @@ public:
    }
 
    std::string GetActionName() { return "Fill"; }
+
+   FillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<Hist_t> *>(newResult);
+      result->SetDirectory(nullptr);
+      return FillHelper(result, fNSlots);
+   }
 };
 
 extern template void FillHelper::Exec(unsigned int, const std::vector<float> &);
@@ -329,6 +347,47 @@ class FillParHelper : public RActionImpl<FillParHelper<HIST>> {
 
    void UnsetDirectoryIfPossible(...) {}
 
+   // Fill with the values of a collection one by one
+   template <typename H, typename X0>
+   static void FillCollection(H *h, const X0 &x0s, double /*toloweroverloadpriority*/)
+   {
+      for (auto x0 = x0s.begin(); x0 != x0s.end(); x0++) {
+         h->Fill(*x0);
+      }
+   }
+
+   // A TH1D is filled with all the values of a contiguous collection of doubles at once, see TH1::FillN
+   template <typename H, typename X0,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_same<typename X0::value_type, double>::value,
+                              int> = 0>
+   static auto FillCollection(H *h, const X0 &x0s, int /*toincreaseoverloadpriority*/) -> decltype(x0s.data(), void())
+   {
+      h->FillN(x0s.size(), x0s.data(), nullptr);
+   }
+
+   // Fill with the pairs of values of two collections one by one (x and weight in 1D, x and y in 2D)
+   template <typename H, typename X0, typename W>
+   static void FillCollection(H *h, const X0 &x0s, const W &ws, double /*toloweroverloadpriority*/)
+   {
+      auto x0sIt = std::begin(x0s);
+      const auto x0sEnd = std::end(x0s);
+      auto wsIt = std::begin(ws);
+      for (; x0sIt != x0sEnd; x0sIt++, wsIt++) {
+         h->Fill(*x0sIt, *wsIt);
+      }
+   }
+
+   // A TH1D is filled with all the values and weights of two contiguous collections of doubles at once
+   template <typename H, typename X0, typename W,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_same<typename X0::value_type, double>::value &&
+                                 std::is_same<typename W::value_type, double>::value,
+                              int> = 0>
+   static auto FillCollection(H *h, const X0 &x0s, const W &ws, int /*toincreaseoverloadpriority*/)
+      -> decltype(x0s.data(), ws.data(), void())
+   {
+      h->FillN(x0s.size(), x0s.data(), ws.data());
+   }
+
    // Merge overload for types with Merge(TCollection*), like TH1s
    template <typename H, typename = std::enable_if_t<std::is_base_of<TObject, H>::value, int>>
    auto Merge(std::vector<H *> &objs, int /*toincreaseoverloadpriority*/)
@@ -395,10 +454,7 @@ public:
    template <typename X0, std::enable_if_t<IsDataContainer<X0>::value || std::is_same<X0, std::string>::value, int> = 0>
    void Exec(unsigned int slot, const X0 &x0s)
    {
-      auto thisSlotH = fObjects[slot];
-      for (auto x0 = x0s.begin(); x0 != x0s.end(); x0++) {
-         thisSlotH->Fill(*x0); // TODO: Can be optimised in case T == vector<double>
-      }
+      FillCollection(fObjects[slot], x0s, 0);
    }
 
    // ROOT-10092: Filling with a scalar as first column and a collection as second is not supported
@@ -418,12 +474,7 @@ public:
       if (x0s.size() != x1s.size()) {
          throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
       }
-      auto x0sIt = std::begin(x0s);
-      const auto x0sEnd = std::end(x0s);
-      auto x1sIt = std::begin(x1s);
-      for (; x0sIt != x0sEnd; x0sIt++, x1sIt++) {
-         thisSlotH->Fill(*x0sIt, *x1sIt); // TODO: Can be optimised in case T == vector<double>
-      }
+      FillCollection(thisSlotH, x0s, x1s, 0);
    }
 
    template <typename X0, typename W,
@@ -533,6 +584,13 @@ public:
    }
 
    std::string GetActionName() { return "FillPar"; }
+
+   FillParHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      UnsetDirectoryIfPossible(result.get());
+      return FillParHelper(result, fObjects.size());
+   }
 };
 
 class FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
@@ -859,6 +917,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fMins[slot]; }
 
    std::string GetActionName() { return "Min"; }
+
+   MinHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MinHelper(result, fMins.size());
+   }
 };
 
 // TODO
@@ -910,6 +974,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fMaxs[slot]; }
 
    std::string GetActionName() { return "Max"; }
+
+   MaxHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MaxHelper(result, fMaxs.size());
+   }
 };
 
 // TODO
@@ -974,6 +1044,12 @@ public:
    ResultType &PartialUpdate(unsigned int slot) { return fSums[slot]; }
 
    std::string GetActionName() { return "Sum"; }
+
+   SumHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return SumHelper(result, fSums.size());
+   }
 };
 
 class MeanHelper : public RActionImpl<MeanHelper> {
@@ -1012,6 +1088,12 @@ public:
    double &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Mean"; }
+
+   MeanHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<double> *>(newResult);
+      return MeanHelper(result, fSums.size());
+   }
 };
 
 extern template void MeanHelper::Exec(unsigned int, const std::vector<float> &);
@@ -1060,6 +1142,12 @@ public:
    }
 
    std::string GetActionName() { return "StdDev"; }
+
+   StdDevHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<double> *>(newResult);
+      return StdDevHelper(result, fNSlots);
+   }
 };
 
 extern template void StdDevHelper::Exec(unsigned int, const std::vector<float> &);
@@ -1634,6 +1722,112 @@ public:
    }
 };
 
+/// Writes RDataFrame columns into an RNTuple, without exposing RNTuple types to this header.
+/// Each processing slot fills its own clusters through its own RNTupleWriter: the pages of a cluster are compressed by
+/// the thread that fills it and only the commit of complete clusters to the output file is serialized.
+/// Implemented in RDFSnapshotRNTuple.cxx; throws at construction if ROOT was built without RNTuple support.
+class RNTupleSnapshotWriter {
+   struct RImpl;
+   std::unique_ptr<RImpl> fImpl;
+
+public:
+   RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName, const std::string &dirName,
+                         const std::string &ntupleName, const ColumnNames_t &outputColNames,
+                         const std::vector<std::string> &colTypeNames, const RSnapshotOptions &options);
+   RNTupleSnapshotWriter(const RNTupleSnapshotWriter &) = delete;
+   RNTupleSnapshotWriter &operator=(const RNTupleSnapshotWriter &) = delete;
+   ~RNTupleSnapshotWriter();
+
+   /// Create the output file and one writer per slot
+   void Initialize();
+   /// Append one entry to the clusters of `slot`; `valuePtrs` holds the addresses of the values of all output columns,
+   /// as returned by RNTupleSnapshotValue::GetAddress
+   void Fill(unsigned int slot, void *const *valuePtrs);
+   /// Commit the last clusters of all slots and the ntuple meta-data, close the file
+   void Finalize();
+};
+
+/// Create the RDataFrame returned by a Snapshot to an RNTuple. Its data source already provides the columns written by
+/// the Snapshot, `colTypeNames` being the types of the input columns, and opens the RNTuple at its first event loop.
+/// Implemented in RDFSnapshotRNTuple.cxx; throws if ROOT was built without RNTuple support.
+std::shared_ptr<ROOT::RDataFrame>
+MakeRNTupleSnapshotDataFrame(const std::string &ntupleName, const std::string &fileName,
+                             const ColumnNames_t &outputColNames, const std::vector<std::string> &colTypeNames);
+
+/// Provides the address of the value that an RNTuple Snapshot writes for a column value of type T.
+/// RVec columns are written as std::vector fields, whose in-memory layout differs from the one of RVec: their
+/// elements are copied into a per-slot std::vector before each Fill.
+template <typename T>
+struct RNTupleSnapshotValue {
+   struct Buffer_t {
+   };
+   static void *GetAddress(T &value, Buffer_t &) { return &value; }
+};
+
+template <typename T>
+struct RNTupleSnapshotValue<ROOT::VecOps::RVec<T>> {
+   using Buffer_t = std::vector<T>;
+   static void *GetAddress(ROOT::VecOps::RVec<T> &value, Buffer_t &buffer)
+   {
+      buffer.assign(value.begin(), value.end());
+      return &buffer;
+   }
+};
+
+/// RVec<bool> is written with its own RNTuple field
+template <>
+struct RNTupleSnapshotValue<ROOT::VecOps::RVec<bool>> {
+   struct Buffer_t {
+   };
+   static void *GetAddress(ROOT::VecOps::RVec<bool> &value, Buffer_t &) { return &value; }
+};
+
+/// Helper object for a Snapshot action that writes an RNTuple, both in single-thread and multi-thread event loops
+template <typename... ColTypes>
+class SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   using Buffers_t = std::tuple<typename RNTupleSnapshotValue<ColTypes>::Buffer_t...>;
+
+   std::unique_ptr<RNTupleSnapshotWriter> fWriter; // must be a ptr because the writer is not movable
+   std::vector<std::array<void *, sizeof...(ColTypes)>> fValuePtrs; // per-slot addresses of the values to write
+   std::vector<Buffers_t> fBuffers; // per-slot copies of the values that are not written from the column values
+
+   template <std::size_t... S>
+   void ExecImpl(unsigned int slot, std::index_sequence<S...>, ColTypes &... values)
+   {
+      auto &buffers = fBuffers[slot];
+      auto &valuePtrs = fValuePtrs[slot];
+      valuePtrs = {{RNTupleSnapshotValue<ColTypes>::GetAddress(values, std::get<S>(buffers))...}};
+      (void)buffers; // avoid unused variable warnings when there are no columns
+      fWriter->Fill(slot, valuePtrs.data());
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options)
+      : fWriter(std::make_unique<RNTupleSnapshotWriter>(
+           nSlots, std::string(filename), std::string(dirname), std::string(ntuplename),
+           ReplaceDotWithUnderscore(bnames), std::vector<std::string>{TypeID2TypeName(typeid(ColTypes))...}, options)),
+        fValuePtrs(nSlots), fBuffers(nSlots)
+   {
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      ExecImpl(slot, std::index_sequence_for<ColTypes...>(), values...);
+   }
+
+   void Initialize() { fWriter->Initialize(); }
+
+   void Finalize() { fWriter->Finalize(); }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class AggregateHelper : public RActionImpl<AggregateHelper<Acc, Merge, R, T, U, MustCopyAssign>> {
@@ -16,6 +16,8 @@
 #include "RDefineReader.hxx"
 #include "RDSColumnReader.hxx"
 #include "RTreeColumnReader.hxx"
+#include "RVariationBase.hxx"
+#include "RVariationReader.hxx"
 
 #include <ROOT/RDataSource.hxx>
 #include <ROOT/TypeTraits.hxx>
@@ -65,14 +67,29 @@ MakeColumnReader(unsigned int slot, RDFDetail::RDefineBase *define, TTreeReader
 
 template <typename T>
 std::unique_ptr<RDFDetail::RColumnReaderBase>
-MakeColumnReadersHelper(unsigned int slot, RDFDetail::RDefineBase *define,
+MakeColumnReadersHelper(unsigned int slot, RDFDetail::RDefineBase *define, RVariationBase *variation,
                         const std::map<std::string, std::vector<void *>> &DSValuePtrsMap, TTreeReader *r,
                         ROOT::RDF::RDataSource *ds, const std::string &colName)
 {
    const auto DSValuePtrsIt = DSValuePtrsMap.find(colName);
    const std::vector<void *> *DSValuePtrsPtr = DSValuePtrsIt != DSValuePtrsMap.end() ? &DSValuePtrsIt->second : nullptr;
    R__ASSERT(define != nullptr || r != nullptr || DSValuePtrsPtr != nullptr || ds != nullptr);
-   return MakeColumnReader<T>(slot, define, r, ds, DSValuePtrsPtr, colName);
+   auto reader = MakeColumnReader<T>(slot, define, r, ds, DSValuePtrsPtr, colName);
+
+   // columns with systematic variations switch between the nominal and the varied values
+   if (variation != nullptr)
+      return std::unique_ptr<RDFDetail::RColumnReaderBase>(
+         new RVariationReader<T>(slot, *variation, std::move(reader)));
+
+   return reader;
+}
+
+/// Return the systematic variations of the given column, or a null pointer if the column is not varied.
+inline RVariationBase *GetVariation(const RBookedDefines &defines, const std::string &colName)
+{
+   const auto &variations = defines.GetVariations();
+   const auto it = variations.find(colName);
+   return it != variations.end() ? it->second.get() : nullptr;
 }
 
 /// This type aggregates some of the arguments passed to InitColumnReaders.
@@ -106,7 +123,8 @@ MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, cons
    int i = -1;
    std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, sizeof...(ColTypes)> ret{
       {{(++i, MakeColumnReadersHelper<ColTypes>(slot, isDefine[i] ? customColMap.at(colNames[i]).get() : nullptr,
-                                                DSValuePtrsMap, r, ds, colNames[i]))}...}};
+                                                GetVariation(customCols, colNames[i]), DSValuePtrsMap, r, ds,
+                                                colNames[i]))}...}};
    return ret;
 
    // avoid bogus "unused variable" warnings
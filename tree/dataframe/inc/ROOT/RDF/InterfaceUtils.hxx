@@ -249,7 +249,13 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    const auto &options = snapHelperArgs->fOptions;
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // RNTuple snapshot, the same helper takes care of single-thread and multi-thread event loops
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(
+         new Action_t(Helper_t(nSlots, filename, dirname, treename, outputColNames, options), colNames, prevNode, defines));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -316,6 +322,8 @@ std::string JitBuildAction(const ColumnNames_t &bl, std::shared_ptr<RDFDetail::R
                            const unsigned int nSlots, const RBookedDefines &defines,
                            RDataSource *ds, std::weak_ptr<RJittedAction> *jittedActionOnHeap);
 
+void PopulateJitCache();
+
 // Allocate a weak_ptr on the heap, return a pointer to it. The user is responsible for deleting this weak_ptr.
 // This function is meant to be used by RInterface's methods that book code for jitting.
 // The problem it solves is that we generate code to be lazily jitted with the addresses of certain objects in them,
@@ -17,6 +17,7 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariedAction.hxx"
 
 #include <array>
 #include <cstddef> // std::size_t
@@ -93,6 +94,8 @@ public:
    {
       for (auto &bookedBranch : GetDefines().GetColumns())
          bookedBranch.second->InitSlot(r, slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->InitSlot(r, slot);
       RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
                                            fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
@@ -120,6 +123,8 @@ public:
    {
       for (auto &column : GetDefines().GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->FinaliseSlot(slot);
       for (auto &v : fValues[slot])
          v.reset();
       fHelper.CallFinalizeTask(slot);
@@ -153,7 +158,45 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   std::vector<std::string> GetVariationNames() final { return ComputeVariationDeps().GetVariationNames(); }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final
+   {
+      return MakeVariedActionImpl(results, 0);
+   }
+
 private:
+   /// The systematic variations that affect this action, through its input columns or the upstream filters.
+   RVariationDeps ComputeVariationDeps()
+   {
+      fPrevData.UpdateVariationDeps();
+      auto deps = RDFInternal::GetVariationDeps(GetColumnNames(), GetDefines());
+      deps.Add(fPrevData.GetVariationDeps());
+      return deps;
+   }
+
+   // this overload is SFINAE'd out if Helper does not implement `MakeNew`
+   // the template parameter is required to defer instantiation of the method to SFINAE time
+   template <typename H = Helper>
+   auto MakeVariedActionImpl(const std::vector<void *> &results, int)
+      -> decltype(std::declval<H>().MakeNew((void *)nullptr), std::unique_ptr<RActionBase>{})
+   {
+      std::vector<Helper> helpers;
+      helpers.reserve(results.size());
+      for (auto *r : results)
+         helpers.emplace_back(fHelper.MakeNew(r));
+      auto variationIds = ComputeVariationDeps().GetVariationIds();
+      using VariedAction_t = RVariedAction<Helper, PrevDataFrame, ColumnTypes_t>;
+      return std::unique_ptr<RActionBase>(new VariedAction_t(std::move(helpers), std::move(variationIds),
+                                                             GetColumnNames(), fPrevDataPtr, GetDefines()));
+   }
+
+   // this one is always available but has lower precedence because the `0` argument requires a conversion to long
+   std::unique_ptr<RActionBase> MakeVariedActionImpl(const std::vector<void *> &, long)
+   {
+      throw std::logic_error("This action does not support systematic variations.");
+   }
+
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
    // the template parameter is required to defer instantiation of the method to SFINAE time
    template <typename H = Helper>
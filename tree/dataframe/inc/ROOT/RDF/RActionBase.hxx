@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -82,6 +83,14 @@ public:
    virtual std::unique_ptr<RMergeableValueBase> GetMergeableValue() const = 0;
 
    virtual std::function<void(unsigned int)> GetDataBlockCallback() = 0;
+
+   /// Return the names of the systematic variations that affect the result of this action, in the form
+   /// "variation:tag". Must be called after jitting.
+   virtual std::vector<std::string> GetVariationNames() = 0;
+
+   /// Create an action that fills one result per systematic variation, in the order of GetVariationNames.
+   /// The elements of `results` are type-erased pointers to the `std::shared_ptr`s of the varied results.
+   virtual std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) = 0;
 };
 } // namespace RDF
 } // namespace Internal
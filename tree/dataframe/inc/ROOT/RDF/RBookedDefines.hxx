@@ -28,6 +28,8 @@ class RDefineBase;
 namespace Internal {
 namespace RDF {
 
+class RVariationBase;
+
 namespace RDFDetail = ROOT::Detail::RDF;
 
 /**
@@ -38,15 +40,19 @@ namespace RDFDetail = ROOT::Detail::RDF;
 
 class RBookedDefines {
    using RDefineBasePtrMap_t = std::map<std::string, std::shared_ptr<RDFDetail::RDefineBase>>;
+   using RVariationBasePtrMap_t = std::map<std::string, std::shared_ptr<RVariationBase>>;
    using ColumnNames_t = std::vector<std::string>;
 
    // Since RBookedDefines is meant to be an immutable, copy-on-write object, the actual values are set as const
    using RDefineBasePtrMapPtr_t = std::shared_ptr<const RDefineBasePtrMap_t>;
+   using RVariationBasePtrMapPtr_t = std::shared_ptr<const RVariationBasePtrMap_t>;
    using ColumnNamesPtr_t = std::shared_ptr<const ColumnNames_t>;
 
 private:
    RDefineBasePtrMapPtr_t fDefines;
    ColumnNamesPtr_t fDefinesNames;  // also abused to keep track of aliases for each branch of the computation graph
+   /// Systematic variations booked in this branch of the computation graph, indexed by the name of the varied column
+   RVariationBasePtrMapPtr_t fVariations = std::make_shared<RVariationBasePtrMap_t>();
 
 public:
    ////////////////////////////////////////////////////////////////////////////
@@ -84,6 +90,10 @@ public:
    /// \brief Returns the list of the pointers to the defined columns
    const RDefineBasePtrMap_t &GetColumns() const { return *fDefines; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the systematic variations, indexed by the name of the varied column
+   const RVariationBasePtrMap_t &GetVariations() const { return *fVariations; }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Check if the provided name is tracked in the names list
    bool HasName(std::string_view name) const;
@@ -91,6 +101,7 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Add a new booked column.
    /// Internally it recreates the map with the new column, and swaps it with the old one.
+   /// Variations of a column with the same name, if any, are dropped: they refer to the column being redefined.
    void AddColumn(const std::shared_ptr<RDFDetail::RDefineBase> &column, std::string_view name);
 
    ////////////////////////////////////////////////////////////////////////////
@@ -100,6 +111,11 @@ public:
    /// in each branch of the computation graph.
    /// Internally it recreates the vector with the new name, and swaps it with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Add the systematic variations of an existing column.
+   /// Internally it recreates the map with the new variation, and swaps it with the old one.
+   void AddVariation(const std::shared_ptr<RVariationBase> &variation);
 };
 
 } // Namespace RDF
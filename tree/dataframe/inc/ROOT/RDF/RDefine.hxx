@@ -62,6 +62,8 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    F fExpression;
    const ColumnNames_t fColumnNames;
    ValuesPerSlot_t fLastResults;
+   /// Per slot, the cached values of the systematic variations this custom column depends on.
+   std::vector<ValuesPerSlot_t> fVariedResults;
 
    /// Column readers per slot and per input column
    std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
@@ -70,31 +72,30 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
+   void UpdateHelper(unsigned int slot, Long64_t entry, ret_type &result, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      result = fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
       // silence "unused parameter" warnings in gcc
       (void)slot;
       (void)entry;
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
+   void UpdateHelper(unsigned int slot, Long64_t entry, ret_type &result, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      result = fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
       // silence "unused parameter" warnings in gcc
       (void)slot;
       (void)entry;
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void
-   UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
+   void UpdateHelper(unsigned int slot, Long64_t entry, ret_type &result, TypeList<ColTypes...>,
+                     std::index_sequence<S...>, SlotAndEntryTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      result = fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
       // silence "unused parameter" warnings in gcc
       (void)slot;
       (void)entry;
@@ -105,8 +106,8 @@ public:
            unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
            const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
       : RDefineBase(name, type, nSlots, defines, DSValuePtrs, ds), fExpression(std::move(expression)),
-        fColumnNames(columns), fLastResults(fNSlots * RDFInternal::CacheLineStep<ret_type>()), fValues(fNSlots),
-        fIsDefine()
+        fColumnNames(columns), fLastResults(fNSlots * RDFInternal::CacheLineStep<ret_type>()), fVariedResults(fNSlots),
+        fValues(fNSlots), fIsDefine()
    {
       const auto nColumns = fColumnNames.size();
       for (auto i = 0u; i < nColumns; ++i)
@@ -123,25 +124,42 @@ public:
          RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource};
          fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+         const auto nVariations = fVariationDeps.GetNVariations();
+         fVariedLastCheckedEntry[slot].assign(nVariations, -1);
+         fVariedResults[slot].resize(nVariations);
       }
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
    void *GetValuePtr(unsigned int slot) final
    {
+      const auto varIdx = fVariationDeps.GetCacheIndex(slot);
+      if (varIdx != 0u)
+         return static_cast<void *>(&fVariedResults[slot][varIdx - 1]);
       return static_cast<void *>(&fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()]);
    }
 
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    void Update(unsigned int slot, Long64_t entry) final
    {
-      if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
-         // evaluate this filter, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+      const auto varIdx = fVariationDeps.GetCacheIndex(slot);
+      if (varIdx != 0u) {
+         // values of systematic variations are cached separately, so that they do not invalidate the nominal one
+         auto &lastCheckedEntry = fVariedLastCheckedEntry[slot][varIdx - 1];
+         if (entry != lastCheckedEntry) {
+            UpdateHelper(slot, entry, fVariedResults[slot][varIdx - 1], ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+            lastCheckedEntry = entry;
+         }
+      } else if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+         // evaluate this define, cache the result
+         UpdateHelper(slot, entry, fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()], ColumnTypes_t{},
+                      TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   void UpdateVariationDeps() final { fVariationDeps = RDFInternal::GetVariationDeps(fColumnNames, fDefines); }
+
    const std::type_info &GetTypeId() const { return typeid(ret_type); }
 
    /// Clean-up operations to be performed at the end of a task.
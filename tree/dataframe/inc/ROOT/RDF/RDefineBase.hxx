@@ -13,7 +13,9 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 
+#include <atomic>
 #include <deque>
 #include <map>
 #include <memory>
@@ -36,9 +38,16 @@ protected:
    const std::string fName; ///< The name of the custom column
    const std::string fType; ///< The type of the custom column as a text string
    unsigned int fNChildren{0};      ///< number of nodes of the functional graph hanging from this object
-   unsigned int fNStopsReceived{0}; ///< number of times that a children node signaled to stop processing entries.
+   /// Number of times that a children node signaled to stop processing entries.
+   /// Atomic because in multi-thread event loops stop signals can come from different slots.
+   std::atomic<unsigned int> fNStopsReceived{0};
    const unsigned int fNSlots;      ///< number of thread slots used by this node, inherited from parent node.
    std::vector<Long64_t> fLastCheckedEntry;
+   /// Per slot, the entry each cached value of a systematic variation was computed for, see
+   /// RVariationDeps::GetCacheIndex. The nominal value is cached in fLastCheckedEntry.
+   std::vector<std::vector<Long64_t>> fVariedLastCheckedEntry;
+   /// The systematic variations this custom column depends on, see UpdateVariationDeps.
+   RDFInternal::RVariationDeps fVariationDeps;
    /// A unique ID that identifies this custom column.
    /// Used e.g. to distinguish custom columns with the same name in different branches of the computation graph.
    const unsigned int fID = GetNextID();
@@ -59,6 +68,8 @@ public:
    virtual ~RDefineBase();
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
+   /// If the custom column depends on systematic variations, the address depends on the variation that is being
+   /// processed in the slot, see GetVariationDeps.
    virtual void *GetValuePtr(unsigned int slot) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
@@ -69,6 +80,10 @@ public:
    virtual void FinaliseSlot(unsigned int slot) = 0;
    /// Return the unique identifier of this RDefineBase.
    unsigned int GetID() const { return fID; }
+   /// Recompute the set of systematic variations this custom column depends on, which is returned by
+   /// GetVariationDeps. Only called before the event loop, when all jitted nodes are available.
+   virtual void UpdateVariationDeps() = 0;
+   const RDFInternal::RVariationDeps &GetVariationDeps() const { return fVariationDeps; }
 };
 
 } // ns RDF
@@ -37,15 +37,20 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
    /// The slot this value belongs to.
    unsigned int fSlot = std::numeric_limits<unsigned int>::max();
 
+   /// Whether the custom column depends on systematic variations, in which case the address of its value depends on
+   /// the variation being processed and cannot be cached.
+   bool fHasVariations = false;
+
    void *GetImpl(Long64_t entry) final
    {
       fDefine.Update(fSlot, entry);
-      return fCustomValuePtr;
+      return fHasVariations ? fDefine.GetValuePtr(fSlot) : fCustomValuePtr;
    }
 
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define, const std::type_info &tid)
-      : fDefine(define), fCustomValuePtr(define.GetValuePtr(slot)), fSlot(slot)
+      : fDefine(define), fCustomValuePtr(define.GetValuePtr(slot)), fSlot(slot),
+        fHasVariations(!define.GetVariationDeps().IsEmpty())
    {
       CheckDefineType(define, tid);
    }
@@ -83,6 +83,10 @@ public:
 
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      const auto varIdx = fVariationDeps.GetCacheIndex(slot);
+      if (varIdx != 0u)
+         return CheckVariedFilters(slot, entry, varIdx - 1);
+
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          if (!fPrevData.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
@@ -99,6 +103,20 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   /// Evaluate the filter for a systematic variation it depends on. Results are cached separately per variation, so
+   /// that they do not invalidate the nominal one, and they are not counted in the cut-flow report.
+   bool CheckVariedFilters(unsigned int slot, Long64_t entry, unsigned int varIdx)
+   {
+      auto &lastCheckedEntry = fVariedLastCheckedEntry[slot][varIdx];
+      auto &lastResult = fVariedLastResult[slot][varIdx];
+      if (entry != lastCheckedEntry) {
+         lastResult =
+            fPrevData.CheckFilters(slot, entry) && CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         lastCheckedEntry = entry;
+      }
+      return lastResult;
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -112,9 +130,12 @@ public:
    {
       for (auto &bookedBranch : fDefines.GetColumns())
          bookedBranch.second->InitSlot(r, slot);
+      for (auto &variation : fDefines.GetVariations())
+         variation.second->InitSlot(r, slot);
       RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
                                            fLoopManager->GetDataSource()};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+      InitVariedResults(slot);
    }
 
    // recursive chain of `Report`s
@@ -128,8 +149,7 @@ public:
 
    void StopProcessing() final
    {
-      ++fNStopsReceived;
-      if (fNStopsReceived == fNChildren)
+      if (++fNStopsReceived == fNChildren)
          fPrevData.StopProcessing();
    }
 
@@ -147,6 +167,13 @@ public:
       fPrevData.IncrChildrenCount();
    }
 
+   void UpdateVariationDeps() final
+   {
+      fPrevData.UpdateVariationDeps();
+      fVariationDeps = RDFInternal::GetVariationDeps(fColumnNames, fDefines);
+      fVariationDeps.Add(fPrevData.GetVariationDeps());
+   }
+
    void AddFilterName(std::vector<std::string> &filters)
    {
       fPrevData.AddFilterName(filters);
@@ -159,6 +186,8 @@ public:
    {
       for (auto &column : fDefines.GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variation : fDefines.GetVariations())
+         variation.second->FinaliseSlot(slot);
 
       for (auto &v : fValues[slot])
          v.reset();
@@ -37,6 +37,11 @@ class RFilterBase : public RNodeBase {
 protected:
    std::vector<Long64_t> fLastCheckedEntry;
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
+   /// Per slot, the entry each cached result of a systematic variation was computed for, see
+   /// RVariationDeps::GetCacheIndex. The nominal result is cached in fLastCheckedEntry and fLastResult.
+   std::vector<std::vector<Long64_t>> fVariedLastCheckedEntry;
+   /// Per slot, the cached results of the systematic variations this filter depends on.
+   std::vector<std::vector<int>> fVariedLastResult;
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
    const std::string fName;
@@ -66,6 +71,8 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinaliseSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   /// Reset the cached results of the systematic variations for the given slot.
+   void InitVariedResults(unsigned int slot);
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
 };
 
@@ -17,8 +17,10 @@
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RRange.hxx"
+#include "ROOT/RDF/RVariation.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
+#include "ROOT/RResultMap.hxx"
 #include "ROOT/RResultPtr.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/RStringView.hxx"
@@ -516,6 +518,94 @@ public:
       return newInterface;
    }
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column.
+   /// \param[in] colName The name of the column for which varied values are provided.
+   /// \param[in] expression A callable that evaluates the varied values of the column. It must return a RVec with one element per variation tag.
+   /// \param[in] inputColumns The names of the columns in input to the callable.
+   /// \param[in] variationTags The names of each varied value, e.g. "down" and "up".
+   /// \param[in] variationName A name for this set of variations, e.g. "ptscale". Defaults to the name of the varied column.
+   /// \return the first node of the computation graph for which the variations are available.
+   ///
+   /// Vary does not change the values that the nodes downstream see for `colName`: all results are computed from the
+   /// nominal values. The varied results are requested by calling ROOT::RDF::Experimental::VariationsFor on the
+   /// nominal result, which returns a RResultMap with one result per variation tag, e.g. "ptscale:down" and
+   /// "ptscale:up", in addition to the nominal one.
+   /// All results are filled in a single event loop: the input data is read once per entry and only the Defines and
+   /// Filters that depend, directly or indirectly, on a varied column are re-evaluated for each variation.
+   ///
+   /// Each column can be varied at most once per branch of the computation graph, and the names of the variations
+   /// must be unique. The input columns of the expression cannot themselves have systematic variations.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto nominal_hx =
+   ///    df.Vary("pt", [](double pt) { return RVecD{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"}, "ptscale")
+   ///       .Filter("pt > 10")
+   ///       .Histo1D("pt");
+   ///
+   /// auto hx = ROOT::RDF::Experimental::VariationsFor(nominal_hx);
+   /// hx["nominal"].Draw();
+   /// hx["ptscale:down"].Draw("SAME");
+   /// hx["ptscale:up"].Draw("SAME");
+   /// ~~~
+   // clang-format on
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using RetType = typename TTraits::CallableTraits<F>::ret_type;
+      static_assert(RDFInternal::IsRVec_t<RetType>::value, "The expression passed to Vary must return a RVec.");
+      using ColTypes_t = typename TTraits::CallableTraits<F>::arg_types;
+
+      if (variationTags.empty())
+         throw std::logic_error("Vary: at least one variation tag must be provided.");
+
+      const auto validColName = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      const std::string varName = variationName.empty() ? validColName : std::string(variationName);
+      for (const auto &variation : fDefines.GetVariations()) {
+         if (variation.first == validColName)
+            throw std::logic_error("Vary: column \"" + validColName +
+                                   "\" already has systematic variations in this branch of the computation graph.");
+         if (variation.second->GetName() == varName)
+            throw std::logic_error("Vary: a systematic variation named \"" + varName +
+                                   "\" already exists in this branch of the computation graph.");
+      }
+
+      const auto validInputColumns = GetValidatedColumnNames(ColTypes_t::list_size, inputColumns);
+      CheckAndFillDSColumns(validInputColumns, ColTypes_t());
+      if (!RDFInternal::GetVariationDeps(validInputColumns, fDefines).IsEmpty())
+         throw std::logic_error("Vary: the input columns of the expression cannot have systematic variations.");
+
+      const auto typeName = RDFInternal::TypeID2TypeName(typeid(typename RetType::value_type));
+      auto variation = std::make_shared<RDFInternal::RVariation<F>>(validColName, varName, variationTags, typeName,
+                                                                    std::move(expression), validInputColumns,
+                                                                    *fLoopManager, fDefines);
+
+      RDFInternal::RBookedDefines newCols(fDefines);
+      newCols.AddVariation(variation);
+
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column, with tags "0", "1", ..., "nVariations-1".
+   ///
+   /// See the other overload of Vary for more information.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  std::size_t nVariations, std::string_view variationName = "")
+   {
+      std::vector<std::string> variationTags;
+      variationTags.reserve(nVariations);
+      for (std::size_t i = 0u; i < nVariations; ++i)
+         variationTags.emplace_back(std::to_string(i));
+      return Vary(colName, std::move(expression), inputColumns, variationTags, variationName);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns to disk, in a new TTree `treename` in file `filename`.
    /// \tparam ColumnTypes variadic list of branch/column types.
@@ -547,6 +637,13 @@ public:
    /// single-thread and multi-thread runs is different: in single-thread runs, Snapshot will write out a TTree with
    /// the specified name and zero entries; in multi-thread runs, no TTree object will be written out to disk.
    ///
+   /// \note Setting RSnapshotOptions::fOutputFormat to ESnapshotOutputFormat::kRNTuple writes an RNTuple called
+   /// `treename` instead of a TTree (this requires ROOT to be built with `root7=ON`). In multi-thread runs each thread
+   /// fills and compresses its own clusters, which are then appended to the output file, so as in the TTree case
+   /// entries are shuffled with respect to the input. RSnapshotOptions::fAutoFlush, if positive, sets the number of
+   /// entries per cluster; writing to a sub-directory of the output file is not supported. RVec columns are written as
+   /// `std::vector` fields.
+   ///
    /// \note Snapshot will refuse to process columns with names of the form `#columnname`. These are special columns
    /// made available by some data sources (e.g. RNTupleDS) that represent the size of column `columnname`, and are
    /// not meant to be written out with that name (which is not a valid C++ variable name). Instead, go through an
@@ -602,11 +699,18 @@ public:
       treename = parsedTreePath.fTreeName;
       const auto &dirname = parsedTreePath.fDirName;
 
-      auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
-         std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
+      std::vector<std::string> colTypeNames;
+      if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+         for (const auto &col : validCols)
+            colTypeNames.emplace_back(GetColumnType(col));
+      }
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = MakeSnapshotDataFrame(fullTreeName, treename, filename, validCols, columnListWithoutSizeColumns,
+                                          colTypeNames, options);
+
+      auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
+         std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          validCols, newRDF, snapHelperArgs, validCols.size());
@@ -809,7 +913,9 @@ public:
    /// \return the first node of the computation graph for which the event loop is limited to a certain range of entries.
    ///
    /// Note that in case of previous Ranges and Filters the selected range refers to the transformed dataset.
-   /// Ranges are only available if EnableImplicitMT has _not_ been called. Multi-thread ranges are not supported.
+   /// If EnableImplicitMT has been called, the range refers to the entries that reach this node in the order in which
+   /// they are processed by the different threads, which in general differs from the order of the entries in the
+   /// dataset: e.g. `Range(10)` selects some 10 entries, but not necessarily the first 10 entries of the dataset.
    ///
    /// ### Example usage:
    /// ~~~{.cpp}
@@ -823,7 +929,6 @@ public:
       // check invariants
       if (stride == 0 || (end != 0 && end < begin))
          throw std::runtime_error("Range: stride must be strictly greater than 0 and end must be greater than begin.");
-      CheckIMTDisabled("Range");
 
       using Range_t = RDFDetail::RRange<Proxied>;
       auto rangePtr = std::make_shared<Range_t>(begin, end, stride, fProxiedPtr);
@@ -2695,6 +2800,19 @@ private:
       return *this; // never reached
    }
 
+   /// Create the RDataFrame returned by Snapshot, which reads the output TTree or RNTuple.
+   /// `colTypeNames` are the types of the written columns, only needed for RNTuple outputs.
+   std::shared_ptr<ROOT::RDataFrame>
+   MakeSnapshotDataFrame(std::string_view fullTreeName, std::string_view treename, std::string_view filename,
+                         const ColumnNames_t &validCols, const ColumnNames_t &outputColNames,
+                         const std::vector<std::string> &colTypeNames, const RSnapshotOptions &options)
+   {
+      if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple)
+         return RDFInternal::MakeRNTupleSnapshotDataFrame(std::string(treename), std::string(filename), outputColNames,
+                                                          colTypeNames);
+      return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -2710,12 +2828,13 @@ private:
       const auto &treename = parsedTreePath.fTreeName;
       const auto &dirname = parsedTreePath.fDirName;
 
+      ::TDirectory::TContext ctxt;
+      auto newRDF = MakeSnapshotDataFrame(fullTreeName, treename, filename, validCols, columnListWithoutSizeColumns,
+                                          {RDFInternal::TypeID2TypeName(typeid(ColumnTypes))...}, options);
+
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
-      ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
-
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs);
 
       if (!options.fLazy)
@@ -16,6 +16,8 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 class TTreeReader;
 
@@ -62,6 +64,9 @@ public:
    std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> GetMergeableValue() const final;
 
    std::function<void(unsigned int)> GetDataBlockCallback() final;
+
+   std::vector<std::string> GetVariationNames() final;
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final;
 };
 
 } // ns RDF
@@ -45,6 +45,7 @@ public:
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void FinaliseSlot(unsigned int slot) final;
+   void UpdateVariationDeps() final;
 };
 
 } // ns RDF
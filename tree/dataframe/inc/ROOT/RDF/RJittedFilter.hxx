@@ -58,6 +58,7 @@ public:
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinaliseSlot(unsigned int slot) final;
+   void UpdateVariationDeps() final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
 };
 
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RDataBlockNotifier.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
 
 #include <functional>
 #include <map>
@@ -119,6 +120,10 @@ class RLoopManager : public RNodeBase {
    std::vector<Callback_t> fDataBlockCallbacks; ///< Registered callbacks to call at the beginning of each "data block"
    RDFInternal::RDataBlockNotifier fDataBlockNotifier;
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Per-slot identifier of the systematic variation being processed, 0 for the nominal. See RVariationBase.
+   std::vector<unsigned int> fCurrentVariations =
+      std::vector<unsigned int>(fNSlots * RDFInternal::CacheLineStep<unsigned int>(), 0u);
+   unsigned int fNVariations{0}; ///< Number of variation identifiers handed out by RegisterVariations
 
    /// Registry of per-slot value pointers for booked data-source columns
    std::map<std::string, std::vector<void *>> fDSValuePtrMap;
@@ -198,6 +203,21 @@ public:
    const ColumnNames_t &GetBranchNames();
 
    void AddDataBlockCallback(std::function<void(unsigned int)> &&callback);
+
+   /// Reserve `n` identifiers for the variations of a RVariationBase, return the first one.
+   unsigned int RegisterVariations(unsigned int n)
+   {
+      const auto firstId = fNVariations + 1; // 0 is the nominal
+      fNVariations += n;
+      return firstId;
+   }
+   /// The identifier of the systematic variation being processed in the given slot, 0 for the nominal.
+   unsigned int &GetCurrentVariation(unsigned int slot)
+   {
+      return fCurrentVariations[slot * RDFInternal::CacheLineStep<unsigned int>()];
+   }
+   /// Pointer to the per-slot identifiers of the variations being processed, used by RVariationBase.
+   const unsigned int *GetCurrentVariations() const { return fCurrentVariations.data(); }
 };
 
 } // ns RDF
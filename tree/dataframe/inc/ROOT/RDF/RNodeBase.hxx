@@ -11,8 +11,10 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RDF/RVariationBase.hxx"
 #include "RtypesCore.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -42,7 +44,11 @@ class RNodeBase {
 protected:
    RLoopManager *fLoopManager;
    unsigned int fNChildren{0};      ///< Number of nodes of the functional graph hanging from this object
-   unsigned int fNStopsReceived{0}; ///< Number of times that a children node signaled to stop processing entries.
+   /// Number of times that a children node signaled to stop processing entries.
+   /// Atomic because in multi-thread event loops stop signals can come from different slots.
+   std::atomic<unsigned int> fNStopsReceived{0};
+   /// The systematic variations the result of CheckFilters depends on, see UpdateVariationDeps.
+   ROOT::Internal::RDF::RVariationDeps fVariationDeps;
 
 public:
    RNodeBase(RLoopManager *lm = nullptr) : fLoopManager(lm) {}
@@ -63,6 +69,11 @@ public:
    }
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
+
+   /// Recompute, recursively upstream, the set of systematic variations the result of CheckFilters depends on.
+   /// Only called before the event loop, when all jitted nodes are available.
+   virtual void UpdateVariationDeps() {}
+   const ROOT::Internal::RDF::RVariationDeps &GetVariationDeps() const { return fVariationDeps; }
 };
 } // ns RDF
 } // ns Detail
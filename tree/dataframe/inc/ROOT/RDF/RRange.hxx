@@ -16,6 +16,7 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <stdexcept>
 
 namespace ROOT {
 
@@ -48,31 +49,33 @@ public:
    // otherwise if fPrevDataFrame is fLoopManager we get a use after delete
    ~RRange() { fLoopManager->Deregister(this); }
 
-   /// Ranges act as filters when it comes to selecting entries that downstream nodes should process
+   /// Ranges act as filters when it comes to selecting entries that downstream nodes should process.
+   /// Each entry that passes upstream filters is assigned a position in the range by atomically incrementing a
+   /// counter shared by all slots, so that in multi-thread event loops begin, end and stride refer to the total
+   /// number of entries that reached this node (in processing order, which is not the dataset order).
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
-      if (entry != fLastCheckedEntry) {
-         if (fHasStopped)
-            return false;
-         if (!fPrevData.CheckFilters(slot, entry)) {
+      if (entry != fLastCheckedEntry[slot]) {
+         if (fHasStopped) {
+            fLastResult[slot] = false;
+         } else if (!fPrevData.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
-            fLastResult = false;
+            fLastResult[slot] = false;
          } else {
             // apply range filter logic, cache the result
-            ++fNProcessedEntries;
-            if (fNProcessedEntries <= fStart || (fStop > 0 && fNProcessedEntries > fStop) ||
-                (fStride != 1 && fNProcessedEntries % fStride != 0))
-               fLastResult = false;
+            const ULong64_t nProcessed = ++fNProcessedEntries;
+            if (nProcessed <= fStart || (fStop > 0 && nProcessed > fStop) ||
+                (fStride != 1 && nProcessed % fStride != 0))
+               fLastResult[slot] = false;
             else
-               fLastResult = true;
-            if (fNProcessedEntries == fStop) {
-               fHasStopped = true;
+               fLastResult[slot] = true;
+            // the stop signal is sent upstream only once, also if all children stop at the same time
+            if (nProcessed == fStop && !fHasStopped.exchange(true))
                fPrevData.StopProcessing();
-            }
          }
-         fLastCheckedEntry = entry;
+         fLastCheckedEntry[slot] = entry;
       }
-      return fLastResult;
+      return fLastResult[slot];
    }
 
    // recursive chain of `Report`s
@@ -83,8 +86,7 @@ public:
 
    void StopProcessing() final
    {
-      ++fNStopsReceived;
-      if (fNStopsReceived == fNChildren && !fHasStopped)
+      if (++fNStopsReceived == fNChildren && !fHasStopped.exchange(true))
          fPrevData.StopProcessing();
    }
 
@@ -96,6 +98,15 @@ public:
          fPrevData.IncrChildrenCount();
    }
 
+   /// The positions of the entries in the range must not depend on which systematic variation is being processed:
+   /// ranges downstream of a varied selection are not supported.
+   void UpdateVariationDeps() final
+   {
+      fPrevData.UpdateVariationDeps();
+      if (!fPrevData.GetVariationDeps().IsEmpty())
+         throw std::runtime_error("Range cannot be applied after a Filter that depends on a systematic variation.");
+   }
+
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
@@ -14,6 +14,9 @@
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "RtypesCore.h"
 
+#include <atomic>
+#include <vector>
+
 namespace ROOT {
 
 // fwd decl
@@ -34,10 +37,14 @@ protected:
    unsigned int fStart;
    unsigned int fStop;
    unsigned int fStride;
-   Long64_t fLastCheckedEntry{-1};
-   bool fLastResult{true};
-   ULong64_t fNProcessedEntries{0};
-   bool fHasStopped{false};    ///< True if the end of the range has been reached
+   std::vector<Long64_t> fLastCheckedEntry;
+   std::vector<int> fLastResult; // std::vector<bool> cannot be used in a MT context safely
+   /// Number of entries that reached this node, summed over all processing slots.
+   /// In multi-thread event loops this is the global counter that entries are assigned a range position from.
+   std::atomic<ULong64_t> fNProcessedEntries{0};
+   /// True if the end of the range has been reached or all children stopped processing.
+   /// Set with an atomic exchange, so that exactly one slot sends the stop signal upstream.
+   std::atomic<bool> fHasStopped{false};
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    void ResetCounters();
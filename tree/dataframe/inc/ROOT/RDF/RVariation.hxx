@@ -0,0 +1,129 @@
+/// \file ROOT/RDF/RVariation.hxx
+/// \ingroup dataframe
+/// \date 2021-10
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATION
+#define ROOT_RDF_RVARIATION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility> // std::index_sequence
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+using namespace ROOT::TypeTraits;
+
+/// A RDataFrame node that computes the systematic variations of a column, see RInterface::Vary.
+/// The expression returns all the varied values of the column for the current entry, as a RVec.
+template <typename F>
+class R__CLING_PTRCHECK(off) RVariation final : public RVariationBase {
+   using ColumnTypes_t = typename CallableTraits<F>::arg_types;
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ret_type = typename CallableTraits<F>::ret_type;
+   using value_type = typename ret_type::value_type;
+
+   F fExpression;
+   const ColumnNames_t fInputColumns;
+   /// The varied values per slot, as returned by the expression
+   std::vector<ret_type> fLastResults;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      auto &results = fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()];
+      results = fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      if (results.size() != fTags.size()) {
+         throw std::runtime_error("The expression passed to Vary for column \"" + fColumnName + "\" returned " +
+                                  std::to_string(results.size()) + " values, but " + std::to_string(fTags.size()) +
+                                  " variation tags were specified.");
+      }
+      // silence "unused parameter" warnings in gcc
+      (void)slot;
+      (void)entry;
+   }
+
+public:
+   RVariation(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+              std::string_view type, F expression, const ColumnNames_t &inputColumns,
+              ROOT::Detail::RDF::RLoopManager &lm, const RBookedDefines &defines)
+      : RVariationBase(columnName, variationName, tags, type, lm, defines), fExpression(std::move(expression)),
+        fInputColumns(inputColumns), fLastResults(fNSlots * RDFInternal::CacheLineStep<ret_type>()),
+        fValues(fNSlots), fIsDefine()
+   {
+      const auto nColumns = fInputColumns.size();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = fDefines.HasName(fInputColumns[i]);
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      if (!fIsInitialized[slot]) {
+         fIsInitialized[slot] = true;
+         RDFInternal::RColumnReadersInfo info{fInputColumns, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource};
+         fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      }
+   }
+
+   void *GetValuePtr(unsigned int slot, std::size_t varIdx) final
+   {
+      return static_cast<void *>(&fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()][varIdx]);
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(value_type); }
+
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+         // evaluate all variations at once, cache the results
+         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
+      }
+   }
+
+   void FinaliseSlot(unsigned int slot) final
+   {
+      if (fIsInitialized[slot]) {
+         for (auto &v : fValues[slot])
+            v.reset();
+         fIsInitialized[slot] = false;
+      }
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATION
@@ -0,0 +1,153 @@
+/// \file ROOT/RDF/RVariationBase.hxx
+/// \ingroup dataframe
+/// \date 2021-10
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONBASE
+#define ROOT_RDF_RVARIATIONBASE
+
+#include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <deque>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace RDF {
+class RDataSource;
+}
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+}
+} // namespace Detail
+
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RVariationBase
+\ingroup dataframe
+\brief Base class for the nodes that compute the systematic variations of a column, see RInterface::Vary.
+
+Each variation of a column is identified by an integer that is unique within the computation graph: the variations
+of a RVariationBase are assigned the contiguous range `[GetFirstId(), GetFirstId() + GetTags().size())`, while 0 is
+reserved for the nominal values. During the event loop, RVariedAction sets the identifier of the variation it is
+currently processing in the RLoopManager, and the column readers and the nodes that depend on the varied column
+look it up to decide which values to produce.
+*/
+class RVariationBase {
+protected:
+   const std::string fColumnName;          ///< The name of the varied column
+   const std::string fName;                ///< The name of the systematic variation, e.g. "ptscale"
+   const std::vector<std::string> fTags;   ///< The tags of the varied values, e.g. {"down", "up"}
+   const std::string fType;                ///< The type of the varied column as a text string
+   const unsigned int fNSlots;             ///< Number of thread slots used by this node
+   const unsigned int fFirstId;            ///< The identifier of the first variation, see class description
+   /// Non-owning pointer to the per-slot identifiers of the variations being processed, owned by the RLoopManager.
+   const unsigned int *fCurrentVariations;
+   std::vector<Long64_t> fLastCheckedEntry;
+   RBookedDefines fDefines;
+   std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+
+public:
+   RVariationBase(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+                  std::string_view type, ROOT::Detail::RDF::RLoopManager &lm, const RBookedDefines &defines);
+   RVariationBase(const RVariationBase &) = delete;
+   RVariationBase &operator=(const RVariationBase &) = delete;
+   virtual ~RVariationBase();
+
+   virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Return the (type-erased) address of the varied value with the given index for the given processing slot.
+   /// The address is only valid until the next call to Update for the same slot.
+   virtual void *GetValuePtr(unsigned int slot, std::size_t varIdx) = 0;
+   virtual const std::type_info &GetTypeId() const = 0;
+   /// Compute all the varied values corresponding to the given entry
+   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Clean-up operations to be performed at the end of a task.
+   virtual void FinaliseSlot(unsigned int slot) = 0;
+
+   const std::string &GetColumnName() const { return fColumnName; }
+   const std::string &GetName() const { return fName; }
+   const std::vector<std::string> &GetTags() const { return fTags; }
+   std::string GetTypeName() const { return fType; }
+   unsigned int GetFirstId() const { return fFirstId; }
+
+   /// Whether the variation with the given identifier is one of the variations of this node.
+   bool HasVariation(unsigned int id) const { return id >= fFirstId && id - fFirstId < fTags.size(); }
+
+   /// The identifier of the variation that is being processed in the given slot, 0 for the nominal values.
+   unsigned int GetCurrentVariation(unsigned int slot) const
+   {
+      return fCurrentVariations[slot * CacheLineStep<unsigned int>()];
+   }
+};
+
+/**
+\class ROOT::Internal::RDF::RVariationDeps
+\ingroup dataframe
+\brief The set of systematic variations a node of the computation graph depends on.
+
+Nodes cache their results per entry. The results of the nodes that depend on a varied column are also cached per
+variation, so that they are computed once per entry and per variation, while all other nodes compute their values only
+once per entry, independently of how many variations are filled.
+*/
+class RVariationDeps {
+   std::vector<const RVariationBase *> fVariations;
+
+public:
+   void Add(const RVariationBase &variation);
+   void Add(const RVariationDeps &other);
+   bool IsEmpty() const { return fVariations.empty(); }
+   const std::vector<const RVariationBase *> &GetVariations() const { return fVariations; }
+   /// The names of all the variations in the set, in the form "variation:tag"
+   std::vector<std::string> GetVariationNames() const;
+   /// The identifiers of all the variations in the set, in the same order as GetVariationNames
+   std::vector<unsigned int> GetVariationIds() const;
+   /// The number of variations in the set, i.e. the size of GetVariationIds
+   std::size_t GetNVariations() const;
+
+   /// Return the position, starting from 1, of the variation currently processed in the given slot among the
+   /// variations in the set (in the order of GetVariationIds), or 0 (i.e. the nominal) if the owner of this object
+   /// does not depend on it. Used by the nodes to index their per-variation caches.
+   unsigned int GetCacheIndex(unsigned int slot) const
+   {
+      if (fVariations.empty())
+         return 0u;
+      const auto id = fVariations.front()->GetCurrentVariation(slot);
+      if (id == 0u)
+         return 0u;
+      unsigned int offset = 1u;
+      for (const auto *v : fVariations) {
+         if (v->HasVariation(id))
+            return offset + (id - v->GetFirstId());
+         offset += v->GetTags().size();
+      }
+      return 0u;
+   }
+};
+
+/// Return the union of the variations the given columns depend on.
+/// Variations of jitted Defines are only known after jitting.
+RVariationDeps GetVariationDeps(const std::vector<std::string> &columns, const RBookedDefines &defines);
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATIONBASE
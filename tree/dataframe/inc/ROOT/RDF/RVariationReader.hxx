@@ -0,0 +1,68 @@
+/// \file ROOT/RDF/RVariationReader.hxx
+/// \ingroup dataframe
+/// \date 2021-10
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONREADER
+#define ROOT_RDF_RVARIATIONREADER
+
+#include "RColumnReaderBase.hxx"
+#include "RVariationBase.hxx"
+#include <Rtypes.h> // Long64_t, R__CLING_PTRCHECK
+
+#include <memory>
+#include <typeinfo>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+namespace RDFDetail = ROOT::Detail::RDF;
+
+void CheckVariationType(const RVariationBase &variation, const std::type_info &tid);
+
+/// Column reader for columns with systematic variations.
+/// It returns the varied value if the variation currently processed in its slot belongs to the column, and the value
+/// read by the reader of the nominal column otherwise.
+template <typename T>
+class R__CLING_PTRCHECK(off) RVariationReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   /// Non-owning reference to the node that computes the varied values.
+   RVariationBase &fVariation;
+
+   /// The reader of the nominal values of the column.
+   std::unique_ptr<RDFDetail::RColumnReaderBase> fNominalReader;
+
+   /// The slot this value belongs to.
+   unsigned int fSlot;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      const auto id = fVariation.GetCurrentVariation(fSlot);
+      if (!fVariation.HasVariation(id))
+         return &fNominalReader->template Get<T>(entry);
+
+      fVariation.Update(fSlot, entry);
+      return fVariation.GetValuePtr(fSlot, id - fVariation.GetFirstId());
+   }
+
+public:
+   RVariationReader(unsigned int slot, RVariationBase &variation,
+                    std::unique_ptr<RDFDetail::RColumnReaderBase> nominalReader)
+      : fVariation(variation), fNominalReader(std::move(nominalReader)), fSlot(slot)
+   {
+      CheckVariationType(variation, typeid(T));
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATIONREADER
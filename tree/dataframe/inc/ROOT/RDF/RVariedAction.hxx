@@ -0,0 +1,212 @@
+/// \file ROOT/RDF/RVariedAction.hxx
+/// \ingroup dataframe
+/// \date 2021-10
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIEDACTION
+#define ROOT_RVARIEDACTION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+#include "TError.h"             // R__ASSERT
+
+#include <array>
+#include <cstddef> // std::size_t
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+namespace RDFDetail = ROOT::Detail::RDF;
+namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
+
+namespace GraphDrawing {
+std::shared_ptr<GraphNode> AddDefinesToGraph(std::shared_ptr<GraphNode> node,
+                                             const RDFInternal::RBookedDefines &defines,
+                                             const std::vector<std::string> &prevNodeDefines);
+} // namespace GraphDrawing
+
+// clang-format off
+/**
+ * \class ROOT::Internal::RDF::RVariedAction
+ * \ingroup dataframe
+ * \brief A RDataFrame node that produces one result per systematic variation, in a single event loop
+ * \tparam Helper The action helper type, which implements the concrete action logic (e.g. FillHelper)
+ * \tparam PrevDataFrame The type of the parent node in the computation graph
+ * \tparam ColumnTypes_t A TypeList with the types of the input columns
+ *
+ * For each entry, the action sets the identifier of each variation in turn as the current variation of the slot,
+ * checks the upstream filters and fills the corresponding result. Upstream nodes that do not depend on the varied
+ * columns cache their values per entry, so they are evaluated only once for all variations.
+ * The nominal result is filled by the RAction this node was created from, see RActionBase::MakeVariedAction.
+ */
+// clang-format on
+template <typename Helper, typename PrevDataFrame, typename ColumnTypes_t = typename Helper::ColumnTypes_t>
+class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+
+   /// One helper per variation, in the same order as fVariationIds
+   std::vector<Helper> fHelpers;
+   /// The identifiers of the variations filled by this action
+   const std::vector<unsigned int> fVariationIds;
+   const std::shared_ptr<PrevDataFrame> fPrevDataPtr;
+   PrevDataFrame &fPrevData;
+   /// Column readers per slot and per input column, shared by all variations
+   std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+public:
+   RVariedAction(std::vector<Helper> &&helpers, std::vector<unsigned int> &&variationIds, const ColumnNames_t &columns,
+                 std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines)
+      : RActionBase(pd->GetLoopManagerUnchecked(), columns, defines), fHelpers(std::move(helpers)),
+        fVariationIds(std::move(variationIds)), fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr),
+        fValues(GetNSlots()), fIsDefine()
+   {
+      R__ASSERT(fHelpers.size() == fVariationIds.size());
+      const auto nColumns = columns.size();
+      const auto &customCols = GetDefines();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = customCols.HasName(columns[i]);
+   }
+
+   RVariedAction(const RVariedAction &) = delete;
+   RVariedAction &operator=(const RVariedAction &) = delete;
+   // must call Deregister here, see ~RAction
+   ~RVariedAction() { fLoopManager->Deregister(this); }
+
+   std::unique_ptr<RDFDetail::RMergeableValueBase> GetMergeableValue() const final
+   {
+      throw std::logic_error("`GetMergeableValue` is not implemented for results with systematic variations.");
+   }
+
+   void Initialize() final
+   {
+      for (auto &h : fHelpers)
+         h.Initialize();
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      for (auto &bookedBranch : GetDefines().GetColumns())
+         bookedBranch.second->InitSlot(r, slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->InitSlot(r, slot);
+      RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
+                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
+      fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+      for (auto &h : fHelpers)
+         h.InitTask(r, slot);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CallExec(unsigned int slot, std::size_t varIdx, Long64_t entry, TypeList<ColTypes...>,
+                 std::index_sequence<S...>)
+   {
+      fHelpers[varIdx].Exec(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      (void)entry; // avoid "unused parameter" warnings
+   }
+
+   void Run(unsigned int slot, Long64_t entry) final
+   {
+      auto &currentVariation = fLoopManager->GetCurrentVariation(slot);
+      const auto nVariations = fVariationIds.size();
+      for (std::size_t varIdx = 0u; varIdx < nVariations; ++varIdx) {
+         currentVariation = fVariationIds[varIdx];
+         // check if entry passes all filters for this variation
+         if (fPrevData.CheckFilters(slot, entry))
+            CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
+      // other actions see the nominal values
+      currentVariation = 0u;
+   }
+
+   void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
+
+   /// Clean-up operations to be performed at the end of a task.
+   void FinalizeSlot(unsigned int slot) final
+   {
+      for (auto &column : GetDefines().GetColumns())
+         column.second->FinaliseSlot(slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->FinaliseSlot(slot);
+      for (auto &v : fValues[slot])
+         v.reset();
+      for (auto &h : fHelpers)
+         h.CallFinalizeTask(slot);
+   }
+
+   /// Clean-up and finalize the varied results (e.g. merging slot-local results).
+   void Finalize() final
+   {
+      for (auto &h : fHelpers)
+         h.Finalize();
+      SetHasRun();
+   }
+
+   std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
+   {
+      auto prevNode = fPrevData.GetGraph();
+      auto prevColumns = prevNode->GetDefinedColumns();
+
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>("Varied " + fHelpers.front().GetActionName());
+
+      auto upmostNode = AddDefinesToGraph(thisNode, GetDefines(), prevColumns);
+
+      thisNode->AddDefinedColumns(GetDefines().GetNames());
+      thisNode->SetAction(HasRun());
+      upmostNode->SetPrevNode(prevNode);
+      return thisNode;
+   }
+
+   void *PartialUpdate(unsigned int) final
+   {
+      throw std::logic_error("Callbacks are not supported for results with systematic variations.");
+   }
+
+   std::function<void(unsigned int)> GetDataBlockCallback() final
+   {
+      std::vector<std::function<void(unsigned int)>> callbacks;
+      for (auto &h : fHelpers) {
+         auto c = h.GetDataBlockCallback();
+         if (c)
+            callbacks.emplace_back(std::move(c));
+      }
+      if (callbacks.empty())
+         return {};
+      return [callbacks](unsigned int slot) {
+         for (auto &c : callbacks)
+            c(slot);
+      };
+   }
+
+   std::vector<std::string> GetVariationNames() final { return {}; }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&) final
+   {
+      throw std::logic_error("Cannot book systematic variations of a result with systematic variations.");
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVARIEDACTION
@@ -181,6 +181,25 @@ RNode AsRNode(NodeType node)
 // clang-format on
 void RunGraphs(std::vector<RResultHandle> handles);
 
+// clang-format off
+/// Add the string expressions that were jitted because they were missing from the jitting cache to it
+///
+/// If `RDataFrame.JitCacheDir` is set, the expressions passed to Filter and Define that are not in the cache yet are
+/// jitted as usual and recorded. This function compiles all the recorded expressions into a single library with ACLiC
+/// and stores it in the cache directory, so that following processes load the compiled expressions instead of jitting
+/// them. The compilation can take several seconds: call it once, after the event loops, e.g. at the end of the job.
+/// It does nothing if no expression is missing from the cache.
+///
+/// ~~~{.cpp}
+/// gEnv->SetValue("RDataFrame.JitCacheDir", "/path/to/cache");
+/// ROOT::RDataFrame df("tree", "file.root");
+/// auto h = df.Define("y", "x * x").Filter("y > 4").Histo1D("y");
+/// h->Draw();
+/// ROOT::RDF::PopulateJitCache();
+/// ~~~
+// clang-format on
+void PopulateJitCache();
+
 } // namespace RDF
 } // namespace ROOT
 #endif
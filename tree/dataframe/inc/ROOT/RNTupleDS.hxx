@@ -30,7 +30,9 @@
 namespace ROOT {
 namespace Experimental {
 
+class RClusterDescriptor;
 class RNTupleDescriptor;
+class RNTupleModel;
 
 namespace Detail {
 class RFieldBase;
@@ -57,6 +59,24 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// The RNTuple opened by the first event loop, if the data source was created before the RNTuple was written
+   std::string fNTupleName;
+   std::string fFileName;
+
+   /// A value range of a column given by AddClusterSelection()
+   struct RClusterSelection {
+      DescriptorId_t fColumnId;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RClusterSelection> fClusterSelections;
+
+   /// Attaches a clone of the first source for each additional slot
+   void AttachSources();
+
+   /// Returns false if the column statistics of the cluster show that no entry can pass the cluster selections
+   bool IsClusterSelected(const RClusterDescriptor &clusterDesc) const;
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -72,6 +92,9 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
 
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Provides the columns of the RNTuple `ntupleName` in `fileName` before the RNTuple is written, e.g. by a Snapshot:
+   /// the columns are given by the fields of `model` and the RNTuple is only opened by the first event loop.
+   RNTupleDS(std::string_view ntupleName, std::string_view fileName, std::unique_ptr<RNTupleModel> model);
    ~RNTupleDS();
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
@@ -88,6 +111,14 @@ public:
    std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
    GetColumnReaders(unsigned int /*slot*/, std::string_view /*name*/, const std::type_info &) final;
 
+   /// Skip the clusters in which no value of the column `colName` lies within [min, max], as recorded in the column
+   /// statistics of the RNTuple (see RNTupleWriteOptions::SetHasColumnStatistics()). Clusters without statistics are
+   /// always read. The data source cannot inspect the expressions of Filters, so this is meant to be used together
+   /// with a Filter that rejects the entries whose `colName` is outside [min, max]. Only columns of arithmetic type
+   /// that have a single value per entry (i.e., that are not part of a collection) are supported.
+   /// Must be called before the event loop is started, and requires the RNTuple to be on disk.
+   void AddClusterSelection(std::string_view colName, double min, double max);
+
 protected:
    Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) final;
 };
@@ -0,0 +1,140 @@
+/// \file ROOT/RResultMap.hxx
+/// \ingroup dataframe
+/// \date 2021-10
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTMAP
+#define ROOT_RDF_RRESULTMAP
+
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RResultPtr.hxx"
+#include "TError.h" // R__ASSERT
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief A container for the nominal and the systematically varied results of an action, see VariationsFor.
+
+The results are indexed by "nominal" and by strings of the form "variation:tag", e.g. "ptscale:up". Accessing any of
+the results triggers the event loop if it has not run yet: all of them are filled in the same event loop.
+*/
+template <typename T>
+class RResultMap {
+   template <typename T1>
+   friend RResultMap<T1> VariationsFor(RResultPtr<T1> resPtr);
+
+   RResultPtr<T> fNominal;
+   std::vector<std::string> fKeys; ///< "nominal" followed by the names of the variations
+   std::unordered_map<std::string, std::shared_ptr<T>> fVariedResults;
+   /// The action that fills the varied results, null if the result does not depend on any variation
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> fVariedAction;
+
+   RResultMap(const RResultPtr<T> &nominal, const std::vector<std::string> &variationNames,
+              std::vector<std::shared_ptr<T>> &&variedResults,
+              std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction)
+      : fNominal(nominal), fKeys{"nominal"}, fVariedAction(std::move(variedAction))
+   {
+      R__ASSERT(variationNames.size() == variedResults.size());
+      fKeys.insert(fKeys.end(), variationNames.begin(), variationNames.end());
+      for (std::size_t i = 0u; i < variationNames.size(); ++i)
+         fVariedResults[variationNames[i]] = std::move(variedResults[i]);
+   }
+
+public:
+   /// Return the result with the given key ("nominal" or "variation:tag"), running the event loop if needed.
+   T &operator[](const std::string &key)
+   {
+      if (key == "nominal")
+         return *fNominal;
+
+      const auto it = fVariedResults.find(key);
+      if (it == fVariedResults.end())
+         throw std::runtime_error("RResultMap: no result with key \"" + key + "\".");
+      if (!fVariedAction->HasRun())
+         fVariedAction->GetLoopManager()->Run();
+      return *it->second;
+   }
+
+   /// Return the keys of all the results, starting with "nominal".
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Produce all systematic variations of the given result.
+/// \param[in] resPtr The nominal result, as returned by an action booked downstream of one or more Vary calls.
+/// \return A RResultMap that contains the nominal result and one result per systematic variation it depends on.
+///
+/// VariationsFor must be called before the event loop that fills the nominal result is run. It books a single
+/// additional action that fills all the varied results in the same event loop as the nominal one: only the
+/// Defines and Filters that depend on a varied column are re-evaluated for each variation, all other nodes and
+/// the reading of the input data are shared.
+///
+/// Count, Fill and the Histo*, Min, Max, Sum, Mean and StdDev actions support systematic variations.
+///
+/// ### Example usage:
+/// ~~~{.cpp}
+/// auto nominal_hx = df.Vary("pt", [](double pt) { return RVecD{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"})
+///                     .Filter("pt > k")
+///                     .Define("x", someFunc, {"pt"})
+///                     .Histo1D("x");
+///
+/// auto hx = ROOT::RDF::Experimental::VariationsFor(nominal_hx);
+/// hx["nominal"].Draw();
+/// hx["pt:down"].Draw("SAME");
+/// ~~~
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   R__ASSERT(resPtr != nullptr && "Called VariationsFor on an empty RResultPtr");
+
+   if (resPtr.IsReady())
+      throw std::logic_error("VariationsFor: the event loop that produces this result has already run. Systematic "
+                             "variations must be booked before the event loop is triggered.");
+
+   // the concrete action (and all upstream nodes) must be available to know which variations affect the result
+   resPtr.fLoopManager->Jit();
+   const auto variationNames = resPtr.fActionPtr->GetVariationNames();
+   if (variationNames.empty())
+      return RResultMap<T>(resPtr, {}, {}, nullptr);
+
+   // the varied results start as copies of the nominal one, which has not been filled yet
+   std::vector<std::shared_ptr<T>> variedResults;
+   variedResults.reserve(variationNames.size());
+   std::vector<void *> typeErasedResults;
+   typeErasedResults.reserve(variationNames.size());
+   for (std::size_t i = 0u; i < variationNames.size(); ++i) {
+      variedResults.emplace_back(std::make_shared<T>(*resPtr.fObjPtr));
+      typeErasedResults.emplace_back(&variedResults.back());
+   }
+
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction =
+      resPtr.fActionPtr->MakeVariedAction(std::move(typeErasedResults));
+   resPtr.fLoopManager->Book(variedAction.get());
+   resPtr.fLoopManager->AddDataBlockCallback(variedAction->GetDataBlockCallback());
+
+   return RResultMap<T>(resPtr, variationNames, std::move(variedResults), std::move(variedAction));
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTMAP
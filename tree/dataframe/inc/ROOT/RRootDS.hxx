@@ -16,6 +16,8 @@
 #include <TChain.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -34,8 +36,13 @@ private:
    std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
    std::vector<std::vector<void *>> fBranchAddresses; // first container-> slot, second -> column;
    std::vector<std::unique_ptr<TChain>> fChains;
+   /// The entry number local to the current tree of each slot's chain, as set by SetEntry()
+   std::vector<Long64_t> fLocalEntries;
+   /// The last entry read per column and per slot, shared by all the column readers of the same column in a slot
+   std::vector<std::vector<Long64_t>> fLastReadEntries; // first container-> column, second -> slot;
 
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &);
+   void CheckColumnType(std::string_view name, const std::type_info &id) const;
 
 protected:
    std::string AsString() { return "ROOT data source"; };
@@ -43,6 +50,8 @@ protected:
 public:
    RRootDS(std::string_view treeName, std::string_view fileNameGlob);
    ~RRootDS();
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+   GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info &);
    std::string GetTypeName(std::string_view colName) const;
    const std::vector<std::string> &GetColumnNames() const;
    bool HasColumn(std::string_view colName) const;
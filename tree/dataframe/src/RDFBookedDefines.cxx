@@ -7,6 +7,7 @@
  *************************************************************************/
 
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 
 namespace ROOT {
 namespace Internal {
@@ -25,6 +26,12 @@ void RBookedDefines::AddColumn(const std::shared_ptr<RDFDetail::RDefineBase> &co
    (*newCols)[colName] = column;
    fDefines = newCols;
    AddName(colName);
+
+   if (fVariations->find(colName) != fVariations->end()) {
+      auto newVariations = std::make_shared<RVariationBasePtrMap_t>(GetVariations());
+      newVariations->erase(colName);
+      fVariations = newVariations;
+   }
 }
 
 void RBookedDefines::AddName(std::string_view name)
@@ -38,6 +45,13 @@ void RBookedDefines::AddName(std::string_view name)
    fDefinesNames = newColsNames;
 }
 
+void RBookedDefines::AddVariation(const std::shared_ptr<RVariationBase> &variation)
+{
+   auto newVariations = std::make_shared<RVariationBasePtrMap_t>(GetVariations());
+   (*newVariations)[variation->GetColumnName()] = variation;
+   fVariations = newVariations;
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
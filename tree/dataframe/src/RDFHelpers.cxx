@@ -9,6 +9,7 @@
  *************************************************************************/
 
 #include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RDF/InterfaceUtils.hxx" // PopulateJitCache
 #include "TROOT.h"      // IsImplicitMTEnabled
 #include "TError.h"     // Warning
 #include "RConfigure.h" // R__USE_IMT
@@ -57,3 +58,8 @@ void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    for (auto &h : uniqueLoops)
       run(h);
 }
+
+void ROOT::RDF::PopulateJitCache()
+{
+   ROOT::Internal::RDF::PopulateJitCache();
+}
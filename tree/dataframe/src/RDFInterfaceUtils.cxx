@@ -10,18 +10,25 @@
 
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <RtypesCore.h>
+#include <RVersion.h>
 #include <TDirectory.h>
+#include <TEnv.h>
+#include <TError.h>
 #include <TChain.h>
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TMD5.h>
 #include <TObject.h>
 #include <TPRegexp.h>
+#include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -37,11 +44,18 @@
 #endif
 
 #include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <unordered_set>
 #include <stdexcept>
 #include <string>
 #include <sstream>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Detail {
@@ -299,6 +313,311 @@ static std::string RetTypeOfLambda(const std::string &lambdaName)
    return type;
 }
 
+namespace {
+
+/// The kind of jitted node a function in the jitting cache books, see GetCachedJitFunction.
+enum class EJitCachedKind { kFilter, kDefine };
+
+/// A function loaded from the on-disk jitting cache: calling it is equivalent to calling JitFilterHelper or
+/// JitDefineHelper with the jitted lambda, without declaring the lambda to the interpreter.
+struct RCachedJitFunction {
+   void *fAddress = nullptr; ///< The address of the entry point, nullptr if the function is not in the cache
+   std::string fRetType;     ///< The return type of the lambda, as given by RetTypeOfLambda
+};
+
+/// Compilations of the jitting cache that failed or were started by a process more than this many seconds ago are
+/// retried: failures can be transient (e.g. a full disk) and the process that started a compilation might have died.
+constexpr Long_t kJitCacheRetrySeconds = 3600;
+
+/// An expression that was jitted because it is not in the jitting cache yet, see PopulateJitCache.
+struct RJitCacheEntry {
+   std::string fCacheDir;
+   std::string fFunctionName;
+   EJitCachedKind fKind;
+   std::string fLambdaExpr;
+   std::string fRetType;
+};
+
+/// The expressions to be added to the jitting cache by the next call to PopulateJitCache.
+std::vector<RJitCacheEntry> &GetPendingJitCacheEntries()
+{
+   static std::vector<RJitCacheEntry> entries;
+   return entries;
+}
+
+std::mutex &GetPendingJitCacheEntriesMutex()
+{
+   static std::mutex mutex;
+   return mutex;
+}
+
+/// Return the directory of the jitting cache, as set by RDataFrame.JitCacheDir in .rootrc, or an empty string if the
+/// cache is disabled.
+std::string GetJitCacheDir()
+{
+   return gEnv->GetValue("RDataFrame.JitCacheDir", "");
+}
+
+/// Return the name of the entry point of the cached function for the given lambda expression.
+/// The name is unique for the kind of node, the expression (which includes the argument types) and the ROOT build.
+std::string GetJitCacheFunctionName(EJitCachedKind kind, const std::string &lambdaExpr)
+{
+   std::string key = (kind == EJitCachedKind::kFilter) ? "Filter\n" : "Define\n";
+   key += lambdaExpr;
+   key += '\n';
+   key += ROOT_RELEASE;
+   key += gROOT->GetGitCommit();
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   return std::string("rdfjit_") + md5.AsString();
+}
+
+/// The library built for a batch of cached functions.
+std::string GetJitCacheLibrary(const std::string &cacheDir, const std::string &batchName)
+{
+   return cacheDir + '/' + batchName + '/' + batchName + "_cxx." + gSystem->GetSoExt();
+}
+
+/// The file that contains the name of the batch whose library contains the cached function.
+std::string GetJitCacheIndexFile(const std::string &cacheDir, const std::string &functionName)
+{
+   return cacheDir + '/' + functionName + ".lib";
+}
+
+std::string GetJitCacheFailureMarker(const std::string &cacheDir, const std::string &functionName)
+{
+   return cacheDir + '/' + functionName + ".failed";
+}
+
+/// The directory created by the process that compiles the function, so that concurrent processes do not compile it
+/// too.
+std::string GetJitCacheClaim(const std::string &cacheDir, const std::string &functionName)
+{
+   return cacheDir + '/' + functionName + ".building";
+}
+
+/// Return true if `path` exists and was modified less than kJitCacheRetrySeconds ago.
+bool IsRecentJitCacheFile(const std::string &path)
+{
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(path.c_str(), stat) != 0)
+      return false;
+   return std::time(nullptr) - stat.fMtime < kJitCacheRetrySeconds;
+}
+
+/// Look up the compiled function for the given lambda expression in the jitting cache and load it.
+RCachedJitFunction GetCachedJitFunction(const std::string &cacheDir, const std::string &functionName)
+{
+   RCachedJitFunction result;
+   std::string batchName;
+   {
+      std::ifstream index(GetJitCacheIndexFile(cacheDir, functionName));
+      if (!(index >> batchName))
+         return result;
+   }
+   const auto library = GetJitCacheLibrary(cacheDir, batchName);
+   if (gSystem->Load(library.c_str()) < 0) {
+      Warning("RDataFrame::Jit", "Could not load %s from the jitting cache, the expression will be jitted.",
+              library.c_str());
+      return result;
+   }
+
+   using RetTypeFunc_t = const char *(*)();
+   const auto retTypeFunc =
+      reinterpret_cast<RetTypeFunc_t>(gSystem->DynFindSymbol(library.c_str(), (functionName + "_ret_type").c_str()));
+   result.fAddress = reinterpret_cast<void *>(gSystem->DynFindSymbol(library.c_str(), functionName.c_str()));
+   if (retTypeFunc == nullptr || result.fAddress == nullptr) {
+      result.fAddress = nullptr;
+      return result;
+   }
+   result.fRetType = retTypeFunc();
+   R__LOG_DEBUG(0, ROOT::Detail::RDF::RDFLogChannel())
+      << "Loaded " << functionName << " from the jitting cache " << cacheDir;
+   return result;
+}
+
+/// Remove the files of a temporary build directory of the jitting cache, and the directory itself.
+void RemoveJitCacheBuildDir(const std::string &buildDir)
+{
+   void *dir = gSystem->OpenDirectory(buildDir.c_str());
+   if (dir) {
+      std::vector<std::string> entries;
+      while (const char *entry = gSystem->GetDirEntry(dir)) {
+         if (std::strcmp(entry, ".") != 0 && std::strcmp(entry, "..") != 0)
+            entries.emplace_back(buildDir + '/' + entry);
+      }
+      gSystem->FreeDirectory(dir);
+      for (const auto &entry : entries)
+         gSystem->Unlink(entry.c_str());
+   }
+   gSystem->Unlink(buildDir.c_str());
+}
+
+/// Write `content` to `path` through a temporary file that is then renamed, so that concurrent processes never read a
+/// partially written file.
+void WriteJitCacheFileAtomically(const std::string &path, const std::string &content)
+{
+   const auto tmpPath = path + '.' + std::to_string(gSystem->GetPid()) + ".tmp";
+   {
+      std::ofstream out(tmpPath);
+      out << content;
+      if (!out) {
+         gSystem->Unlink(tmpPath.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0)
+      gSystem->Unlink(tmpPath.c_str());
+}
+
+/// Try to become the process that compiles the function: return false if it is already in the cache, if its
+/// compilation failed recently or if another process is compiling it.
+bool ClaimJitCacheEntry(const RJitCacheEntry &entry)
+{
+   const auto &cacheDir = entry.fCacheDir;
+   if (!gSystem->AccessPathName(GetJitCacheIndexFile(cacheDir, entry.fFunctionName).c_str()) ||
+       IsRecentJitCacheFile(GetJitCacheFailureMarker(cacheDir, entry.fFunctionName)))
+      return false;
+   const auto claim = GetJitCacheClaim(cacheDir, entry.fFunctionName);
+   // mkdir fails if the directory exists, which makes the claim atomic. Stale claims are taken over.
+   if (gSystem->mkdir(claim.c_str()) == 0)
+      return true;
+   if (IsRecentJitCacheFile(claim))
+      return false;
+   gSystem->Unlink(claim.c_str());
+   return gSystem->mkdir(claim.c_str()) == 0;
+}
+
+/// Compile the lambda expressions, together with the instantiations of the helpers that book the corresponding nodes,
+/// into one library in the jitting cache so that following processes can load it instead of jitting the expressions.
+/// The library is built in a temporary directory that is then renamed, and an index file per expression names the
+/// library that contains it. Return false if the compilation failed.
+bool CompileJitCacheBatch(const std::string &cacheDir, const std::vector<RJitCacheEntry> &entries)
+{
+   std::string batchKey;
+   for (const auto &entry : entries)
+      batchKey += entry.fFunctionName;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(batchKey.data()), batchKey.size());
+   md5.Final();
+   const auto batchName = std::string("rdfjit_batch_") + md5.AsString();
+
+   const auto buildDir = cacheDir + '/' + batchName + '.' + std::to_string(gSystem->GetPid()) + ".tmp";
+   if (gSystem->mkdir(buildDir.c_str(), /*recursive=*/true) != 0) {
+      Warning("RDataFrame::Jit", "Could not create directory %s in the jitting cache.", buildDir.c_str());
+      return true; // not a failure of the compilation
+   }
+
+   const auto source = buildDir + '/' + batchName + ".cxx";
+   {
+      std::ofstream out(source);
+      out << "// Generated by RDataFrame for its jitting cache, ROOT " << ROOT_RELEASE << " ("
+          << gROOT->GetGitCommit() << ")\n"
+          << "#include \"ROOT/RDataFrame.hxx\"\n"
+          << "#include \"ROOT/RVec.hxx\"\n"
+          << "#include \"TMath.h\"\n"
+          << "#include <cmath>\n"
+          << "#include <cstddef>\n"
+          << "#include <memory>\n";
+      for (const auto &entry : entries) {
+         const auto &name = entry.fFunctionName;
+         const auto lambdaName = name + "_lambda";
+         std::string signature;
+         std::string helperCall;
+         if (entry.fKind == EJitCachedKind::kFilter) {
+            signature = "std::weak_ptr<ROOT::Detail::RDF::RJittedFilter> *wkJittedNode, "
+                        "std::shared_ptr<ROOT::Detail::RDF::RNodeBase> *prevNodeOnHeap, "
+                        "ROOT::Internal::RDF::RBookedDefines *defines";
+            helperCall = "ROOT::Internal::RDF::JitFilterHelper(" + lambdaName +
+                         ", colsPtr, colsSize, name, wkJittedNode, prevNodeOnHeap, defines);";
+         } else {
+            signature = "ROOT::Detail::RDF::RLoopManager *lm, "
+                        "std::weak_ptr<ROOT::Detail::RDF::RJittedDefine> *wkJittedNode, "
+                        "ROOT::Internal::RDF::RBookedDefines *defines, "
+                        "std::shared_ptr<ROOT::Detail::RDF::RNodeBase> *prevNodeOnHeap";
+            helperCall = "ROOT::Internal::RDF::JitDefineHelper(" + lambdaName +
+                         ", colsPtr, colsSize, name, lm, wkJittedNode, defines, prevNodeOnHeap);";
+         }
+         out << "\nnamespace {\nauto " << lambdaName << " = " << entry.fLambdaExpr << ";\n}\n\n"
+             << "extern \"C\" const char *" << name << "_ret_type()\n{\n   return \"" << entry.fRetType << "\";\n}\n\n"
+             << "extern \"C\" void " << name << "(const char **colsPtr, std::size_t colsSize, const char *name, "
+             << signature << ")\n{\n   " << helperCall << "\n}\n";
+      }
+      if (!out) {
+         RemoveJitCacheBuildDir(buildDir);
+         return true;
+      }
+   }
+
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+      << "Compiling " << entries.size() << " expressions for the jitting cache " << cacheDir;
+   // 'k': keep the library, 'O': optimize, 'c': compile only (the expressions are already jitted in this process),
+   // 's': silence informational output
+   if (!gSystem->CompileMacro(source.c_str(), "kOcs")) {
+      RemoveJitCacheBuildDir(buildDir);
+      return false;
+   }
+
+   // If another process already built the same batch, the rename fails and we use its library
+   if (gSystem->Rename(buildDir.c_str(), (cacheDir + '/' + batchName).c_str()) != 0)
+      RemoveJitCacheBuildDir(buildDir);
+   if (gSystem->AccessPathName(GetJitCacheLibrary(cacheDir, batchName).c_str()))
+      return true;
+   for (const auto &entry : entries)
+      WriteJitCacheFileAtomically(GetJitCacheIndexFile(cacheDir, entry.fFunctionName), batchName + '\n');
+   return true;
+}
+
+/// Return the code that calls the entry point of a cached function, to be used in place of the call to
+/// JitFilterHelper or JitDefineHelper with the jitted lambda. The arguments that follow the lambda are the same.
+std::string GetCachedJitFunctionCall(const RCachedJitFunction &cached, EJitCachedKind kind)
+{
+   const std::string nodeArgs = kind == EJitCachedKind::kFilter
+                                   ? "std::weak_ptr<ROOT::Detail::RDF::RJittedFilter> *, "
+                                     "std::shared_ptr<ROOT::Detail::RDF::RNodeBase> *, "
+                                     "ROOT::Internal::RDF::RBookedDefines *"
+                                   : "ROOT::Detail::RDF::RLoopManager *, "
+                                     "std::weak_ptr<ROOT::Detail::RDF::RJittedDefine> *, "
+                                     "ROOT::Internal::RDF::RBookedDefines *, "
+                                     "std::shared_ptr<ROOT::Detail::RDF::RNodeBase> *";
+   return "reinterpret_cast<void (*)(const char **, std::size_t, const char *, " + nodeArgs + ")>(" +
+          ROOT::Internal::RDF::PrettyPrintAddr(cached.fAddress) + ")(";
+}
+
+/// Return the beginning of the code that books a jitted Filter or Define, i.e. the call to JitFilterHelper or
+/// JitDefineHelper up to the first column name, and the return type of the expression.
+/// If the jitting cache is enabled, the compiled expression is looked up in the cache (and queued to be added to it
+/// if missing), otherwise the lambda is declared to the interpreter.
+std::pair<std::string, std::string> JitLambdaCall(EJitCachedKind kind, const std::string &expr,
+                                                  const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+{
+   const std::string helper = kind == EJitCachedKind::kFilter ? "ROOT::Internal::RDF::JitFilterHelper("
+                                                              : "ROOT::Internal::RDF::JitDefineHelper(";
+   const auto cacheDir = GetJitCacheDir();
+   if (cacheDir.empty()) {
+      const auto lambdaName = DeclareLambda(expr, vars, varTypes);
+      return {helper + lambdaName + ", ", RetTypeOfLambda(lambdaName)};
+   }
+
+   const auto lambdaExpr = BuildLambdaString(expr, vars, varTypes);
+   const auto functionName = GetJitCacheFunctionName(kind, lambdaExpr);
+   const auto cached = GetCachedJitFunction(cacheDir, functionName);
+   if (cached.fAddress)
+      return {GetCachedJitFunctionCall(cached, kind), cached.fRetType};
+
+   const auto lambdaName = DeclareLambda(expr, vars, varTypes);
+   auto retType = RetTypeOfLambda(lambdaName);
+   // the expression is compiled for the cache only on request, see PopulateJitCache
+   {
+      std::lock_guard<std::mutex> lock(GetPendingJitCacheEntriesMutex());
+      GetPendingJitCacheEntries().push_back({cacheDir, functionName, kind, lambdaExpr, retType});
+   }
+   return {helper + lambdaName + ", ", std::move(retType)};
+}
+
+} // anonymous namespace
+
 static void GetTopLevelBranchNamesImpl(TTree &t, std::set<std::string> &bNamesReg, ColumnNames_t &bNames,
                                        std::set<TTree *> &analysedTrees, const std::string friendName = "")
 {
@@ -342,6 +661,47 @@ namespace ROOT {
 namespace Internal {
 namespace RDF {
 
+/// Add the expressions that were jitted because they were missing from the jitting cache to it.
+/// This is only called on request, see ROOT::RDF::PopulateJitCache, so that no compilation delays the event loops
+/// and all missing expressions are compiled into a single library. Concurrent processes do not compile the same
+/// expressions, and expressions that fail to compile are retried after a while.
+void PopulateJitCache()
+{
+   std::vector<RJitCacheEntry> pending;
+   {
+      std::lock_guard<std::mutex> lock(GetPendingJitCacheEntriesMutex());
+      std::swap(pending, GetPendingJitCacheEntries());
+   }
+
+   std::map<std::string, std::vector<RJitCacheEntry>> claimedPerDir;
+   std::unordered_set<std::string> seen;
+   for (auto &entry : pending) {
+      if (!seen.insert(entry.fCacheDir + '/' + entry.fFunctionName).second)
+         continue;
+      if (gSystem->mkdir(entry.fCacheDir.c_str(), /*recursive=*/true) != 0 &&
+          gSystem->AccessPathName(entry.fCacheDir.c_str())) {
+         Warning("RDataFrame::Jit", "Could not create the jitting cache directory %s.", entry.fCacheDir.c_str());
+         continue;
+      }
+      if (ClaimJitCacheEntry(entry))
+         claimedPerDir[entry.fCacheDir].push_back(std::move(entry));
+   }
+
+   for (const auto &dirAndEntries : claimedPerDir) {
+      const auto &cacheDir = dirAndEntries.first;
+      const auto &entries = dirAndEntries.second;
+      // If the batch does not compile, find the culprits by compiling the expressions one by one
+      if (!CompileJitCacheBatch(cacheDir, entries)) {
+         for (const auto &entry : entries) {
+            if (entries.size() == 1 || !CompileJitCacheBatch(cacheDir, {entry}))
+               WriteJitCacheFileAtomically(GetJitCacheFailureMarker(cacheDir, entry.fFunctionName), entry.fLambdaExpr);
+         }
+      }
+      for (const auto &entry : entries)
+         gSystem->Unlink(GetJitCacheClaim(cacheDir, entry.fFunctionName).c_str());
+   }
+}
+
 /// Take a list of column names, return that list with entries starting by '#' filtered out.
 /// The function throws when filtering out a column this way.
 ColumnNames_t FilterArraySizeColNames(const ColumnNames_t &columnNames, const std::string &action)
@@ -635,8 +995,9 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
       ParseRDFExpression(expression, branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Filter", /*vector2rvec=*/true);
-   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
-   const auto type = RetTypeOfLambda(lambdaName);
+   const auto lambdaCall =
+      JitLambdaCall(EJitCachedKind::kFilter, parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
+   const auto &type = lambdaCall.second;
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
@@ -648,7 +1009,7 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
    std::stringstream filterInvocation;
-   filterInvocation << "ROOT::Internal::RDF::JitFilterHelper(" << lambdaName << ", new const char*["
+   filterInvocation << lambdaCall.first << "new const char*["
                     << parsedExpr.fUsedCols.size() << "]{";
    for (const auto &col : parsedExpr.fUsedCols)
       filterInvocation << "\"" << col << "\", ";
@@ -683,15 +1044,16 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
       ParseRDFExpression(expression, branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Define", /*vector2rvec=*/true);
-   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
-   const auto type = RetTypeOfLambda(lambdaName);
+   const auto lambdaCall =
+      JitLambdaCall(EJitCachedKind::kDefine, parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
+   const auto &type = lambdaCall.second;
 
    auto definesCopy = new RBookedDefines(customCols);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm.GetNSlots(), lm.GetDSValuePtrs());
 
    std::stringstream defineInvocation;
-   defineInvocation << "ROOT::Internal::RDF::JitDefineHelper(" << lambdaName << ", new const char*["
+   defineInvocation << lambdaCall.first << "new const char*["
                     << parsedExpr.fUsedCols.size() << "]{";
    for (const auto &col : parsedExpr.fUsedCols) {
       defineInvocation << "\"" << col << "\", ";
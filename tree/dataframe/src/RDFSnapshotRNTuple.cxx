@@ -0,0 +1,233 @@
+/**
+ \file RDFSnapshotRNTuple.cxx
+ \ingroup dataframe
+ \date 2021-10
+*/
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/ActionHelpers.hxx"
+
+#ifdef R__HAS_RNTUPLE
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDS.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RPageSinkBuf.hxx"
+#include "ROOT/RPageStorageFile.hxx"
+#include "TFile.h"
+#endif
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+#ifdef R__HAS_RNTUPLE
+
+namespace RNT = ROOT::Experimental;
+
+namespace {
+
+/// Create the field written for an RDataFrame column of type `colTypeName`.
+/// RVec columns are written as std::vector fields, see RNTupleSnapshotValue; RVec<bool> has its own field.
+std::unique_ptr<RNT::Detail::RFieldBase> CreateSnapshotField(const std::string &colName, const std::string &colTypeName)
+{
+   std::string typeName = colTypeName;
+   const std::string rvecPrefix = "ROOT::VecOps::RVec<";
+   if (typeName.compare(0, rvecPrefix.size(), rvecPrefix) == 0 && typeName != "ROOT::VecOps::RVec<bool>") {
+      const auto itemTypeName = typeName.substr(rvecPrefix.size(), typeName.size() - rvecPrefix.size() - 1);
+      // the items would be copied with the RVec layout into the std::vector field
+      if (itemTypeName.find("RVec<") != std::string::npos)
+         typeName.clear();
+      else
+         typeName = "std::vector<" + itemTypeName + ">";
+   }
+   if (!typeName.empty()) {
+      auto field = RNT::Detail::RFieldBase::Create(colName, typeName);
+      if (field)
+         return field.Unwrap();
+   }
+   throw std::runtime_error("Snapshot: the type \"" + colTypeName + "\" of column \"" + colName +
+                            "\" cannot be written as an RNTuple field.");
+}
+
+} // anonymous namespace
+
+struct RNTupleSnapshotWriter::RImpl {
+   const unsigned int fNSlots;
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const ColumnNames_t fOutputColNames;
+   const std::vector<std::string> fColTypeNames;
+   const RSnapshotOptions fOptions;
+
+   std::unique_ptr<TFile> fOutputFile;
+   /// The model used to create the shared sink. Its fields only describe the schema, they are never filled.
+   std::unique_ptr<RNT::RNTupleModel> fModel;
+   /// The sink writing to fOutputFile, which receives the sealed clusters of all the slots
+   std::unique_ptr<RNT::Detail::RPageSinkSlot::RSharedSink> fSharedSink;
+   /// One writer per slot, each with its own model and an RPageSinkSlot connected to fSharedSink
+   std::vector<std::unique_ptr<RNT::RNTupleWriter>> fWriters;
+   /// One entry per slot, bound to the addresses of the input values right before each Fill
+   std::vector<std::unique_ptr<RNT::REntry>> fEntries;
+
+   RImpl(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+         const ColumnNames_t &outputColNames, const std::vector<std::string> &colTypeNames,
+         const RSnapshotOptions &options)
+      : fNSlots(nSlots), fFileName(fileName), fNTupleName(ntupleName), fOutputColNames(outputColNames),
+        fColTypeNames(colTypeNames), fOptions(options)
+   {
+   }
+
+   /// Create a model with one top-level field per output column.
+   /// If `entry` is not null, it is filled with unmanaged values of the top-level fields, in column order.
+   std::unique_ptr<RNT::RNTupleModel> MakeModel(RNT::REntry *entry) const
+   {
+      auto model = RNT::RNTupleModel::Create();
+      for (std::size_t i = 0; i < fOutputColNames.size(); ++i) {
+         auto field = CreateSnapshotField(fOutputColNames[i], fColTypeNames[i]);
+         if (entry)
+            entry->CaptureValue(field->CaptureValue(nullptr));
+         model->AddField(std::move(field));
+      }
+      return model;
+   }
+
+   RNT::RNTupleWriteOptions GetWriteOptions() const
+   {
+      RNT::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel));
+      // clusters are filled and compressed independently by each slot, no further buffering is needed
+      writeOptions.SetUseBufferedWrite(false);
+      if (fOptions.fAutoFlush > 0)
+         writeOptions.SetNEntriesPerCluster(fOptions.fAutoFlush);
+      return writeOptions;
+   }
+};
+
+RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName,
+                                             const std::string &dirName, const std::string &ntupleName,
+                                             const ColumnNames_t &outputColNames,
+                                             const std::vector<std::string> &colTypeNames,
+                                             const RSnapshotOptions &options)
+   : fImpl(std::make_unique<RImpl>(nSlots, fileName, ntupleName, outputColNames, colTypeNames, options))
+{
+   if (!dirName.empty())
+      throw std::runtime_error("Snapshot: writing an RNTuple in a sub-directory of the output file is not supported.");
+   for (std::size_t i = 0; i < colTypeNames.size(); ++i)
+      CreateSnapshotField(outputColNames[i], colTypeNames[i]);
+   ValidateSnapshotOutput(options, ntupleName, fileName);
+}
+
+RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void RNTupleSnapshotWriter::Initialize()
+{
+   auto &impl = *fImpl;
+   const auto &opts = impl.fOptions;
+   impl.fOutputFile.reset(TFile::Open(impl.fFileName.c_str(), opts.fMode.c_str(), /*ftitle=*/"",
+                                      ROOT::CompressionSettings(opts.fCompressionAlgorithm, opts.fCompressionLevel)));
+   if (!impl.fOutputFile)
+      throw std::runtime_error("Snapshot: could not create output file " + impl.fFileName);
+
+   const auto writeOptions = impl.GetWriteOptions();
+   impl.fModel = impl.MakeModel(nullptr);
+   impl.fSharedSink = std::make_unique<RNT::Detail::RPageSinkSlot::RSharedSink>(
+      std::make_unique<RNT::Detail::RPageSinkFile>(impl.fNTupleName, *impl.fOutputFile, writeOptions));
+   impl.fSharedSink->fSink->Create(*impl.fModel);
+
+   impl.fWriters.clear();
+   impl.fEntries.clear();
+   for (unsigned int slot = 0; slot < impl.fNSlots; ++slot) {
+      auto entry = std::make_unique<RNT::REntry>();
+      auto model = impl.MakeModel(entry.get());
+      auto sink = std::make_unique<RNT::Detail::RPageSinkSlot>(*impl.fSharedSink);
+      impl.fWriters.emplace_back(std::make_unique<RNT::RNTupleWriter>(std::move(model), std::move(sink)));
+      impl.fEntries.emplace_back(std::move(entry));
+   }
+}
+
+void RNTupleSnapshotWriter::Fill(unsigned int slot, void *const *valuePtrs)
+{
+   auto &entry = *fImpl->fEntries[slot];
+   std::size_t i = 0;
+   for (auto &value : entry) {
+      value = value.GetField()->CaptureValue(valuePtrs[i]);
+      ++i;
+   }
+   // commits a cluster to the shared sink every fNEntriesPerCluster entries of this slot
+   fImpl->fWriters[slot]->Fill(entry);
+}
+
+void RNTupleSnapshotWriter::Finalize()
+{
+   auto &impl = *fImpl;
+   // destroying the writers commits the last, partially filled cluster of each slot
+   impl.fWriters.clear();
+   impl.fEntries.clear();
+   impl.fSharedSink->fSink->CommitDataset();
+   // the model must be destructed before the sink its fields are connected to
+   impl.fModel.reset();
+   impl.fSharedSink.reset();
+   impl.fOutputFile->Close();
+   impl.fOutputFile.reset();
+}
+
+std::shared_ptr<ROOT::RDataFrame>
+MakeRNTupleSnapshotDataFrame(const std::string &ntupleName, const std::string &fileName,
+                             const ColumnNames_t &outputColNames, const std::vector<std::string> &colTypeNames)
+{
+   const auto colNames = ReplaceDotWithUnderscore(outputColNames);
+   auto model = RNT::RNTupleModel::Create();
+   for (std::size_t i = 0; i < colNames.size(); ++i)
+      model->AddField(CreateSnapshotField(colNames[i], colTypeNames[i]));
+   // the RNTuple is only opened by the first event loop of the returned RDataFrame, after the Snapshot wrote it
+   return std::make_shared<ROOT::RDataFrame>(std::make_unique<RNT::RNTupleDS>(ntupleName, fileName, std::move(model)),
+                                             colNames);
+}
+
+#else // R__HAS_RNTUPLE
+
+struct RNTupleSnapshotWriter::RImpl {
+};
+
+RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int, const std::string &, const std::string &,
+                                             const std::string &, const ColumnNames_t &,
+                                             const std::vector<std::string> &, const RSnapshotOptions &)
+{
+   throw std::runtime_error("Snapshot: writing an RNTuple requires ROOT to be built with root7=ON.");
+}
+
+RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void RNTupleSnapshotWriter::Initialize() {}
+
+void RNTupleSnapshotWriter::Fill(unsigned int, void *const *) {}
+
+void RNTupleSnapshotWriter::Finalize() {}
+
+std::shared_ptr<ROOT::RDataFrame>
+MakeRNTupleSnapshotDataFrame(const std::string &, const std::string &, const ColumnNames_t &,
+                             const std::vector<std::string> &)
+{
+   throw std::runtime_error("Snapshot: writing an RNTuple requires ROOT to be built with root7=ON.");
+}
+
+#endif // R__HAS_RNTUPLE
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
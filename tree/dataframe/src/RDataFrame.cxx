@@ -83,7 +83,7 @@ Transformations are a way to manipulate the data.
 | DefineSlot() | Same as Define(), but the user-defined function must take an extra `unsigned int slot` as its first parameter. `slot` will take a different value, `0` to `nThreads - 1`, for each thread of execution. This is meant as a helper in writing thread-safe Define() transformation when using RDataFrame after ROOT::EnableImplicitMT(). DefineSlot() works just as well with single-thread execution: in that case `slot` will always be `0`.  |
 | DefineSlotEntry() | Same as DefineSlot(), but the entry number is passed in addition to the slot number. This is meant as a helper in case some dependency on the entry number needs to be honoured. |
 | Filter() | Filter rows based on user-defined conditions. |
-| Range() | Filter rows based on entry number (single-thread only). |
+| Range() | Filter rows based on entry number. |
 
 ### Actions
 Actions aggregate data into a result. Each one is described in more detail in the reference guide.
@@ -405,8 +405,8 @@ auto d15on = d.Range(15, 0);
 // We can specify a stride too, in this case we pick an event every 3
 auto d15each3 = d.Range(0, 15, 3);
 ~~~
-Note that ranges are not available when multi-threading is enabled. More information on ranges is available
-[here](#ranges).
+Note that when multi-threading is enabled ranges select entries in processing order rather than in dataset order.
+More information on ranges is available [here](#ranges).
 
 ### Executing multiple actions in the same event loop
 As a final example let us apply two different cuts on branch "MET" and fill two different histograms with the "pt\_v" of
@@ -673,9 +673,8 @@ that has been run using the relevant RDataFrame.
 
 \anchor ranges
 ### Ranges
-When RDataFrame is not being used in a multi-thread environment (i.e. no call to EnableImplicitMT() was made),
-Range() transformations are available. These act very much like filters but instead of basing their decision on
-a filter expression, they rely on `begin`,`end` and `stride` parameters.
+Range() transformations act very much like filters but instead of basing their decision on a filter expression,
+they rely on `begin`,`end` and `stride` parameters.
 
 - `begin`: initial entry number considered for this range.
 - `end`: final entry number (excluded) considered for this range. 0 means that the range goes until the end of the dataset.
@@ -692,6 +691,11 @@ preceding filter*.
 Ranges allow "early quitting": if all branches of execution of a functional graph reached their `end` value of
 processed entries, the event-loop is immediately interrupted. This is useful for debugging and quick data explorations.
 
+Ranges can also be used in multi-thread event loops. In that case the entries that reach a range node from the
+different threads are counted together, so `Range(10,50)` still lets exactly 40 entries pass, but which entries
+these are depends on the order in which the threads process them, which is not deterministic. As soon as the `end`
+value of all ranges is reached, all threads stop processing entries and the remaining tasks return immediately.
+
 \anchor custom-columns
 ### Custom columns
 Custom columns are created by invoking `Define(name, f, columnList)`. As usual, `f` can be any callable object
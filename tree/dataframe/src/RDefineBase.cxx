@@ -30,7 +30,8 @@ RDefineBase::RDefineBase(std::string_view name, std::string_view type, unsigned
                          const RDFInternal::RBookedDefines &defines,
                          const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
    : fName(name), fType(type), fNSlots(nSlots),
-     fLastCheckedEntry(fNSlots * RDFInternal::CacheLineStep<Long64_t>(), -1), fDefines(defines),
+     fLastCheckedEntry(fNSlots * RDFInternal::CacheLineStep<Long64_t>(), -1),
+     fVariedLastCheckedEntry(fNSlots), fDefines(defines),
      fIsInitialized(nSlots, false), fDSValuePtrs(DSValuePtrs), fDataSource(ds)
 {
 }
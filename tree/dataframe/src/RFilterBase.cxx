@@ -17,7 +17,8 @@ using namespace ROOT::Detail::RDF;
 
 RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const unsigned int nSlots,
                          const RDFInternal::RBookedDefines &defines)
-   : RNodeBase(implPtr), fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
+   : RNodeBase(implPtr), fLastResult(nSlots * RDFInternal::CacheLineStep<int>()), fVariedLastCheckedEntry(nSlots),
+     fVariedLastResult(nSlots),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
      fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fNSlots(nSlots), fDefines(defines)
 {
@@ -51,3 +52,10 @@ void RFilterBase::InitNode()
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
+
+void RFilterBase::InitVariedResults(unsigned int slot)
+{
+   const auto nVariations = fVariationDeps.GetNVariations();
+   fVariedLastCheckedEntry[slot].assign(nVariations, -1);
+   fVariedLastResult[slot].assign(nVariations, true);
+}
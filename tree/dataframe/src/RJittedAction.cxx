@@ -99,3 +99,15 @@ std::function<void(unsigned int)> RJittedAction::GetDataBlockCallback()
    R__ASSERT(fConcreteAction != nullptr);
    return fConcreteAction->GetDataBlockCallback();
 }
+
+std::vector<std::string> RJittedAction::GetVariationNames()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariationNames();
+}
+
+std::unique_ptr<ROOT::Internal::RDF::RActionBase> RJittedAction::MakeVariedAction(std::vector<void *> &&results)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->MakeVariedAction(std::move(results));
+}
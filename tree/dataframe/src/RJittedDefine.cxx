@@ -42,3 +42,12 @@ void RJittedDefine::FinaliseSlot(unsigned int slot)
    R__ASSERT(fConcreteDefine != nullptr);
    fConcreteDefine->FinaliseSlot(slot);
 }
+
+void RJittedDefine::UpdateVariationDeps()
+{
+   // the concrete define is only available after jitting. Before that, no systematic variation can be processed.
+   if (fConcreteDefine == nullptr)
+      return;
+   fConcreteDefine->UpdateVariationDeps();
+   fVariationDeps = fConcreteDefine->GetVariationDeps();
+}
@@ -89,6 +89,13 @@ void RJittedFilter::FinaliseSlot(unsigned int slot)
    fConcreteFilter->FinaliseSlot(slot);
 }
 
+void RJittedFilter::UpdateVariationDeps()
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->UpdateVariationDeps();
+   fVariationDeps = fConcreteFilter->GetVariationDeps();
+}
+
 void RJittedFilter::InitNode()
 {
    R__ASSERT(fConcreteFilter != nullptr);
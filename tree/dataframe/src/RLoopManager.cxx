@@ -389,7 +389,8 @@ void RLoopManager::RunEmptySourceMT()
       InitNodeSlots(nullptr, slot);
       R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+         // processing can be stopped early by ranges, in which case all tasks still to run return immediately
+         for (auto currEntry = range.first; currEntry < range.second && fNStopsReceived < fNChildren; ++currEntry) {
             RunAndCheckFilters(slot, currEntry);
          }
       } catch (...) {
@@ -442,7 +443,8 @@ void RLoopManager::RunTreeProcessorMT()
       auto count = entryCount.fetch_add(nEntries);
       try {
          // recursive call to check filters and conditionally execute actions
-         while (r.Next()) {
+         // processing can be stopped early by ranges, in which case all tasks still to run return immediately
+         while (fNStopsReceived < fNChildren && r.Next()) {
             RunAndCheckFilters(slot, count++);
          }
       } catch (...) {
@@ -530,7 +532,8 @@ void RLoopManager::RunDataSourceMT()
       const auto end = range.second;
       R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
       try {
-         for (auto entry = start; entry < end; ++entry) {
+         // processing can be stopped early by ranges, in which case all tasks still to run return immediately
+         for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
             if (fDataSource->SetEntry(slot, entry)) {
                RunAndCheckFilters(slot, entry);
             }
@@ -544,7 +547,7 @@ void RLoopManager::RunDataSourceMT()
 
    fDataSource->Initialise();
    auto ranges = fDataSource->GetEntryRanges();
-   while (!ranges.empty()) {
+   while (!ranges.empty() && fNStopsReceived < fNChildren) {
       pool.Foreach(runOnRange, ranges);
       ranges = fDataSource->GetEntryRanges();
    }
@@ -19,12 +19,15 @@
 #include <ROOT/RFieldValue.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <TError.h>
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -59,11 +62,9 @@ public:
    // Field is only used for reading
    void GenerateColumnsImpl() final { R__ASSERT(false && "Cardinality fields must only be used for reading"); }
 
-   void GenerateColumnsImpl(const RNTupleDescriptor &) final
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final
    {
-      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
-         ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      GenerateIndexColumn(desc);
       fPrincipalColumn = fColumns[0].get();
    }
 
@@ -250,6 +251,37 @@ RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
    AddField(descriptor, "", descriptor.GetFieldZeroId(), std::vector<DescriptorId_t>());
 }
 
+RNTupleDS::RNTupleDS(std::string_view ntupleName, std::string_view fileName, std::unique_ptr<RNTupleModel> model)
+   : fNTupleName(ntupleName), fFileName(fileName)
+{
+   // Describe the fields of the model as RPageSink::Create() does. The column readers created from this descriptor
+   // are replaced by the ones of the RNTuple on disk in Initialise().
+   RNTupleDescriptorBuilder descBuilder;
+   descBuilder.SetNTuple(fNTupleName, model->GetDescription(), "", model->GetVersion(), model->GetUuid());
+   DescriptorId_t fieldId = 0;
+   auto &fieldZero = *model->GetFieldZero();
+   descBuilder.AddField(RDanglingFieldDescriptor::FromField(fieldZero).FieldId(fieldId).MakeDescriptor().Unwrap());
+   fieldZero.SetOnDiskId(fieldId);
+   for (auto &f : fieldZero) {
+      ++fieldId;
+      descBuilder.AddField(RDanglingFieldDescriptor::FromField(f).FieldId(fieldId).MakeDescriptor().Unwrap());
+      descBuilder.AddFieldLink(f.GetParent()->GetOnDiskId(), fieldId);
+      f.SetOnDiskId(fieldId);
+   }
+
+   const auto &descriptor = descBuilder.GetDescriptor();
+   AddField(descriptor, "", descriptor.GetFieldZeroId(), std::vector<DescriptorId_t>());
+}
+
+void RNTupleDS::AttachSources()
+{
+   for (unsigned int i = fSources.size(); i < fNSlots; ++i) {
+      fSources.emplace_back(fSources[0]->Clone());
+      R__ASSERT(i == (fSources.size() - 1));
+      fSources[i]->Attach();
+   }
+}
+
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
 {
    // This datasource uses the GetColumnReaders2 API instead (better name in the works)
@@ -272,13 +304,83 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::AddClusterSelection(std::string_view colName, double min, double max)
+{
+   if (fSources.empty())
+      throw std::runtime_error("RNTupleDS: cluster selections cannot be added before the RNTuple is written");
+   const auto &desc = fSources[0]->GetDescriptor();
+   const std::string name(colName);
+
+   // Resolve the column name, e.g. "event.id", through the hierarchy of record fields
+   auto fieldId = desc.GetFieldZeroId();
+   std::string::size_type pos = 0;
+   while (true) {
+      if (fieldId != desc.GetFieldZeroId() &&
+          desc.GetFieldDescriptor(fieldId).GetStructure() != ENTupleStructure::kRecord) {
+         throw std::runtime_error("RNTupleDS: cluster selections are not supported for column \"" + name +
+                                  "\", which is part of a collection");
+      }
+      const auto dot = name.find('.', pos);
+      fieldId = desc.FindFieldId(name.substr(pos, (dot == std::string::npos) ? dot : dot - pos), fieldId);
+      if (fieldId == kInvalidDescriptorId)
+         throw std::runtime_error("RNTupleDS: unknown column \"" + name + "\" in cluster selection");
+      if (dot == std::string::npos)
+         break;
+      pos = dot + 1;
+   }
+
+   const auto columnId = desc.FindColumnId(fieldId, 0);
+   bool isArithmetic = false;
+   if (desc.GetFieldDescriptor(fieldId).GetStructure() == ENTupleStructure::kLeaf &&
+       columnId != kInvalidDescriptorId) {
+      switch (desc.GetColumnDescriptor(columnId).GetModel().GetType()) {
+      case EColumnType::kIndex:
+      case EColumnType::kSplitIndex:
+      case EColumnType::kSwitch:
+      case EColumnType::kBit: break;
+      default: isArithmetic = true;
+      }
+   }
+   if (!isArithmetic)
+      throw std::runtime_error("RNTupleDS: cluster selections require a column of arithmetic type, \"" + name +
+                               "\" is of type " + desc.GetFieldDescriptor(fieldId).GetTypeName());
+
+   fClusterSelections.push_back({columnId, min, max});
+}
+
+bool RNTupleDS::IsClusterSelected(const RClusterDescriptor &clusterDesc) const
+{
+   for (const auto &selection : fClusterSelections) {
+      if (!clusterDesc.HasColumnStatistics(selection.fColumnId))
+         continue;
+      const auto &statistics = clusterDesc.GetColumnStatistics(selection.fColumnId);
+      if (statistics.fMax < selection.fMin || statistics.fMin > selection.fMax)
+         return false;
+   }
+   return true;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (!fClusterSelections.empty()) {
+      // One range per cluster, which leaves out the clusters excluded by the cluster selections
+      for (const auto &clusterDesc : fSources[0]->GetDescriptor().GetClusterIterable()) {
+         if ((clusterDesc.GetNEntries() == 0) || !IsClusterSelected(clusterDesc))
+            continue;
+         const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+         ranges.emplace_back(firstEntry, firstEntry + clusterDesc.GetNEntries());
+      }
+      std::sort(ranges.begin(), ranges.end());
+      fHasSeenAllRanges = true;
+      return ranges;
+   }
+
+   // TODO(jblomer): use cluster boundaries for the entry ranges
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -309,6 +411,25 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
 void RNTupleDS::Initialise()
 {
    fHasSeenAllRanges = false;
+   if (!fSources.empty())
+      return;
+
+   // First event loop of a data source created before its RNTuple was written: open the RNTuple and provide the
+   // columns from its descriptor, which must be the ones announced by the model given to the constructor
+   auto pageSource = Detail::RPageSource::Create(fNTupleName, fFileName);
+   pageSource->Attach();
+   fSources.emplace_back(std::move(pageSource));
+   AttachSources();
+
+   const auto columnNames = std::move(fColumnNames);
+   fColumnNames.clear();
+   fColumnTypes.clear();
+   fColumnReaderPrototypes.clear();
+   const auto &descriptor = fSources[0]->GetDescriptor();
+   AddField(descriptor, "", descriptor.GetFieldZeroId(), std::vector<DescriptorId_t>());
+   if (fColumnNames != columnNames)
+      throw std::runtime_error("RNTupleDS: the columns of RNTuple " + fNTupleName + " in " + fFileName +
+                               " differ from the expected ones");
 }
 
 void RNTupleDS::Finalise() {}
@@ -319,11 +440,9 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
 
-   for (unsigned int i = 1; i < fNSlots; ++i) {
-      fSources.emplace_back(fSources[0]->Clone());
-      R__ASSERT(i == (fSources.size() - 1));
-      fSources[i]->Attach();
-   }
+   // otherwise, the sources are attached when the RNTuple is opened by Initialise()
+   if (!fSources.empty())
+      AttachSources();
 }
 } // namespace Experimental
 } // namespace ROOT
@@ -10,16 +10,22 @@
 
 #include "ROOT/RDF/RRangeBase.hxx"
 
+#include <algorithm>
+
 using ROOT::Detail::RDF::RRangeBase;
 using ROOT::Detail::RDF::RLoopManager;
 
 RRangeBase::RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
                        const unsigned int nSlots)
-   : RNodeBase(implPtr), fStart(start), fStop(stop), fStride(stride), fNSlots(nSlots) { }
+   : RNodeBase(implPtr), fStart(start), fStop(stop), fStride(stride), fLastCheckedEntry(nSlots, -1),
+     fLastResult(nSlots, true), fNSlots(nSlots)
+{
+}
 
 void RRangeBase::ResetCounters()
 {
-   fLastCheckedEntry = -1;
+   std::fill(fLastCheckedEntry.begin(), fLastCheckedEntry.end(), -1);
+   std::fill(fLastResult.begin(), fLastResult.end(), true);
    fNProcessedEntries = 0;
    fHasStopped = false;
 }
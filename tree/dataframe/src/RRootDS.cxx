@@ -6,15 +6,20 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RDF/RColumnReaderBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
 #include <ROOT/RRootDS.hxx>
 #include <ROOT/TSeq.hxx>
+#include <TBranch.h>
 #include <TClass.h>
 #include <TError.h>
 #include <TROOT.h>         // For the gROOTMutex
 #include <TVirtualMutex.h> // For the R__LOCKGUARD
 
 #include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace ROOT {
@@ -23,7 +28,45 @@ namespace Internal {
 
 namespace RDF {
 
-std::vector<void *> RRootDS::GetColumnReadersImpl(std::string_view name, const std::type_info &id)
+namespace {
+
+/// Column reader that reads its branch only when the value of the current entry is accessed. Columns that are used
+/// downstream of a Filter are therefore read only for the entries that pass it, and the baskets that contain only
+/// rejected entries are never loaded for those columns.
+class RRootDSColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   TChain &fChain;
+   const std::string fBranchName;
+   void **fValuePtr;            ///< The address that the chain uses for this column in this slot
+   const Long64_t &fLocalEntry; ///< The current entry of the slot, local to the current tree of the chain
+   Long64_t &fLastReadEntry;    ///< Shared by all readers of this column in this slot, to read each entry only once
+   TBranch *fBranch = nullptr;
+   Int_t fTreeNumber = -1; ///< The tree number of the chain fBranch belongs to
+
+   void *GetImpl(Long64_t entry) final
+   {
+      if (entry != fLastReadEntry) {
+         if (fChain.GetTreeNumber() != fTreeNumber) {
+            fBranch = fChain.GetBranch(fBranchName.c_str());
+            fTreeNumber = fChain.GetTreeNumber();
+         }
+         fBranch->GetEntry(fLocalEntry);
+         fLastReadEntry = entry;
+      }
+      return *fValuePtr;
+   }
+
+public:
+   RRootDSColumnReader(TChain &chain, const std::string &branchName, void **valuePtr, const Long64_t &localEntry,
+                       Long64_t &lastReadEntry)
+      : fChain(chain), fBranchName(branchName), fValuePtr(valuePtr), fLocalEntry(localEntry),
+        fLastReadEntry(lastReadEntry)
+   {
+   }
+};
+
+} // anonymous namespace
+
+void RRootDS::CheckColumnType(std::string_view name, const std::type_info &id) const
 {
    const auto colTypeName = GetTypeName(name);
    const auto &colTypeId = ROOT::Internal::RDF::TypeName2TypeID(colTypeName);
@@ -35,14 +78,23 @@ std::vector<void *> RRootDS::GetColumnReadersImpl(std::string_view name, const s
       err += " but a different one has been selected.";
       throw std::runtime_error(err);
    }
+}
+
+std::vector<void *> RRootDS::GetColumnReadersImpl(std::string_view, const std::type_info &)
+{
+   // This data source uses the GetColumnReaders(slot, name, tid) API, which reads the branches lazily
+   return {};
+}
+
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+RRootDS::GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info &tid)
+{
+   CheckColumnType(name, tid);
 
    const auto index =
       std::distance(fListOfBranches.begin(), std::find(fListOfBranches.begin(), fListOfBranches.end(), name));
-   std::vector<void *> ret(fNSlots);
-   for (auto slot : ROOT::TSeqU(fNSlots)) {
-      ret[slot] = (void *)&fBranchAddresses[index][slot];
-   }
-   return ret;
+   return std::make_unique<RRootDSColumnReader>(*fChains[slot], fListOfBranches[index], &fBranchAddresses[index][slot],
+                                                fLocalEntries[slot], fLastReadEntries[index][slot]);
 }
 
 RRootDS::RRootDS(std::string_view treeName, std::string_view fileNameGlob)
@@ -97,7 +149,8 @@ void RRootDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
    auto chain = new TChain(fTreeName.c_str());
    chain->ResetBit(kMustCleanup);
    chain->Add(fFileNameGlob.c_str());
-   chain->GetEntry(firstEntry);
+   // only load the tree: the branches are read on demand by the column readers
+   fLocalEntries[slot] = chain->LoadTree(firstEntry);
    TString setBranches;
    for (auto i : ROOT::TSeqU(fListOfBranches.size())) {
       auto colName = fListOfBranches[i].c_str();
@@ -114,6 +167,8 @@ void RRootDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
          chain->SetBranchAddress(colName, addr);
       }
    }
+   for (auto &lastReadEntries : fLastReadEntries)
+      lastReadEntries[slot] = -1;
    fChains[slot].reset(chain);
 }
 
@@ -130,7 +185,7 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RRootDS::GetEntryRanges()
 
 bool RRootDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   fChains[slot]->GetEntry(entry);
+   fLocalEntries[slot] = fChains[slot]->LoadTree(entry);
    return true;
 }
 
@@ -145,6 +200,8 @@ void RRootDS::SetNSlots(unsigned int nSlots)
    fBranchAddresses.resize(nColumns, std::vector<void *>(fNSlots, nullptr));
 
    fChains.resize(fNSlots);
+   fLocalEntries.resize(fNSlots, -1);
+   fLastReadEntries.resize(nColumns, std::vector<Long64_t>(fNSlots, -1));
 }
 
 void RRootDS::Initialise()
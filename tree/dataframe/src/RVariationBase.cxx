@@ -0,0 +1,119 @@
+/// \file RVariationBase.cxx
+/// \ingroup dataframe
+/// \date 2021-10
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/RVariationReader.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+#include "ROOT/RStringView.hxx"
+
+#include <algorithm>
+#include <cstring> // std::strcmp
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+RVariationBase::RVariationBase(std::string_view columnName, std::string_view variationName,
+                               const std::vector<std::string> &tags, std::string_view type,
+                               ROOT::Detail::RDF::RLoopManager &lm, const RBookedDefines &defines)
+   : fColumnName(columnName), fName(variationName), fTags(tags), fType(type), fNSlots(lm.GetNSlots()),
+     fFirstId(lm.RegisterVariations(tags.size())), fCurrentVariations(lm.GetCurrentVariations()),
+     fLastCheckedEntry(fNSlots * CacheLineStep<Long64_t>(), -1), fDefines(defines), fIsInitialized(fNSlots, false),
+     fDSValuePtrs(lm.GetDSValuePtrs()), fDataSource(lm.GetDataSource())
+{
+}
+
+// pin vtable
+RVariationBase::~RVariationBase() {}
+
+void RVariationDeps::Add(const RVariationBase &variation)
+{
+   if (std::find(fVariations.begin(), fVariations.end(), &variation) == fVariations.end())
+      fVariations.emplace_back(&variation);
+}
+
+void RVariationDeps::Add(const RVariationDeps &other)
+{
+   for (const auto *v : other.fVariations)
+      Add(*v);
+}
+
+std::vector<std::string> RVariationDeps::GetVariationNames() const
+{
+   std::vector<std::string> names;
+   for (const auto *v : fVariations)
+      for (const auto &tag : v->GetTags())
+         names.emplace_back(v->GetName() + ':' + tag);
+   return names;
+}
+
+std::vector<unsigned int> RVariationDeps::GetVariationIds() const
+{
+   std::vector<unsigned int> ids;
+   for (const auto *v : fVariations)
+      for (std::size_t i = 0u; i < v->GetTags().size(); ++i)
+         ids.emplace_back(v->GetFirstId() + i);
+   return ids;
+}
+
+std::size_t RVariationDeps::GetNVariations() const
+{
+   std::size_t n = 0u;
+   for (const auto *v : fVariations)
+      n += v->GetTags().size();
+   return n;
+}
+
+RVariationDeps GetVariationDeps(const std::vector<std::string> &columns, const RBookedDefines &defines)
+{
+   RVariationDeps deps;
+   const auto &variations = defines.GetVariations();
+   const auto &customCols = defines.GetColumns();
+   for (const auto &c : columns) {
+      const auto varIt = variations.find(c);
+      if (varIt != variations.end()) {
+         deps.Add(*varIt->second);
+         continue;
+      }
+      const auto defIt = customCols.find(c);
+      if (defIt != customCols.end()) {
+         defIt->second->UpdateVariationDeps();
+         deps.Add(defIt->second->GetVariationDeps());
+      }
+   }
+   return deps;
+}
+
+void CheckVariationType(const RVariationBase &variation, const std::type_info &tid)
+{
+   const auto &varTId = variation.GetTypeId();
+
+   // Here we compare names and not typeinfos since they may come from two different contexts: a compiled
+   // and a jitted one.
+   if (0 != std::strcmp(varTId.name(), tid.name())) {
+      const auto tName = TypeID2TypeName(tid);
+      const auto varTypeName = TypeID2TypeName(varTId);
+      throw std::runtime_error("RVariationReader: column \"" + variation.GetColumnName() + "\" is being used as " +
+                               (tName.empty() ? std::string(tid.name()) : tName) +
+                               " but its systematic variations have type " +
+                               (varTypeName.empty() ? std::string(varTId.name()) : varTypeName));
+   }
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
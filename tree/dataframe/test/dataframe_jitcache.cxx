@@ -0,0 +1,92 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "TEnv.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+// These tests compile code with ACLiC, which takes a while: they are labelled as long tests.
+
+static std::vector<std::string> ListDirectory(const std::string &dirName)
+{
+   std::vector<std::string> entries;
+   void *dir = gSystem->OpenDirectory(dirName.c_str());
+   if (!dir)
+      return entries;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (std::strcmp(entry, ".") != 0 && std::strcmp(entry, "..") != 0)
+         entries.emplace_back(entry);
+   }
+   gSystem->FreeDirectory(dir);
+   return entries;
+}
+
+static void RemoveDirectory(const std::string &dirName)
+{
+   for (const auto &entry : ListDirectory(dirName)) {
+      const auto path = dirName + '/' + entry;
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(path.c_str(), stat) == 0 && R_ISDIR(stat.fMode))
+         RemoveDirectory(path);
+      else
+         gSystem->Unlink(path.c_str());
+   }
+   gSystem->Unlink(dirName.c_str());
+}
+
+TEST(RDataFrameJitCache, MissAndHit)
+{
+   // restore the configured cache directory whatever the outcome of the test
+   struct JitCacheDirRAII {
+      const std::string fOldValue = gEnv->GetValue("RDataFrame.JitCacheDir", "");
+      JitCacheDirRAII(const std::string &dir) { gEnv->SetValue("RDataFrame.JitCacheDir", dir.c_str()); }
+      ~JitCacheDirRAII() { gEnv->SetValue("RDataFrame.JitCacheDir", fOldValue.c_str()); }
+   };
+
+   const std::string cacheDir = "RDataFrameJitCache_MissAndHit";
+   RemoveDirectory(cacheDir);
+   JitCacheDirRAII cacheDirRAII(cacheDir);
+
+   auto isCacheLoaded = []() {
+      return std::string(gSystem->GetLibraries()).find("rdfjit_batch_") != std::string::npos;
+   };
+   auto book = []() { return ROOT::RDataFrame(10).Define("jitcache_x", "rdfentry_ * 3.").Filter("jitcache_x > 12."); };
+   ASSERT_FALSE(isCacheLoaded());
+
+   // a cache miss jits the expressions, and they are compiled for the cache only on request
+   auto missDf = book();
+   auto missSum = missDf.Sum<double>("jitcache_x");
+   EXPECT_DOUBLE_EQ(105., missSum.GetValue());
+   EXPECT_EQ(5ull, missDf.Count().GetValue());
+   EXPECT_TRUE(ListDirectory(cacheDir).empty());
+   ROOT::RDF::PopulateJitCache();
+   EXPECT_FALSE(isCacheLoaded());
+   unsigned int nIndexFiles = 0;
+   unsigned int nLibraries = 0;
+   for (const auto &entry : ListDirectory(cacheDir)) {
+      EXPECT_EQ(std::string::npos, entry.find(".tmp"));
+      EXPECT_EQ(std::string::npos, entry.find(".building"));
+      EXPECT_EQ(std::string::npos, entry.find(".failed"));
+      if (entry.find(".lib") != std::string::npos)
+         ++nIndexFiles;
+      else if (entry.find("rdfjit_batch_") == 0)
+         ++nLibraries;
+   }
+   EXPECT_EQ(2u, nIndexFiles); // one per expression
+   EXPECT_EQ(1u, nLibraries);  // both compiled together
+   const auto cacheContent = ListDirectory(cacheDir);
+
+   // a cache hit loads the compiled expressions when the nodes are booked
+   auto hitDf = book();
+   EXPECT_TRUE(isCacheLoaded());
+   EXPECT_DOUBLE_EQ(missSum.GetValue(), hitDf.Sum<double>("jitcache_x").GetValue());
+   EXPECT_EQ(5ull, hitDf.Count().GetValue());
+   ROOT::RDF::PopulateJitCache(); // nothing is missing from the cache
+   EXPECT_EQ(cacheContent.size(), ListDirectory(cacheDir).size());
+
+   RemoveDirectory(cacheDir);
+}
@@ -1,6 +1,8 @@
 #include "ROOT/RDataFrame.hxx"
 #include <TROOT.h>
 
+#include <atomic>
+
 #include "gtest/gtest.h"
 
 using namespace ROOT;
@@ -91,18 +93,84 @@ TEST_F(RDFRanges, NoEarlyStopping)
 }
 
 #ifdef R__USE_IMT
-TEST(RDFRangesMT, ThrowIfIMT)
-{
-   bool hasThrown = false;
-   ROOT::EnableImplicitMT();
-   RDataFrame d(0);
-   try {
-      d.Range(0);
-   } catch (const std::exception &e) {
-      hasThrown = true;
-      EXPECT_STREQ(e.what(), "Range was called with ImplicitMT enabled, but multi-thread is not supported.");
-   }
-   EXPECT_TRUE(hasThrown);
+class RDFRangesMT : public ::testing::Test {
+protected:
+   RDFRangesMT() { ROOT::EnableImplicitMT(4); }
+   ~RDFRangesMT() { ROOT::DisableImplicitMT(); }
+};
+
+TEST_F(RDFRangesMT, API)
+{
+   RDataFrame d(1000);
+   auto c1 = d.Range(0).Count();
+   auto c2 = d.Range(10).Count();
+   auto c3 = d.Range(5, 50).Count();
+   auto c4 = d.Range(5, 50, 3).Count();
+   EXPECT_EQ(*c1, 1000u);
+   EXPECT_EQ(*c2, 10u);
+   EXPECT_EQ(*c3, 45u);
+   EXPECT_EQ(*c4, 15u);
+}
+
+TEST_F(RDFRangesMT, FromFilter)
+{
+   RDataFrame d(1000);
+   auto count = d.Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"}).Range(100).Count();
+   auto sum = d.Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"})
+                 .Range(100)
+                 .Define("isEven", [](ULong64_t e) { return int(e % 2 == 0); }, {"rdfentry_"})
+                 .Sum<int>("isEven");
+   EXPECT_EQ(*count, 100u);
+   EXPECT_EQ(*sum, 100);
+}
+
+TEST_F(RDFRangesMT, EarlyStop)
+{
+   // all threads must stop as soon as the range is exhausted
+   std::atomic<ULong64_t> nUpstream(0ull);
+   std::atomic<ULong64_t> nDownstream(0ull);
+   RDataFrame d(1000000);
+   auto c = d.Filter([&nUpstream]() {
+                ++nUpstream;
+                return true;
+             })
+               .Range(100)
+               .Filter([&nDownstream]() {
+                  ++nDownstream;
+                  return true;
+               })
+               .Count();
+   EXPECT_EQ(*c, 100u);
+   // exactly the entries in the range reach the nodes downstream of it
+   EXPECT_EQ(nDownstream.load(), 100u);
+   // the other threads can only process the entries they were already working on when the range stopped
+   EXPECT_LT(nUpstream.load(), 1000000u);
+}
+
+TEST_F(RDFRangesMT, EarlyStopWithSibling)
+{
+   // the nested ranges stop on the same entry, but they must send a single stop signal to the filter:
+   // its other child still needs all the entries
+   std::atomic<ULong64_t> count(0ull);
+   RDataFrame d(1000000);
+   auto f = d.Filter([&count]() {
+      ++count;
+      return true;
+   });
+   auto ranged = f.Range(100).Range(100).Count();
+   auto full = f.Count();
+   EXPECT_EQ(*ranged, 100u);
+   EXPECT_EQ(*full, 1000000u);
+   EXPECT_EQ(count.load(), 1000000u);
+}
+
+TEST_F(RDFRangesMT, MixedWithFullLoop)
+{
+   RDataFrame d(1000);
+   auto ranged = d.Range(10).Count();
+   auto full = d.Count();
+   EXPECT_EQ(*ranged, 10u);
+   EXPECT_EQ(*full, 1000u);
 }
 #endif
 
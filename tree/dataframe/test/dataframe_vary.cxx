@@ -0,0 +1,246 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RResultMap.hxx"
+#include "ROOT/RVec.hxx"
+#include <TH1D.h>
+#include <TROOT.h>
+
+#include <algorithm> // std::min
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::VecOps::RVec;
+
+class RDFVary : public ::testing::TestWithParam<bool> {
+protected:
+   RDFVary() : NSLOTS(GetParam() ? std::min(4u, std::thread::hardware_concurrency()) : 1u)
+   {
+      if (GetParam())
+         ROOT::EnableImplicitMT(NSLOTS);
+   }
+   ~RDFVary()
+   {
+      if (GetParam())
+         ROOT::DisableImplicitMT();
+   }
+   const unsigned int NSLOTS;
+};
+
+TEST_P(RDFVary, SimpleSum)
+{
+   auto sum = ROOT::RDataFrame(10)
+                 .Define("x", [] { return 1; })
+                 .Vary("x", [](int x) { return RVec<int>{x - 1, x + 1}; }, {"x"}, {"down", "up"})
+                 .Sum<int>("x");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "x:down", "x:up"}));
+   EXPECT_EQ(sums["nominal"], 10);
+   EXPECT_EQ(sums["x:down"], 0);
+   EXPECT_EQ(sums["x:up"], 20);
+   EXPECT_EQ(*sum, 10);
+}
+
+TEST_P(RDFVary, NamedVariationAndAutoTags)
+{
+   auto sum = ROOT::RDataFrame(10)
+                 .Define("x", [] { return 1; })
+                 .Vary("x", [](int x) { return RVec<int>{x, 2 * x, 3 * x}; }, {"x"}, 3u, "xscale")
+                 .Sum<int>("x");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "xscale:0", "xscale:1", "xscale:2"}));
+   EXPECT_EQ(sums["xscale:0"], 10);
+   EXPECT_EQ(sums["xscale:1"], 20);
+   EXPECT_EQ(sums["xscale:2"], 30);
+}
+
+TEST_P(RDFVary, FilterAndDefineDownstream)
+{
+   std::atomic_int nIndepCalls{0};
+   std::atomic_int nDepCalls{0};
+   auto df = ROOT::RDataFrame(10)
+                .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Define("indep",
+                        [&nIndepCalls](int x) {
+                           ++nIndepCalls;
+                           return x;
+                        },
+                        {"x"})
+                .Vary("x", [](int x) { return RVec<int>{x - 5, x + 5}; }, {"x"}, {"down", "up"})
+                .Define("dep",
+                        [&nDepCalls](int x) {
+                           ++nDepCalls;
+                           return 2 * x;
+                        },
+                        {"x"})
+                .Filter([](int x) { return x >= 5; }, {"x"});
+   auto count = df.Count();
+   auto sumDep = df.Sum<int>("dep");
+   auto sumIndep = df.Sum<int>("indep");
+
+   auto counts = VariationsFor(count);
+   auto sumsDep = VariationsFor(sumDep);
+   auto sumsIndep = VariationsFor(sumIndep);
+
+   // nominal: x in [5, 9]; down: x - 5 in [5, 9] for 5 entries; up: x + 5 >= 5 for all entries
+   EXPECT_EQ(counts["nominal"], 5ull);
+   EXPECT_EQ(counts["x:down"], 0ull);
+   EXPECT_EQ(counts["x:up"], 10ull);
+   EXPECT_EQ(sumsDep["nominal"], 2 * (5 + 6 + 7 + 8 + 9));
+   EXPECT_EQ(sumsDep["x:down"], 0);
+   EXPECT_EQ(sumsDep["x:up"], 2 * (5 + 6 + 7 + 8 + 9 + 10 + 11 + 12 + 13 + 14));
+   // "indep" does not depend on the variation of x, but the filter does
+   EXPECT_EQ(sumsIndep["nominal"], 5 + 6 + 7 + 8 + 9);
+   EXPECT_EQ(sumsIndep["x:down"], 0);
+   EXPECT_EQ(sumsIndep["x:up"], 45);
+
+   // "indep" is evaluated once per entry, independently of the number of variations
+   EXPECT_EQ(nIndepCalls, 10);
+   // "dep" is evaluated once per entry and per variation that passes the filter: 5 nominal, 0 down and 10 up
+   EXPECT_EQ(nDepCalls, 15);
+}
+
+TEST_P(RDFVary, CutFlowReport)
+{
+   std::atomic_int nFilterCalls{0};
+   auto df = ROOT::RDataFrame(10)
+                .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Vary("x", [](int x) { return RVec<int>{x - 5, x + 5}; }, {"x"}, {"down", "up"})
+                .Filter(
+                   [&nFilterCalls](int x) {
+                      ++nFilterCalls;
+                      return x >= 5;
+                   },
+                   {"x"}, "xcut");
+   auto count = df.Count();
+   auto counts = VariationsFor(count);
+   // booked after the varied action, so that for each entry the filter is checked for the nominal values, then for
+   // all variations, then again for the nominal values
+   auto sum = df.Sum<int>("x");
+   auto report = df.Report();
+
+   EXPECT_EQ(counts["nominal"], 5ull);
+   EXPECT_EQ(counts["x:down"], 0ull);
+   EXPECT_EQ(counts["x:up"], 10ull);
+   EXPECT_EQ(*sum, 5 + 6 + 7 + 8 + 9);
+
+   // the cut-flow report only counts the nominal selection, once per entry
+   const auto &xcut = report->At("xcut");
+   EXPECT_EQ(xcut.GetAll(), 10ull);
+   EXPECT_EQ(xcut.GetPass(), 5ull);
+   // the filter is evaluated once per entry and per variation
+   EXPECT_EQ(nFilterCalls, 30);
+}
+
+TEST_P(RDFVary, Histo1D)
+{
+   auto h = ROOT::RDataFrame(10)
+               .Define("x", [] { return 1.; })
+               .Vary("x", [](double x) { return RVec<double>{x - 0.5, x + 0.5}; }, {"x"}, {"down", "up"})
+               .Histo1D<double>({"h", "h", 10, 0, 2}, "x");
+   auto hs = VariationsFor(h);
+
+   EXPECT_DOUBLE_EQ(hs["nominal"].GetMean(), 1.);
+   EXPECT_DOUBLE_EQ(hs["x:down"].GetMean(), 0.5);
+   EXPECT_DOUBLE_EQ(hs["x:up"].GetMean(), 1.5);
+   EXPECT_EQ(hs["x:up"].GetEntries(), 10);
+}
+
+TEST_P(RDFVary, MinMaxMean)
+{
+   auto df = ROOT::RDataFrame(10)
+                .Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                .Vary("x", [](double x) { return RVec<double>{x - 1., x + 1.}; }, {"x"}, {"down", "up"});
+   auto mins = VariationsFor(df.Min<double>("x"));
+   auto maxs = VariationsFor(df.Max<double>("x"));
+   auto means = VariationsFor(df.Mean<double>("x"));
+
+   EXPECT_DOUBLE_EQ(mins["x:down"], -1.);
+   EXPECT_DOUBLE_EQ(maxs["x:up"], 10.);
+   EXPECT_DOUBLE_EQ(means["nominal"], 4.5);
+   EXPECT_DOUBLE_EQ(means["x:down"], 3.5);
+   EXPECT_DOUBLE_EQ(means["x:up"], 5.5);
+}
+
+TEST_P(RDFVary, MultipleVariations)
+{
+   auto sum = ROOT::RDataFrame(10)
+                 .Define("x", [] { return 1; })
+                 .Define("y", [] { return 10; })
+                 .Vary("x", [](int x) { return RVec<int>{x + 1}; }, {"x"}, {"up"})
+                 .Vary("y", [](int y) { return RVec<int>{y + 1}; }, {"y"}, {"up"})
+                 .Define("z", [](int x, int y) { return x + y; }, {"x", "y"})
+                 .Sum<int>("z");
+   auto sums = VariationsFor(sum);
+
+   // variations are applied one at a time
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "x:up", "y:up"}));
+   EXPECT_EQ(sums["nominal"], 110);
+   EXPECT_EQ(sums["x:up"], 120);
+   EXPECT_EQ(sums["y:up"], 120);
+}
+
+TEST_P(RDFVary, NoVariations)
+{
+   auto count = ROOT::RDataFrame(10).Count();
+   auto counts = VariationsFor(count);
+   EXPECT_EQ(counts.GetKeys(), std::vector<std::string>({"nominal"}));
+   EXPECT_EQ(counts["nominal"], 10ull);
+   EXPECT_THROW(counts["x:up"], std::runtime_error);
+}
+
+TEST_P(RDFVary, Errors)
+{
+   auto df = ROOT::RDataFrame(10).Define("x", [] { return 1; });
+   auto vary = [](int x) { return RVec<int>{x}; };
+
+   EXPECT_THROW(df.Vary("x", vary, {"x"}, std::vector<std::string>{}), std::logic_error);
+   EXPECT_THROW(df.Vary("y", vary, {"x"}, {"up"}), std::runtime_error);
+
+   auto varied = df.Vary("x", vary, {"x"}, {"up"}, "xvar");
+   // the same column cannot be varied twice
+   EXPECT_THROW(varied.Vary("x", vary, {"x"}, {"up"}, "other"), std::logic_error);
+   // variation names must be unique
+   auto withY = varied.Define("y", [] { return 2; });
+   EXPECT_THROW(withY.Vary("y", vary, {"y"}, {"up"}, "xvar"), std::logic_error);
+   // the inputs of a variation cannot be varied
+   EXPECT_THROW(withY.Vary("y", vary, {"x"}, {"up"}), std::logic_error);
+
+   // Range is not supported downstream of a varied filter
+   auto ranged = varied.Filter([](int x) { return x > 0; }, {"x"}).Range(2).Count();
+   EXPECT_THROW(VariationsFor(ranged), std::runtime_error);
+}
+
+TEST_P(RDFVary, WrongNumberOfVariations)
+{
+   auto sum = ROOT::RDataFrame(10)
+                 .Define("x", [] { return 1; })
+                 .Vary("x", [](int x) { return RVec<int>{x, x}; }, {"x"}, {"up"})
+                 .Sum<int>("x");
+   auto sums = VariationsFor(sum);
+   EXPECT_THROW(sums["x:up"], std::runtime_error);
+}
+
+TEST_P(RDFVary, AfterEventLoop)
+{
+   auto count = ROOT::RDataFrame(10)
+                   .Define("x", [] { return 1; })
+                   .Vary("x", [](int x) { return RVec<int>{x}; }, {"x"}, {"up"})
+                   .Count();
+   EXPECT_EQ(*count, 10ull);
+   EXPECT_THROW(VariationsFor(count), std::logic_error);
+}
+
+// instantiate single-thread tests
+INSTANTIATE_TEST_SUITE_P(Seq, RDFVary, ::testing::Values(false));
+
+#ifdef R__USE_IMT
+   // instantiate multi-thread tests
+   INSTANTIATE_TEST_SUITE_P(MT, RDFVary, ::testing::Values(true));
+#endif
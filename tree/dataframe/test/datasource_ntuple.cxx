@@ -125,3 +125,39 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+TEST(RNTupleDS, ClusterSelection)
+{
+   const std::string fileName = "RNTupleDS_test_clusterselection.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetHasColumnStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      // Three clusters with pt in [0, 10), [10, 20), and [20, 30)
+      for (int i = 0; i < 30; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   EXPECT_THROW(ds->AddClusterSelection("jets", 0., 1.), std::runtime_error);
+   EXPECT_THROW(ds->AddClusterSelection("xyz", 0., 1.), std::runtime_error);
+   ds->AddClusterSelection("pt", 15., 100.);
+   ROOT::RDataFrame df(std::move(ds));
+
+   // The entries of the first cluster are not read at all
+   auto nRead = df.Count();
+   auto minRead = df.Min<float>("pt");
+   auto nPass = df.Filter([](float pt) { return pt >= 15; }, {"pt"}).Count();
+   EXPECT_EQ(20ull, *nRead);
+   EXPECT_FLOAT_EQ(10.f, *minRead);
+   EXPECT_EQ(15ull, *nPass);
+
+   std::remove(fileName.c_str());
+}
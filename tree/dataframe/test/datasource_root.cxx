@@ -1,3 +1,5 @@
+#include <TEnv.h>
+#include <TFile.h>
 #include <TGraph.h>
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RRootDS.hxx>
@@ -7,9 +9,11 @@
 
 #include <algorithm> // std::accumulate
 #include <iostream>
+#include <memory>
 
 using namespace ROOT;
 using namespace ROOT::RDF;
+using ROOT::Internal::RDF::RRootDS;
 
 auto fileName0 = "TRootTDS_input_0.root";
 auto fileName1 = "TRootTDS_input_1.root";
@@ -74,17 +78,18 @@ TEST(TRootTDS, ColumnReaders)
    RRootDS tds(treeName, fileGlob);
    const auto nSlots = 3U;
    tds.SetNSlots(nSlots);
-   auto vals = tds.GetColumnReaders<int>("i");
    tds.Initialise();
    auto ranges = tds.GetEntryRanges();
    auto slot = 0U;
    for (auto &&range : ranges) {
       tds.InitSlot(slot, range.first);
+      auto reader = tds.GetColumnReaders(slot, "i", typeid(int));
       for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
          tds.SetEntry(slot, i);
-         auto val = **vals[slot];
+         auto val = reader->Get<int>(i);
          EXPECT_EQ(i, val);
       }
+      tds.FinaliseSlot(slot);
       slot++;
    }
 }
@@ -96,7 +101,7 @@ TEST(TRootTDS, ColumnReadersWrongType)
    tds.SetNSlots(nSlots);
    int res = 1;
    try {
-      auto vals = tds.GetColumnReaders<char *>("i");
+      auto reader = tds.GetColumnReaders(0, "i", typeid(char *));
    } catch (const std::runtime_error &e) {
       EXPECT_STREQ("The type of column \"i\" is Int_t but a different one has been selected.", e.what());
       res = 0;
@@ -104,6 +109,34 @@ TEST(TRootTDS, ColumnReadersWrongType)
    EXPECT_EQ(0, res);
 }
 
+TEST(TRootTDS, LazyColumnReaders)
+{
+   RRootDS tds(treeName, fileGlob);
+   tds.SetNSlots(1);
+   tds.Initialise();
+   auto ranges = tds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   tds.InitSlot(0, ranges[0].first);
+   auto readerI = tds.GetColumnReaders(0, "i", typeid(int));
+   auto readerG = tds.GetColumnReaders(0, "g", typeid(TGraph));
+   const TGraph *g = nullptr;
+   for (auto i : ROOT::TSeq<int>(ranges[0].first, ranges[0].second)) {
+      tds.SetEntry(0, i);
+      // "g" is read only for the entries for which it is accessed: the object read at the first entry of each file
+      // is left untouched by the following entries, until it is accessed again
+      const auto iValue = readerI->Get<int>(i);
+      if (iValue % 10 == 0) {
+         g = &readerG->Get<TGraph>(i);
+         EXPECT_EQ(i + 1, g->GetN());
+      } else if (iValue % 10 == 9) {
+         ASSERT_NE(nullptr, g);
+         EXPECT_EQ(i - 8, g->GetN());
+         EXPECT_EQ(i + 1, readerG->Get<TGraph>(i).GetN());
+      }
+   }
+   tds.FinaliseSlot(0);
+}
+
 #ifndef NDEBUG
 
 TEST(TRootTDS, SetNSlotsTwice)
@@ -143,6 +176,42 @@ TEST(TRootTDS, FromARDFWithJitting)
    EXPECT_DOUBLE_EQ(5., *min);
 }
 
+TEST(TRootTDS, FilteredColumnsAreReadLazily)
+{
+   std::unique_ptr<RDataSource> tds(new RRootDS(treeName, fileGlob));
+   RDataFrame tdf(std::move(tds));
+   auto nPoints = tdf.Filter([](int i) { return i % 10 == 9; }, {"i"})
+                     .Define("n", [](const TGraph &g) { return g.GetN(); }, {"g"})
+                     .Take<int>("n");
+   EXPECT_EQ(std::vector<int>({10, 20, 30}), *nPoints);
+}
+
+TEST(TRootTDS, RejectedColumnsAreNotRead)
+{
+   // without prefilling, the TTreeCache only reads the baskets of the branches that are accessed
+   struct PrefillRAII {
+      const int fOldValue = gEnv->GetValue("TTreeCache.Prefill", 1);
+      PrefillRAII() { gEnv->SetValue("TTreeCache.Prefill", 0); }
+      ~PrefillRAII() { gEnv->SetValue("TTreeCache.Prefill", fOldValue); }
+   } prefillRAII;
+
+   // the bytes read by an event loop that uses "g" (or not) for the entries that pass the filter
+   auto bytesRead = [](int minI, bool useG) {
+      RDataFrame tdf(std::make_unique<RRootDS>(treeName, fileGlob));
+      auto filtered = tdf.Filter([minI](int i) { return i >= minI; }, {"i"});
+      auto count = useG ? filtered.Filter([](const TGraph &g) { return g.GetN() > 0; }, {"g"}).Count()
+                        : filtered.Count();
+      const auto before = TFile::GetFileBytesRead();
+      count.GetValue();
+      return TFile::GetFileBytesRead() - before;
+   };
+
+   // all entries are rejected, "g" is never read
+   EXPECT_EQ(bytesRead(30, false), bytesRead(30, true));
+   // check the measurement: "g" is read if entries pass the filter
+   EXPECT_LT(bytesRead(0, false), bytesRead(0, true));
+}
+
 // NOW MT!-------------
 #ifdef R__USE_IMT
 
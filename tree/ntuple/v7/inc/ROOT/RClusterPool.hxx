@@ -115,7 +115,7 @@ private:
    /// The communication channel between the I/O thread and the unzip thread
    std::queue<RUnzipItem> fUnzipQueue;
 
-   /// The I/O thread calls RPageSource::LoadCluster() asynchronously.  The thread is mostly waiting for the
+   /// The I/O thread calls RPageSource::LoadClusters() asynchronously.  The thread is mostly waiting for the
    /// data to arrive (blocked by the kernel) and therefore can safely run in addition to the application
    /// main threads.
    std::thread fThreadIo;
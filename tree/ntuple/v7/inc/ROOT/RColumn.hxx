@@ -25,6 +25,7 @@
 #include <TError.h>
 
 #include <memory>
+#include <type_traits>
 
 namespace ROOT {
 namespace Experimental {
@@ -62,15 +63,46 @@ private:
    ColumnId_t fColumnIdSource;
    /// Used to pack and unpack pages on writing/reading
    std::unique_ptr<RColumnElementBase> fElement;
+   /// Extends a value range by an array of in-memory elements; null for element types without column statistics
+   bool (*fExtendValueRange)(const void *values, std::size_t count, double &min, double &max) = nullptr;
 
    RColumn(const RColumnModel &model, std::uint32_t index);
 
+   template <typename CppT>
+   static bool ExtendValueRangeImpl(const void *values, std::size_t count, double &min, double &max)
+   {
+      auto typedValues = reinterpret_cast<const CppT *>(values);
+      for (std::size_t i = 0; i < count; ++i) {
+         const auto v = static_cast<double>(typedValues[i]);
+         // NaN values fail both comparisons
+         if (v < min)
+            min = v;
+         if (v > max)
+            max = v;
+      }
+      return true;
+   }
+   template <typename CppT>
+   static void SetExtendValueRange(RColumn &column, std::true_type)
+   {
+      column.fExtendValueRange = &ExtendValueRangeImpl<CppT>;
+   }
+   template <typename CppT>
+   static void SetExtendValueRange(RColumn &, std::false_type)
+   {
+   }
+
 public:
    template <typename CppT, EColumnType ColumnT>
    static RColumn *Create(const RColumnModel &model, std::uint32_t index) {
       R__ASSERT(model.GetType() == ColumnT);
       auto column = new RColumn(model, index);
       column->fElement = std::unique_ptr<RColumnElementBase>(new RColumnElement<CppT, ColumnT>(nullptr));
+      // Statistics are only collected for numbers, not for bits, characters, offsets, and switches
+      using HasStatistics_t = std::integral_constant<bool, std::is_arithmetic<CppT>::value &&
+                                                             !std::is_same<CppT, bool>::value &&
+                                                             !std::is_same<CppT, char>::value>;
+      SetExtendValueRange<CppT>(*column, HasStatistics_t());
       return column;
    }
 
@@ -194,6 +226,17 @@ public:
          (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT>::kSize);
    }
 
+   /// Untyped variant of MapV(): the element size is taken from the column element, which describes the in-memory
+   /// (unpacked) representation of the column
+   void *MapRawV(const NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(globalIndex)) {
+         MapPage(globalIndex);
+      }
+      nItems = fCurrentPage.GetGlobalRangeLast() - globalIndex + 1;
+      return static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+             (globalIndex - fCurrentPage.GetGlobalRangeFirst()) * fElement->GetSize();
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fCurrentPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -245,6 +288,12 @@ public:
    void MapPage(const RClusterIndex &clusterIndex);
    NTupleSize_t GetNElements() const { return fNElements; }
    RColumnElementBase *GetElement() const { return fElement.get(); }
+   /// Extends [min, max] by the given in-memory elements of the column, e.g. the ones of a page.  Returns false
+   /// if the column does not support value statistics.
+   bool ExtendValueRange(const void *values, std::size_t count, double &min, double &max) const
+   {
+      return fExtendValueRange && fExtendValueRange(values, count, min, max);
+   }
    const RColumnModel &GetModel() const { return fModel; }
    std::uint32_t GetIndex() const { return fIndex; }
    ColumnId_t GetColumnIdSource() const { return fColumnIdSource; }
@@ -49,6 +49,15 @@ enum class EColumnType {
    kInt64,
    kInt32,
    kInt16,
+   // Split encodings: the bytes of the elements of a page are stored as separate streams, first the least significant
+   // bytes of all elements, then the second least significant bytes etc. Index columns are additionally delta-encoded
+   // with respect to the previous element in the page, integer columns are zig-zag encoded. Both transformations map
+   // the typical values (monotonically increasing offsets, small signed integers) to small unsigned integers whose
+   // higher bytes are mostly zero, which compresses much better than the verbatim representation.
+   kSplitIndex,
+   kSplitInt64,
+   kSplitInt32,
+   kSplitInt16,
 };
 
 // clang-format off
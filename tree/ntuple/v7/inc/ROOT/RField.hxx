@@ -27,16 +27,23 @@
 #include <ROOT/TypeTraits.hxx>
 
 #include <TGenericClassInfo.h>
+#include <TVirtualCollectionProxy.h>
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iostream>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #if __cplusplus >= 201703L
+#include <optional>
 #include <variant>
 #endif
 #include <vector>
@@ -124,6 +131,11 @@ protected:
    /// is not of one of the requested types.
    ROOT::Experimental::EColumnType EnsureColumnType(const std::vector<EColumnType> &requestedTypes,
                                                     unsigned int columnIndex, const RNTupleDescriptor &desc);
+   /// Adds the index column of collection fields, which stores the offsets of the collection items, to fColumns.
+   /// The offsets are written delta-encoded and byte-split (EColumnType::kSplitIndex).
+   void GenerateIndexColumn();
+   /// Like GenerateIndexColumn() but for reading: accepts both the split and the verbatim on-disk index encoding.
+   void GenerateIndexColumn(const RNTupleDescriptor &desc);
 
 public:
    /// Iterates over the sub tree of fields in depth-first search order
@@ -223,6 +235,17 @@ public:
       fPrincipalColumn->Read(clusterIndex, &value->fMappedElement);
    }
 
+   /// Bulk read of the count consecutive values starting at globalIndex into the array pointed to by to, which needs to
+   /// hold count constructed values of the field's type. For simple fields, the values are copied page by page from the
+   /// in-memory pages of the principal column without going through the per-value virtual interface. Other fields
+   /// read value by value.
+   void ReadV(NTupleSize_t globalIndex, NTupleSize_t count, void *to);
+   /// Bulk read of count consecutive values starting at the given cluster-local index, see above
+   void ReadV(const RClusterIndex &clusterIndex, NTupleSize_t count, void *to)
+   {
+      ReadV(fPrincipalColumn->GetGlobalIndex(clusterIndex), count, to);
+   }
+
    /// Ensure that all received items are written from page buffers to the storage.
    void Flush() const;
    /// Perform housekeeping tasks for global to cluster-local index translation
@@ -326,7 +349,12 @@ private:
    std::size_t GetItemPadding(std::size_t baseOffset, std::size_t itemAlignment) const;
 
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   /// Used by fields of C++ types that have the memory layout of a struct with the given members, e.g. std::pair.
+   /// Unlike for untyped records, the value size includes the trailing padding of the C++ type.
+   RRecordField(std::string_view fieldName, std::vector<std::unique_ptr<Detail::RFieldBase>> &&itemFields,
+                std::string_view typeName);
+
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const override;
    void AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void ReadInClusterImpl(const RClusterIndex &clusterIndex, Detail::RFieldValue *value) final;
@@ -349,6 +377,27 @@ public:
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
 };
 
+/// The generic field for std::pair<T1, T2>, a record with the sub fields "first" and "second". It is used as the
+/// item field of std::map and std::unordered_map, whose std::pair<const Key, T> items have the same memory layout.
+class RPairField : public RRecordField {
+private:
+   static std::string GetTypeName(const std::array<std::unique_ptr<Detail::RFieldBase>, 2> &itemFields);
+   static std::vector<std::unique_ptr<Detail::RFieldBase>>
+   MoveItemFields(std::array<std::unique_ptr<Detail::RFieldBase>, 2> &itemFields);
+
+   RPairField(std::string_view fieldName, std::array<std::unique_ptr<Detail::RFieldBase>, 2> &itemFields,
+              std::string_view typeName);
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+
+public:
+   RPairField(std::string_view fieldName, std::array<std::unique_ptr<Detail::RFieldBase>, 2> &&itemFields);
+   RPairField(RPairField &&other) = default;
+   RPairField &operator=(RPairField &&other) = default;
+   ~RPairField() = default;
+};
+
 /// The generic field for a (nested) std::vector<Type> except for std::vector<bool>
 class RVectorField : public Detail::RFieldBase {
 private:
@@ -386,6 +435,49 @@ public:
 };
 
 
+/// The generic field for the associative STL containers std::set, std::unordered_set, std::map and
+/// std::unordered_map. The items are accessed through the TVirtualCollectionProxy of the container class and stored
+/// like the ones of std::vector, i.e. in the columns of the item field, with an index column for the collection
+/// offsets. The items of maps are std::pair<Key, T>, stored by an RPairField.
+class RProxiedCollectionField : public Detail::RFieldBase {
+private:
+   std::unique_ptr<TVirtualCollectionProxy> fProxy;
+   ClusterSize_t fNWritten;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   void AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
+
+public:
+   /// Throws an RException if typeName is not a class with a collection proxy
+   RProxiedCollectionField(std::string_view fieldName, std::string_view typeName,
+                           std::unique_ptr<Detail::RFieldBase> itemField);
+   RProxiedCollectionField(RProxiedCollectionField &&other) = default;
+   RProxiedCollectionField &operator=(RProxiedCollectionField &&other) = default;
+   ~RProxiedCollectionField() = default;
+
+   void GenerateColumnsImpl() final;
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
+   using Detail::RFieldBase::GenerateValue;
+   Detail::RFieldValue GenerateValue(void *where) override;
+   void DestroyValue(const Detail::RFieldValue &value, bool dtorOnly = false) final;
+   Detail::RFieldValue CaptureValue(void *where) final;
+   std::vector<Detail::RFieldValue> SplitValue(const Detail::RFieldValue &value) const final;
+   size_t GetValueSize() const override { return fProxy->Sizeof(); }
+   size_t GetAlignment() const final { return alignof(std::max_align_t); }
+   void CommitCluster() final { fNWritten = 0; }
+   void GetCollectionInfo(NTupleSize_t globalIndex, RClusterIndex *collectionStart, ClusterSize_t *size) const
+   {
+      fPrincipalColumn->GetCollectionInfo(globalIndex, collectionStart, size);
+   }
+   void GetCollectionInfo(const RClusterIndex &clusterIndex, RClusterIndex *collectionStart, ClusterSize_t *size) const
+   {
+      fPrincipalColumn->GetCollectionInfo(clusterIndex, collectionStart, size);
+   }
+};
+
+
 /// The generic field for fixed size arrays, which do not need an offset column
 class RArrayField : public Detail::RFieldBase {
 private:
@@ -457,6 +549,85 @@ public:
 #endif
 
 
+/// The base class for nullable fields, i.e. std::unique_ptr<T> and std::optional<T>. A nullable value is stored as a
+/// collection of zero or one items: the index column gives the number of items (0 or 1) of each entry and the item
+/// field only stores the non-empty values.
+class RNullableField : public Detail::RFieldBase {
+private:
+   ClusterSize_t fNWritten{0};
+
+protected:
+   RNullableField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+
+   /// Append an empty value
+   void AppendNull();
+   /// Append a non-empty value, given the item value
+   void AppendValue(const Detail::RFieldValue &itemValue);
+   /// Returns the index of the item of the given entry in the item field, or an invalid index for empty values
+   RClusterIndex GetItemIndex(NTupleSize_t globalIndex);
+
+public:
+   RNullableField(RNullableField &&other) = default;
+   RNullableField &operator=(RNullableField &&other) = default;
+   ~RNullableField() = default;
+
+   void GenerateColumnsImpl() final;
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
+   void CommitCluster() final { fNWritten = 0; }
+};
+
+/// The generic field for std::unique_ptr<T>. Items are allocated with operator new, so that the unique_ptr can
+/// delete them.
+class RUniquePtrField : public RNullableField {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   void AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
+
+public:
+   RUniquePtrField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+   RUniquePtrField(RUniquePtrField &&other) = default;
+   RUniquePtrField &operator=(RUniquePtrField &&other) = default;
+   ~RUniquePtrField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   Detail::RFieldValue GenerateValue(void *where) override;
+   void DestroyValue(const Detail::RFieldValue &value, bool dtorOnly = false) final;
+   Detail::RFieldValue CaptureValue(void *where) final;
+   std::vector<Detail::RFieldValue> SplitValue(const Detail::RFieldValue &value) const final;
+   size_t GetValueSize() const final { return sizeof(std::unique_ptr<char>); }
+   size_t GetAlignment() const final { return alignof(std::unique_ptr<char>); }
+};
+
+#if __cplusplus >= 201703L
+/// The generic field for std::optional<T>. All standard library implementations store the item at the beginning of
+/// the std::optional, followed by the bool that tells whether the optional has a value.
+class ROptionalField : public RNullableField {
+private:
+   bool *GetEngagementPtr(void *optionalPtr) const;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   void AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
+
+public:
+   ROptionalField(std::string_view fieldName, std::string_view typeName, std::unique_ptr<Detail::RFieldBase> itemField);
+   ROptionalField(ROptionalField &&other) = default;
+   ROptionalField &operator=(ROptionalField &&other) = default;
+   ~ROptionalField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   Detail::RFieldValue GenerateValue(void *where) override;
+   void DestroyValue(const Detail::RFieldValue &value, bool dtorOnly = false) final;
+   Detail::RFieldValue CaptureValue(void *where) final;
+   std::vector<Detail::RFieldValue> SplitValue(const Detail::RFieldValue &value) const final;
+   size_t GetValueSize() const final;
+   size_t GetAlignment() const final { return fSubFields[0]->GetAlignment(); }
+};
+#endif
+
+
 /// Classes with dictionaries that can be inspected by TClass
 template <typename T, typename=void>
 class RField : public RClassField {
@@ -1347,6 +1518,178 @@ public:
 };
 
 
+template <typename T1, typename T2>
+class RField<std::pair<T1, T2>> : public RPairField {
+   using ContainerT = typename std::pair<T1, T2>;
+
+   static std::array<std::unique_ptr<Detail::RFieldBase>, 2> BuildItemFields()
+   {
+      return {std::make_unique<RField<T1>>("first"), std::make_unique<RField<T2>>("second")};
+   }
+
+public:
+   static std::string TypeName() { return "std::pair<" + RField<T1>::TypeName() + "," + RField<T2>::TypeName() + ">"; }
+   explicit RField(std::string_view name) : RPairField(name, BuildItemFields()) {}
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&... args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+};
+
+template <typename ItemT>
+class RField<std::set<ItemT>> : public RProxiedCollectionField {
+   using ContainerT = typename std::set<ItemT>;
+public:
+   static std::string TypeName() { return "std::set<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name)
+      : RProxiedCollectionField(name, TypeName(), std::make_unique<RField<ItemT>>(RField<ItemT>::TypeName()))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&... args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename ItemT>
+class RField<std::unordered_set<ItemT>> : public RProxiedCollectionField {
+   using ContainerT = typename std::unordered_set<ItemT>;
+public:
+   static std::string TypeName() { return "std::unordered_set<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name)
+      : RProxiedCollectionField(name, TypeName(), std::make_unique<RField<ItemT>>(RField<ItemT>::TypeName()))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&... args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename KeyT, typename ValueT>
+class RField<std::map<KeyT, ValueT>> : public RProxiedCollectionField {
+   using ContainerT = typename std::map<KeyT, ValueT>;
+public:
+   static std::string TypeName()
+   {
+      return "std::map<" + RField<KeyT>::TypeName() + "," + RField<ValueT>::TypeName() + ">";
+   }
+   explicit RField(std::string_view name)
+      : RProxiedCollectionField(name, TypeName(),
+                                std::make_unique<RField<std::pair<KeyT, ValueT>>>(
+                                   RField<std::pair<KeyT, ValueT>>::TypeName()))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&... args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename KeyT, typename ValueT>
+class RField<std::unordered_map<KeyT, ValueT>> : public RProxiedCollectionField {
+   using ContainerT = typename std::unordered_map<KeyT, ValueT>;
+public:
+   static std::string TypeName()
+   {
+      return "std::unordered_map<" + RField<KeyT>::TypeName() + "," + RField<ValueT>::TypeName() + ">";
+   }
+   explicit RField(std::string_view name)
+      : RProxiedCollectionField(name, TypeName(),
+                                std::make_unique<RField<std::pair<KeyT, ValueT>>>(
+                                   RField<std::pair<KeyT, ValueT>>::TypeName()))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&... args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+   size_t GetValueSize() const final { return sizeof(ContainerT); }
+};
+
+template <typename ItemT>
+class RField<std::unique_ptr<ItemT>> : public RUniquePtrField {
+   using ContainerT = typename std::unique_ptr<ItemT>;
+public:
+   static std::string TypeName() { return "std::unique_ptr<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name)
+      : RUniquePtrField(name, TypeName(), std::make_unique<RField<ItemT>>(RField<ItemT>::TypeName()))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&... args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+};
+
+#if __cplusplus >= 201703L
+template <typename ItemT>
+class RField<std::optional<ItemT>> : public ROptionalField {
+   using ContainerT = typename std::optional<ItemT>;
+public:
+   static std::string TypeName() { return "std::optional<" + RField<ItemT>::TypeName() + ">"; }
+   explicit RField(std::string_view name)
+      : ROptionalField(name, TypeName(), std::make_unique<RField<ItemT>>(RField<ItemT>::TypeName()))
+   {
+   }
+   RField(RField &&other) = default;
+   RField &operator=(RField &&other) = default;
+   ~RField() = default;
+
+   using Detail::RFieldBase::GenerateValue;
+   template <typename... ArgsT>
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where, ArgsT &&... args)
+   {
+      return Detail::RFieldValue(this, static_cast<ContainerT *>(where), std::forward<ArgsT>(args)...);
+   }
+   ROOT::Experimental::Detail::RFieldValue GenerateValue(void *where) final { return GenerateValue(where, ContainerT()); }
+};
+#endif
+
 /**
  * The RVec type has different layouts depending on the item type, therefore we cannot go with a generic
  * RVec implementation as we can with std::vector
@@ -1402,15 +1745,9 @@ public:
    RField& operator =(RField&& other) = default;
    ~RField() = default;
 
-   void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
-   }
+   void GenerateColumnsImpl() final { GenerateIndexColumn(); }
    // TODO(jblomer): update together with RVec 2.0
-   void GenerateColumnsImpl(const RNTupleDescriptor & /*desc*/) final {
-      GenerateColumnsImpl();
-   }
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final { GenerateIndexColumn(desc); }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
       auto vec = reinterpret_cast<ContainerT*>(value.GetRawPtr());
       auto nItems = vec->size();
@@ -1491,15 +1828,9 @@ public:
    RField& operator =(RField&& other) = default;
    ~RField() = default;
 
-   void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
-   }
+   void GenerateColumnsImpl() final { GenerateIndexColumn(); }
    // TODO(jblomer): update together with RVec 2.0
-   void GenerateColumnsImpl(const RNTupleDescriptor & /*desc*/) final {
-      GenerateColumnsImpl();
-   }
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final { GenerateIndexColumn(desc); }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
       auto vec = reinterpret_cast<ContainerT*>(value.GetRawPtr());
       vec->~RVec();
@@ -189,8 +189,7 @@ public:
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
 
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      // Summary information, such as min/max, is optionally stored separately, see RColumnStatistics
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
@@ -202,6 +201,19 @@ public:
       }
    };
 
+   /// The range of the values of a particular column in a particular cluster.  Only written for columns of
+   /// arithmetic types, if enabled in the write options (see RNTupleWriteOptions::SetHasColumnStatistics()).
+   /// Integer values are stored as doubles; NaN values are not taken into account.
+   struct RColumnStatistics {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      double fMin = 0.0;
+      double fMax = 0.0;
+
+      bool operator==(const RColumnStatistics &other) const {
+         return fColumnId == other.fColumnId && fMin == other.fMin && fMax == other.fMax;
+      }
+   };
+
    /// Records the parition of data into pages for a particular column in a particular cluster
    struct RPageRange {
       /// We do not need to store the element size / uncompressed page size because we know to which column
@@ -262,10 +274,12 @@ private:
 
    std::unordered_map<DescriptorId_t, RColumnRange> fColumnRanges;
    std::unordered_map<DescriptorId_t, RPageRange> fPageRanges;
+   /// Optional; not all columns (or none) need to have statistics
+   std::unordered_map<DescriptorId_t, RColumnStatistics> fColumnStatistics;
 
 public:
    /// In order to handle changes to the serialization routine in future ntuple versions
-   static constexpr std::uint16_t kFrameVersionCurrent = 0;
+   static constexpr std::uint16_t kFrameVersionCurrent = 1;
    static constexpr std::uint16_t kFrameVersionMin = 0;
 
    RClusterDescriptor() = default;
@@ -283,6 +297,14 @@ public:
    RLocator GetLocator() const { return fLocator; }
    const RColumnRange &GetColumnRange(DescriptorId_t columnId) const { return fColumnRanges.at(columnId); }
    const RPageRange &GetPageRange(DescriptorId_t columnId) const { return fPageRanges.at(columnId); }
+   bool HasColumnStatistics(DescriptorId_t columnId) const
+   {
+      return fColumnStatistics.find(columnId) != fColumnStatistics.end();
+   }
+   const RColumnStatistics &GetColumnStatistics(DescriptorId_t columnId) const
+   {
+      return fColumnStatistics.at(columnId);
+   }
    bool ContainsColumn(DescriptorId_t columnId) const;
    std::unordered_set<DescriptorId_t> GetColumnIds() const;
 };
@@ -720,6 +742,7 @@ public:
    void SetClusterLocator(DescriptorId_t clusterId, RClusterDescriptor::RLocator locator);
    void AddClusterColumnRange(DescriptorId_t clusterId, const RClusterDescriptor::RColumnRange &columnRange);
    void AddClusterPageRange(DescriptorId_t clusterId, RClusterDescriptor::RPageRange &&pageRange);
+   void AddClusterColumnStatistics(DescriptorId_t clusterId, const RClusterDescriptor::RColumnStatistics &statistics);
 
    void AddClustersFromFooter(void* footerBuffer);
 
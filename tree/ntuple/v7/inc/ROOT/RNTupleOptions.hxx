@@ -50,6 +50,7 @@ class RNTupleWriteOptions {
    NTupleSize_t fNEntriesPerCluster = 64000;
    NTupleSize_t fNElementsPerPage = 10000;
    bool fUseBufferedWrite = true;
+   bool fHasColumnStatistics = false;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -73,6 +74,11 @@ public:
 
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   bool GetHasColumnStatistics() const { return fHasColumnStatistics; }
+   /// If set, the min/max of the values of every column of arithmetic type is stored per cluster in the footer.
+   /// Readers can use them to skip clusters, see RNTupleDS::AddClusterSelection().
+   void SetHasColumnStatistics(bool val) { fHasColumnStatistics = val; }
 };
 
 // clang-format off
@@ -116,10 +122,14 @@ public:
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
+   /// If set, page sources of local files map the pages of the loaded clusters into memory instead of reading them
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
@@ -20,6 +20,7 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -215,6 +216,26 @@ public:
    MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Copies the values of the count consecutive entries starting at globalIndex into buffer, which must hold count
+   /// constructed objects of type T. Values of simple types are copied page by page.
+   void ReadV(NTupleSize_t globalIndex, NTupleSize_t count, T *buffer) { fField.ReadV(globalIndex, count, buffer); }
+
+   /// Zero-copy bulk access for mappable fields. Calls func(firstIndex, values, nItems) for consecutive chunks of the
+   /// count entries starting at globalIndex, where values points directly into the in-memory page that contains the
+   /// nItems entries starting at firstIndex. The pointer is only valid during the call.
+   template <typename FuncT, typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<RField<C>>::value, void>
+   MapRange(NTupleSize_t globalIndex, NTupleSize_t count, FuncT &&func) {
+      while (count > 0) {
+         NTupleSize_t nItems;
+         const C *values = fField.MapV(globalIndex, nItems);
+         nItems = std::min(nItems, count);
+         func(globalIndex, values, nItems);
+         globalIndex += nItems;
+         count -= nItems;
+      }
+   }
 };
 
 
@@ -23,6 +23,8 @@
 #include <deque>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -128,6 +130,66 @@ public:
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkSlot
+\ingroup NTuple
+\brief Wrapper sink that fills complete clusters on its own and commits them to a sink shared with other slots
+
+Several slot sinks, each one filled by a different thread through its own RNTupleWriter and model clone, can write
+into the same ntuple. Pages are sealed (packed and compressed) by the thread that fills the slot, so that the
+compression of the clusters of different slots runs in parallel. Only committing the sealed pages and the cluster
+to the shared sink is serialized. All slots must be created from clones of the model used to create the shared sink,
+so that they issue the same column ids. The entries of different slots end up in different clusters: the order of
+the entries in the resulting ntuple depends on the order in which slots commit their clusters.
+*/
+// clang-format on
+class RPageSinkSlot : public RPageSink {
+public:
+   /// The sink that receives the sealed pages and clusters of all slots, together with the lock protecting it
+   struct RSharedSink {
+      std::unique_ptr<RPageSink> fSink;
+      std::mutex fLock;
+      /// Number of entries committed to fSink by all slots so far
+      NTupleSize_t fNEntries = 0;
+
+      explicit RSharedSink(std::unique_ptr<RPageSink> sink) : fSink(std::move(sink)) {}
+   };
+
+private:
+   /// A sealed page together with the memory it points to
+   struct RSealedPageBuf {
+      std::unique_ptr<unsigned char[]> fBuf;
+      RPageStorage::RSealedPage fSealedPage;
+   };
+
+   RNTupleMetrics fMetrics;
+   RSharedSink &fShared;
+   /// Sealed pages of the currently open cluster. Indexed by column id.
+   std::vector<std::vector<RSealedPageBuf>> fSealedPages;
+
+   void BufferSealedPage(DescriptorId_t columnId, RSealedPage &&sealedPage, std::unique_ptr<unsigned char[]> buf);
+
+protected:
+   void CreateImpl(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
+   /// The data set is committed by the owner of the shared sink once all the slots are done
+   void CommitDatasetImpl() final {}
+
+public:
+   explicit RPageSinkSlot(RSharedSink &shared);
+   RPageSinkSlot(const RPageSinkSlot&) = delete;
+   RPageSinkSlot& operator=(const RPageSinkSlot&) = delete;
+   virtual ~RPageSinkSlot() = default;
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
@@ -29,6 +29,7 @@
 #include <functional>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -181,6 +182,15 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Keeps track of the value ranges in the currently open cluster if column statistics are enabled in the write
+   /// options. Indexed by column id.
+   struct ROpenColumnStatistics {
+      RClusterDescriptor::RColumnStatistics fStatistics;
+      /// Unset if a page of the column has been committed without access to its values, e.g. as a sealed page
+      bool fIsValid = false;
+   };
+   std::vector<ROpenColumnStatistics> fOpenColumnStatistics;
+   void ResetOpenColumnStatistics();
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model) = 0;
@@ -240,6 +250,9 @@ public:
    /// Write a preprocessed page to storage. The column must have been added before.
    /// TODO(jblomer): allow for vector commit of sealed pages
    void CommitSealedPage(DescriptorId_t columnId, const RPageStorage::RSealedPage &sealedPage);
+   /// Set the value range of a column in the currently open cluster. Used by page sinks that pass on sealed pages to
+   /// another sink, which would otherwise not know the column statistics of the cluster.
+   void SetOpenColumnStatistics(const RClusterDescriptor::RColumnStatistics &statistics);
    /// Finalize the current cluster and create a new one for the following data.
    void CommitCluster(NTupleSize_t nEntries);
    /// Finalize the current cluster and the entrire data set.
@@ -267,6 +280,11 @@ class RPageSource : public RPageStorage {
 public:
    /// Derived from the model (fields) that are actually being requested at a given point in time
    using ColumnSet_t = std::unordered_set<DescriptorId_t>;
+   /// The columns of a cluster that should be loaded in one go, see LoadClusters()
+   struct RClusterRequest {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      ColumnSet_t fColumns;
+   };
 
 protected:
    /// Default I/O performance counters that get registered in fMetrics
@@ -367,6 +385,11 @@ public:
    /// LoadCluster() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+   /// Populates the pages of several clusters; the returned vector contains the loaded clusters in the order of
+   /// `requests`.  The default implementation calls LoadCluster() for every request in turn.  Page sources
+   /// can override the method in order to issue the reads of all the clusters at once, so that the storage can
+   /// have many read requests in flight (e.g. through io_uring for local files).
+   virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RClusterRequest> &requests);
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
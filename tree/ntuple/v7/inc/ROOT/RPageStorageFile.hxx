@@ -19,6 +19,7 @@
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <array>
@@ -26,15 +27,12 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 class TFile;
 
 namespace ROOT {
 
-namespace Internal {
-class RRawFile;
-}
-
 namespace Experimental {
 namespace Detail {
 
@@ -133,6 +131,13 @@ private:
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Creates the cluster and its page map for the given columns and appends the (coalesced) read requests that
+   /// fill the page map to `readRequests`.  The cluster's pages are populated once the requests are read.
+   std::unique_ptr<RCluster> PrepareSingleCluster(DescriptorId_t clusterId, const ColumnSet_t &columns,
+                                                  std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
+   /// Creates the cluster with a page map that points into a memory mapping of the byte range of its pages;
+   /// used instead of PrepareSingleCluster if the read options ask for mmap and the file supports it.
+   std::unique_ptr<RCluster> MapSingleCluster(DescriptorId_t clusterId, const ColumnSet_t &columns);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -158,6 +163,7 @@ public:
                        RSealedPage &sealedPage) final;
 
    std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+   std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RClusterRequest> &requests) final;
 };
 
 
@@ -120,12 +120,24 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
          }
       }
 
-      for (auto &item : readItems) {
-         if (item.fClusterId == kInvalidDescriptorId)
-            return;
+      // The sentinel item stops the thread once the preceding items have been processed
+      bool isStopped = false;
+      std::vector<RPageSource::RClusterRequest> clusterRequests;
+      for (const auto &item : readItems) {
+         if (item.fClusterId == kInvalidDescriptorId) {
+            isStopped = true;
+            break;
+         }
+         clusterRequests.push_back({item.fClusterId, item.fColumns});
+      }
+      readItems.resize(clusterRequests.size());
 
-         // TODO(jblomer): the page source needs to be capable of loading multiple clusters in one go
-         auto cluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+      // Load all the queued clusters in one go, which lets the page source have their reads in flight at once
+      auto clusters = fPageSource.LoadClusters(clusterRequests);
+
+      for (std::size_t i = 0; i < readItems.size(); ++i) {
+         auto &item = readItems[i];
+         auto &cluster = clusters[i];
 
          // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
          // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
@@ -149,6 +161,9 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             fCvHasUnzipWork.notify_one();
          }
       }
+
+      if (isStopped)
+         return;
    } // while (true)
 }
 
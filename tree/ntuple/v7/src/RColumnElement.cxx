@@ -21,8 +21,84 @@
 #include <bitset>
 #include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+/// Maps signed integers of small magnitude to unsigned integers of small magnitude: 0 -> 0, -1 -> 1, 1 -> 2, ...
+template <typename SignedT>
+typename std::make_unsigned<SignedT>::type ZigZagEncode(SignedT value)
+{
+   using UnsignedT = typename std::make_unsigned<SignedT>::type;
+   return static_cast<UnsignedT>(static_cast<UnsignedT>(value) << 1) ^
+          static_cast<UnsignedT>(value >> (sizeof(SignedT) * 8 - 1));
+}
+
+template <typename SignedT>
+SignedT ZigZagDecode(typename std::make_unsigned<SignedT>::type value)
+{
+   using UnsignedT = typename std::make_unsigned<SignedT>::type;
+   return static_cast<SignedT>(static_cast<UnsignedT>(value >> 1) ^ static_cast<UnsignedT>(0 - (value & 1)));
+}
+
+/// Writes the little-endian bytes of encode(0), ..., encode(count - 1) as sizeof(UnsignedT) consecutive byte streams.
+/// The loops have no dependencies between iterations so that the compiler can vectorize them.
+template <typename UnsignedT, typename EncodeT>
+void SplitPack(void *dst, std::size_t count, EncodeT encode)
+{
+   auto bytes = reinterpret_cast<unsigned char *>(dst);
+   for (std::size_t b = 0; b < sizeof(UnsignedT); ++b) {
+      auto stream = bytes + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         stream[i] = static_cast<unsigned char>(encode(i) >> (8 * b));
+   }
+}
+
+/// Inverse of SplitPack without the encoding step: gathers the byte streams into unsigned integers
+template <typename UnsignedT>
+void SplitUnpack(UnsignedT *dst, const void *src, std::size_t count)
+{
+   auto bytes = reinterpret_cast<const unsigned char *>(src);
+   for (std::size_t i = 0; i < count; ++i)
+      dst[i] = bytes[i];
+   for (std::size_t b = 1; b < sizeof(UnsignedT); ++b) {
+      auto stream = bytes + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] |= static_cast<UnsignedT>(static_cast<UnsignedT>(stream[i]) << (8 * b));
+   }
+}
+
+/// Zig-zag and split encoding of integers of type CppT (signed or unsigned) into a column of SignedT integers
+template <typename CppT, typename SignedT>
+void ZigZagSplitPack(void *dst, const void *src, std::size_t count)
+{
+   using UnsignedT = typename std::make_unsigned<SignedT>::type;
+   auto values = reinterpret_cast<const CppT *>(src);
+   SplitPack<UnsignedT>(dst, count, [values](std::size_t i) { return ZigZagEncode(static_cast<SignedT>(values[i])); });
+}
+
+template <typename CppT, typename SignedT>
+void ZigZagSplitUnpack(void *dst, const void *src, std::size_t count)
+{
+   using UnsignedT = typename std::make_unsigned<SignedT>::type;
+   auto values = reinterpret_cast<CppT *>(dst);
+   if (sizeof(CppT) == sizeof(SignedT)) {
+      // decode in place
+      auto encoded = reinterpret_cast<UnsignedT *>(dst);
+      SplitUnpack(encoded, src, count);
+      for (std::size_t i = 0; i < count; ++i)
+         values[i] = static_cast<CppT>(ZigZagDecode<SignedT>(encoded[i]));
+   } else {
+      auto encoded = std::make_unique<UnsignedT[]>(count);
+      SplitUnpack(encoded.get(), src, count);
+      for (std::size_t i = 0; i < count; ++i)
+         values[i] = static_cast<CppT>(ZigZagDecode<SignedT>(encoded[i]));
+   }
+}
+
+} // anonymous namespace
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -44,6 +120,14 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -71,6 +155,14 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kSplitIndex:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kSplitInt16:
+      return 16;
    default:
       R__ASSERT(false);
    }
@@ -98,6 +190,14 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kSplitIndex:
+      return "SplitIndex";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case EColumnType::kSplitInt16:
+      return "SplitInt16";
    default:
       return "UNKNOWN";
    }
@@ -157,3 +257,107 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
       int64Array[i] = int32Array[i];
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+   ROOT::Experimental::EColumnType::kSplitIndex>::Pack(void *dst, void *src, std::size_t count) const
+{
+   using Value_t = ClusterSize_t::ValueType;
+   auto index = reinterpret_cast<const Value_t *>(src);
+   // delta encoding with respect to the previous element in the page
+   SplitPack<Value_t>(dst, count,
+                      [index](std::size_t i) -> Value_t { return (i == 0) ? index[0] : index[i] - index[i - 1]; });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+   ROOT::Experimental::EColumnType::kSplitIndex>::Unpack(void *dst, void *src, std::size_t count) const
+{
+   using Value_t = ClusterSize_t::ValueType;
+   auto index = reinterpret_cast<Value_t *>(dst);
+   SplitUnpack(index, src, count);
+   for (std::size_t i = 1; i < count; ++i)
+      index[i] += index[i - 1];
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitPack<std::int16_t, std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitUnpack<std::int16_t, std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitPack<std::uint16_t, std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitUnpack<std::uint16_t, std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitPack<std::int32_t, std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitUnpack<std::int32_t, std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitPack<std::uint32_t, std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitUnpack<std::uint32_t, std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitPack<std::int64_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitUnpack<std::int64_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitPack<std::uint64_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitUnpack<std::uint64_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitPack<std::int64_t, std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigZagSplitUnpack<std::int64_t, std::int32_t>(dst, src, count);
+}
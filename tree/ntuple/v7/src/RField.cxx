@@ -29,13 +29,15 @@
 #include <TDataMember.h>
 #include <TError.h>
 #include <TList.h>
+#include <TVirtualCollectionProxy.h>
 
 #include <algorithm>
 #include <cctype> // for isspace
 #include <cstdlib> // for malloc, free
-#include <cstring> // for memset
+#include <cstring> // for memset, memcpy
 #include <exception>
 #include <iostream>
+#include <new> // for operator new, operator delete
 #include <type_traits>
 
 namespace {
@@ -98,8 +100,10 @@ std::string GetNormalizedType(const std::string &typeName) {
    if (normalizedType == "unsigned char") normalizedType = "std::uint8_t";
    if (normalizedType == "uint8_t") normalizedType = "std::uint8_t";
    if (normalizedType == "Short_t") normalizedType = "std::int16_t";
+   if (normalizedType == "short") normalizedType = "std::int16_t";
    if (normalizedType == "int16_t") normalizedType = "std::int16_t";
    if (normalizedType == "UShort_t") normalizedType = "std::uint16_t";
+   if (normalizedType == "unsigned short") normalizedType = "std::uint16_t";
    if (normalizedType == "uint16_t") normalizedType = "std::uint16_t";
    if (normalizedType == "Int_t") normalizedType = "std::int32_t";
    if (normalizedType == "int") normalizedType = "std::int32_t";
@@ -110,13 +114,25 @@ std::string GetNormalizedType(const std::string &typeName) {
    if (normalizedType == "uint32_t") normalizedType = "std::uint32_t";
    if (normalizedType == "Long64_t") normalizedType = "std::int64_t";
    if (normalizedType == "Long_t") normalizedType = "std::int64_t";
+   if (normalizedType == "long") normalizedType = "std::int64_t";
+   if (normalizedType == "long long") normalizedType = "std::int64_t";
    if (normalizedType == "int64_t") normalizedType = "std::int64_t";
    if (normalizedType == "ULong64_t") normalizedType = "std::uint64_t";
+   if (normalizedType == "ULong_t") normalizedType = "std::uint64_t";
+   if (normalizedType == "unsigned long") normalizedType = "std::uint64_t";
+   if (normalizedType == "unsigned long long") normalizedType = "std::uint64_t";
    if (normalizedType == "uint64_t") normalizedType = "std::uint64_t";
    if (normalizedType == "string") normalizedType = "std::string";
    if (normalizedType.substr(0, 7) == "vector<") normalizedType = "std::" + normalizedType;
    if (normalizedType.substr(0, 6) == "array<") normalizedType = "std::" + normalizedType;
    if (normalizedType.substr(0, 8) == "variant<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 5) == "pair<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 4) == "set<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 14) == "unordered_set<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 4) == "map<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 14) == "unordered_map<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 11) == "unique_ptr<") normalizedType = "std::" + normalizedType;
+   if (normalizedType.substr(0, 9) == "optional<") normalizedType = "std::" + normalizedType;
 
    return normalizedType;
 }
@@ -194,8 +210,49 @@ ROOT::Experimental::Detail::RFieldBase::Create(const std::string &fieldName, con
       auto arrayLength = std::stoi(arrayDef[1]);
       auto itemField = Create(GetNormalizedType(arrayDef[0]), arrayDef[0]);
       result = std::make_unique<RArrayField>(fieldName, itemField.Unwrap(), arrayLength);
+   } else if (normalizedType.substr(0, 10) == "std::pair<") {
+      auto innerTypes = TokenizeTypeList(normalizedType.substr(10, normalizedType.length() - 11));
+      if (innerTypes.size() != 2)
+         return R__FAIL("the type list for std::pair must have exactly two elements");
+      std::array<std::unique_ptr<RFieldBase>, 2> items{Create("first", innerTypes[0]).Unwrap(),
+                                                       Create("second", innerTypes[1]).Unwrap()};
+      result = std::make_unique<RPairField>(fieldName, std::move(items));
+   } else if (normalizedType.substr(0, 9) == "std::set<") {
+      std::string itemTypeName = normalizedType.substr(9, normalizedType.length() - 10);
+      auto itemField = Create(GetNormalizedType(itemTypeName), itemTypeName).Unwrap();
+      auto typeName = "std::set<" + itemField->GetType() + ">";
+      result = std::make_unique<RProxiedCollectionField>(fieldName, typeName, std::move(itemField));
+   } else if (normalizedType.substr(0, 19) == "std::unordered_set<") {
+      std::string itemTypeName = normalizedType.substr(19, normalizedType.length() - 20);
+      auto itemField = Create(GetNormalizedType(itemTypeName), itemTypeName).Unwrap();
+      auto typeName = "std::unordered_set<" + itemField->GetType() + ">";
+      result = std::make_unique<RProxiedCollectionField>(fieldName, typeName, std::move(itemField));
+   } else if (normalizedType.substr(0, 9) == "std::map<" || normalizedType.substr(0, 19) == "std::unordered_map<") {
+      auto prefixLength = normalizedType.find('<') + 1;
+      auto innerTypes =
+         TokenizeTypeList(normalizedType.substr(prefixLength, normalizedType.length() - prefixLength - 1));
+      if (innerTypes.size() != 2)
+         return R__FAIL("the type list for " + normalizedType.substr(0, prefixLength - 1) +
+                        " must have exactly two elements");
+      std::array<std::unique_ptr<RFieldBase>, 2> items{Create("first", innerTypes[0]).Unwrap(),
+                                                       Create("second", innerTypes[1]).Unwrap()};
+      auto typeList = items[0]->GetType() + "," + items[1]->GetType();
+      auto itemField = std::make_unique<RPairField>("std::pair<" + typeList + ">", std::move(items));
+      auto typeName = normalizedType.substr(0, prefixLength) + typeList + ">";
+      result = std::make_unique<RProxiedCollectionField>(fieldName, typeName, std::move(itemField));
+   } else if (normalizedType.substr(0, 16) == "std::unique_ptr<") {
+      std::string itemTypeName = normalizedType.substr(16, normalizedType.length() - 17);
+      auto itemField = Create(GetNormalizedType(itemTypeName), itemTypeName).Unwrap();
+      auto typeName = "std::unique_ptr<" + itemField->GetType() + ">";
+      result = std::make_unique<RUniquePtrField>(fieldName, typeName, std::move(itemField));
    }
 #if __cplusplus >= 201703L
+   if (normalizedType.substr(0, 14) == "std::optional<") {
+      std::string itemTypeName = normalizedType.substr(14, normalizedType.length() - 15);
+      auto itemField = Create(GetNormalizedType(itemTypeName), itemTypeName).Unwrap();
+      auto typeName = "std::optional<" + itemField->GetType() + ">";
+      result = std::make_unique<ROptionalField>(fieldName, typeName, std::move(itemField));
+   }
    if (normalizedType.substr(0, 13) == "std::variant<") {
       auto innerTypes = TokenizeTypeList(normalizedType.substr(13, normalizedType.length() - 14));
       std::vector<RFieldBase *> items;
@@ -330,6 +387,51 @@ ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureCo
 }
 
 
+void ROOT::Experimental::Detail::RFieldBase::ReadV(NTupleSize_t globalIndex, NTupleSize_t count, void *to)
+{
+   auto dst = static_cast<unsigned char *>(to);
+   const auto valueSize = GetValueSize();
+   if (!fIsSimple) {
+      for (NTupleSize_t i = 0; i < count; ++i) {
+         auto value = CaptureValue(dst + i * valueSize);
+         Read(globalIndex + i, &value);
+      }
+      return;
+   }
+
+   R__ASSERT(fPrincipalColumn->GetElement()->GetSize() == valueSize);
+   while (count > 0) {
+      NTupleSize_t nItems;
+      auto src = fPrincipalColumn->MapRawV(globalIndex, nItems);
+      nItems = std::min(nItems, count);
+      memcpy(dst, src, nItems * valueSize);
+      dst += nItems * valueSize;
+      globalIndex += nItems;
+      count -= nItems;
+   }
+}
+
+void ROOT::Experimental::Detail::RFieldBase::GenerateIndexColumn()
+{
+   RColumnModel modelIndex(EColumnType::kSplitIndex, true /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(modelIndex, 0)));
+}
+
+void ROOT::Experimental::Detail::RFieldBase::GenerateIndexColumn(const RNTupleDescriptor &desc)
+{
+   auto type = EnsureColumnType({EColumnType::kSplitIndex, EColumnType::kIndex}, 0, desc);
+   RColumnModel modelIndex(type, true /* isSorted*/);
+   if (type == EColumnType::kSplitIndex) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex>(modelIndex, 0)));
+   } else {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
+}
+
+
 void ROOT::Experimental::Detail::RFieldBase::ConnectPageSink(RPageSink &pageSink)
 {
    R__ASSERT(fColumns.empty());
@@ -430,15 +532,12 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   GenerateIndexColumn();
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   GenerateIndexColumn(desc);
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -573,15 +672,22 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int16_t, EColumnType::kInt16>(model, 0)));
+   RColumnModel model(EColumnType::kSplitInt16, false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<std::int16_t, EColumnType::kSplitInt16>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt16, EColumnType::kInt16}, 0, desc);
+   RColumnModel model(type, false /* isSorted*/);
+   if (type == EColumnType::kSplitInt16) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int16_t, EColumnType::kSplitInt16>(model, 0)));
+   } else {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int16_t, EColumnType::kInt16>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -593,15 +699,22 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::uint16_t, EColumnType::kInt16>(model, 0)));
+   RColumnModel model(EColumnType::kSplitInt16, false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<std::uint16_t, EColumnType::kSplitInt16>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt16, EColumnType::kInt16}, 0, desc);
+   RColumnModel model(type, false /* isSorted*/);
+   if (type == EColumnType::kSplitInt16) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint16_t, EColumnType::kSplitInt16>(model, 0)));
+   } else {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint16_t, EColumnType::kInt16>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -613,15 +726,22 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+   RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<std::int32_t, EColumnType::kSplitInt32>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt32, EColumnType::kInt32}, 0, desc);
+   RColumnModel model(type, false /* isSorted*/);
+   if (type == EColumnType::kSplitInt32) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int32_t, EColumnType::kSplitInt32>(model, 0)));
+   } else {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int32_t, EColumnType::kInt32>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -633,15 +753,22 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+      Detail::RColumn::Create<std::uint32_t, EColumnType::kSplitInt32>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt32, EColumnType::kInt32}, 0, desc);
+   RColumnModel model(type, false /* isSorted*/);
+   if (type == EColumnType::kSplitInt32) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint32_t, EColumnType::kSplitInt32>(model, 0)));
+   } else {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -653,15 +780,22 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitInt64, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+      Detail::RColumn::Create<std::uint64_t, EColumnType::kSplitInt64>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt64}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt64, EColumnType::kInt64}, 0, desc);
+   RColumnModel model(type, false /* isSorted*/);
+   if (type == EColumnType::kSplitInt64) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint64_t, EColumnType::kSplitInt64>(model, 0)));
+   } else {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -673,19 +807,30 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
+   RColumnModel model(EColumnType::kSplitInt64, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+      Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt64>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kInt32}, 0, desc);
+   auto type = EnsureColumnType(
+      {EColumnType::kSplitInt64, EColumnType::kInt64, EColumnType::kSplitInt32, EColumnType::kInt32}, 0, desc);
    RColumnModel model(type, false /* isSorted*/);
-   if (type == EColumnType::kInt64) {
+   switch (type) {
+   case EColumnType::kSplitInt64:
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt64>(model, 0)));
+      break;
+   case EColumnType::kInt64:
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
-   } else {
+      break;
+   case EColumnType::kSplitInt32:
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt32>(model, 0)));
+      break;
+   default:
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt32>(model, 0)));
    }
@@ -700,9 +845,7 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateIndexColumn();
 
    RColumnModel modelChars(EColumnType::kByte, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
@@ -711,9 +854,12 @@ void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   GenerateIndexColumn(desc);
+
    EnsureColumnType({EColumnType::kByte}, 1, desc);
-   GenerateColumnsImpl();
+   RColumnModel modelChars(EColumnType::kByte, false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<char, EColumnType::kByte>(modelChars, 1)));
 }
 
 void ROOT::Experimental::RField<std::string>::AppendImpl(const ROOT::Experimental::Detail::RFieldValue& value)
@@ -877,6 +1023,20 @@ ROOT::Experimental::RRecordField::RRecordField(
    }
 }
 
+ROOT::Experimental::RRecordField::RRecordField(std::string_view fieldName,
+                                               std::vector<std::unique_ptr<Detail::RFieldBase>> &&itemFields,
+                                               std::string_view typeName)
+   : ROOT::Experimental::Detail::RFieldBase(fieldName, typeName, ENTupleStructure::kRecord, false /* isSimple */)
+{
+   for (auto &item : itemFields) {
+      fMaxAlignment = std::max(fMaxAlignment, item->GetAlignment());
+      fSize += GetItemPadding(fSize, item->GetAlignment()) + item->GetValueSize();
+      Attach(std::move(item));
+   }
+   // Trailing padding: the size of a C++ type is a multiple of its alignment
+   fSize += GetItemPadding(fSize, fMaxAlignment);
+}
+
 
 std::size_t ROOT::Experimental::RRecordField::GetItemPadding(std::size_t baseOffset, std::size_t itemAlignment) const
 {
@@ -975,6 +1135,45 @@ void ROOT::Experimental::RRecordField::AcceptVisitor(Detail::RFieldVisitor &visi
 
 //------------------------------------------------------------------------------
 
+std::string
+ROOT::Experimental::RPairField::GetTypeName(const std::array<std::unique_ptr<Detail::RFieldBase>, 2> &itemFields)
+{
+   return "std::pair<" + itemFields[0]->GetType() + "," + itemFields[1]->GetType() + ">";
+}
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>>
+ROOT::Experimental::RPairField::MoveItemFields(std::array<std::unique_ptr<Detail::RFieldBase>, 2> &itemFields)
+{
+   std::vector<std::unique_ptr<Detail::RFieldBase>> result;
+   for (auto &item : itemFields)
+      result.emplace_back(std::move(item));
+   return result;
+}
+
+ROOT::Experimental::RPairField::RPairField(std::string_view fieldName,
+                                           std::array<std::unique_ptr<Detail::RFieldBase>, 2> &itemFields,
+                                           std::string_view typeName)
+   : ROOT::Experimental::RRecordField(fieldName, MoveItemFields(itemFields), typeName)
+{
+}
+
+ROOT::Experimental::RPairField::RPairField(std::string_view fieldName,
+                                           std::array<std::unique_ptr<Detail::RFieldBase>, 2> &&itemFields)
+   : RPairField(fieldName, itemFields, GetTypeName(itemFields))
+{
+   R__ASSERT(fSubFields[0]->GetName() == "first" && fSubFields[1]->GetName() == "second");
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RPairField::CloneImpl(std::string_view newName) const
+{
+   std::array<std::unique_ptr<Detail::RFieldBase>, 2> cloneItems{fSubFields[0]->Clone(fSubFields[0]->GetName()),
+                                                                 fSubFields[1]->Clone(fSubFields[1]->GetName())};
+   return std::make_unique<RPairField>(newName, std::move(cloneItems));
+}
+
+//------------------------------------------------------------------------------
+
 
 ROOT::Experimental::RVectorField::RVectorField(
    std::string_view fieldName, std::unique_ptr<Detail::RFieldBase> itemField)
@@ -1022,15 +1221,12 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateIndexColumn();
 }
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   GenerateIndexColumn(desc);
 }
 
 ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RVectorField::GenerateValue(void* where)
@@ -1084,6 +1280,105 @@ void ROOT::Experimental::RVectorField::AcceptVisitor(Detail::RFieldVisitor &visi
 //------------------------------------------------------------------------------
 
 
+ROOT::Experimental::RProxiedCollectionField::RProxiedCollectionField(std::string_view fieldName,
+                                                                     std::string_view typeName,
+                                                                     std::unique_ptr<Detail::RFieldBase> itemField)
+   : ROOT::Experimental::Detail::RFieldBase(fieldName, typeName, ENTupleStructure::kCollection, false /* isSimple */),
+     fNWritten(0)
+{
+   auto cl = TClass::GetClass(std::string(typeName).c_str());
+   if (cl == nullptr || cl->GetCollectionProxy() == nullptr)
+      throw RException(R__FAIL(std::string(typeName) + " has no collection proxy"));
+   fProxy.reset(cl->GetCollectionProxy()->Generate());
+   Attach(std::move(itemField));
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RProxiedCollectionField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::make_unique<RProxiedCollectionField>(newName, GetType(), std::move(newItemField));
+}
+
+void ROOT::Experimental::RProxiedCollectionField::AppendImpl(const Detail::RFieldValue &value)
+{
+   TVirtualCollectionProxy::TPushPop RAII(fProxy.get(), value.GetRawPtr());
+   const auto count = fProxy->Size();
+   for (unsigned i = 0; i < count; ++i) {
+      auto itemValue = fSubFields[0]->CaptureValue(fProxy->At(i));
+      fSubFields[0]->Append(itemValue);
+   }
+   Detail::RColumnElement<ClusterSize_t> elemIndex(&fNWritten);
+   fNWritten += count;
+   fColumns[0]->Append(elemIndex);
+}
+
+void ROOT::Experimental::RProxiedCollectionField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   ClusterSize_t nItems;
+   RClusterIndex collectionStart;
+   fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nItems);
+
+   TVirtualCollectionProxy::TPushPop RAII(fProxy.get(), value->GetRawPtr());
+   // Clears the container and provides a staging area of nItems constructed items that Commit() inserts
+   void *env = fProxy->Allocate(nItems, true /* forceDelete */);
+   const auto itemSize = fSubFields[0]->GetValueSize();
+   if (nItems > 0 && fSubFields[0]->IsSimple() && fProxy->GetIncrement() == itemSize) {
+      // The staging area is contiguous: read all the items in one go from the mapped pages
+      fSubFields[0]->ReadV(collectionStart, nItems, fProxy->At(0));
+   } else {
+      for (unsigned i = 0; i < nItems; ++i) {
+         auto itemValue = fSubFields[0]->CaptureValue(fProxy->At(i));
+         fSubFields[0]->Read(collectionStart + i, &itemValue);
+      }
+   }
+   fProxy->Commit(env);
+}
+
+void ROOT::Experimental::RProxiedCollectionField::GenerateColumnsImpl()
+{
+   GenerateIndexColumn();
+}
+
+void ROOT::Experimental::RProxiedCollectionField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
+{
+   GenerateIndexColumn(desc);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RProxiedCollectionField::GenerateValue(void *where)
+{
+   fProxy->New(where);
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+void ROOT::Experimental::RProxiedCollectionField::DestroyValue(const Detail::RFieldValue &value, bool dtorOnly)
+{
+   fProxy->Destructor(value.GetRawPtr(), true /* dtorOnly */);
+   if (!dtorOnly)
+      free(value.GetRawPtr());
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RProxiedCollectionField::CaptureValue(void *where)
+{
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+std::vector<ROOT::Experimental::Detail::RFieldValue>
+ROOT::Experimental::RProxiedCollectionField::SplitValue(const Detail::RFieldValue &value) const
+{
+   TVirtualCollectionProxy::TPushPop RAII(fProxy.get(), value.GetRawPtr());
+   const auto count = fProxy->Size();
+   std::vector<Detail::RFieldValue> result;
+   for (unsigned i = 0; i < count; ++i) {
+      result.emplace_back(fSubFields[0]->CaptureValue(fProxy->At(i)));
+   }
+   return result;
+}
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RField<std::vector<bool>>::RField(std::string_view name)
    : ROOT::Experimental::Detail::RFieldBase(name, "std::vector<bool>", ENTupleStructure::kCollection,
                                             false /* isSimple */)
@@ -1123,15 +1418,12 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateIndexColumn();
 }
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   GenerateIndexColumn(desc);
 }
 
 std::vector<ROOT::Experimental::Detail::RFieldValue>
@@ -1397,6 +1689,225 @@ void ROOT::Experimental::RVariantField::CommitCluster()
 //------------------------------------------------------------------------------
 
 
+ROOT::Experimental::RNullableField::RNullableField(std::string_view fieldName, std::string_view typeName,
+                                                   std::unique_ptr<Detail::RFieldBase> itemField)
+   : ROOT::Experimental::Detail::RFieldBase(fieldName, typeName, ENTupleStructure::kCollection, false /* isSimple */)
+{
+   Attach(std::move(itemField));
+}
+
+void ROOT::Experimental::RNullableField::GenerateColumnsImpl()
+{
+   GenerateIndexColumn();
+}
+
+void ROOT::Experimental::RNullableField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
+{
+   GenerateIndexColumn(desc);
+}
+
+void ROOT::Experimental::RNullableField::AppendNull()
+{
+   Detail::RColumnElement<ClusterSize_t> elemIndex(&fNWritten);
+   fColumns[0]->Append(elemIndex);
+}
+
+void ROOT::Experimental::RNullableField::AppendValue(const Detail::RFieldValue &itemValue)
+{
+   fSubFields[0]->Append(itemValue);
+   Detail::RColumnElement<ClusterSize_t> elemIndex(&fNWritten);
+   fNWritten += 1;
+   fColumns[0]->Append(elemIndex);
+}
+
+ROOT::Experimental::RClusterIndex ROOT::Experimental::RNullableField::GetItemIndex(NTupleSize_t globalIndex)
+{
+   ClusterSize_t nItems;
+   RClusterIndex collectionStart;
+   fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nItems);
+   R__ASSERT(nItems <= 1);
+   return (nItems == 0) ? RClusterIndex() : collectionStart;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RUniquePtrField::RUniquePtrField(std::string_view fieldName, std::string_view typeName,
+                                                     std::unique_ptr<Detail::RFieldBase> itemField)
+   : RNullableField(fieldName, typeName, std::move(itemField))
+{
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RUniquePtrField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::make_unique<RUniquePtrField>(newName, GetType(), std::move(newItemField));
+}
+
+void ROOT::Experimental::RUniquePtrField::AppendImpl(const Detail::RFieldValue &value)
+{
+   auto typedValue = value.Get<std::unique_ptr<char>>();
+   if (*typedValue) {
+      auto itemValue = fSubFields[0]->CaptureValue(typedValue->get());
+      AppendValue(itemValue);
+   } else {
+      AppendNull();
+   }
+}
+
+void ROOT::Experimental::RUniquePtrField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   auto ptr = value->Get<std::unique_ptr<char>>();
+   const auto itemIndex = GetItemIndex(globalIndex);
+   if (itemIndex.GetIndex() == kInvalidClusterIndex) {
+      if (*ptr) {
+         auto itemValue = fSubFields[0]->CaptureValue(ptr->get());
+         fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+         operator delete(ptr->release());
+      }
+      return;
+   }
+
+   // Reuse the item of the previous entry, if any
+   if (!*ptr) {
+      void *item = operator new(fSubFields[0]->GetValueSize());
+      fSubFields[0]->GenerateValue(item);
+      ptr->reset(static_cast<char *>(item));
+   }
+   auto itemValue = fSubFields[0]->CaptureValue(ptr->get());
+   fSubFields[0]->Read(itemIndex, &itemValue);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RUniquePtrField::GenerateValue(void *where)
+{
+   return Detail::RFieldValue(this, static_cast<std::unique_ptr<char> *>(where));
+}
+
+void ROOT::Experimental::RUniquePtrField::DestroyValue(const Detail::RFieldValue &value, bool dtorOnly)
+{
+   auto ptr = value.Get<std::unique_ptr<char>>();
+   if (*ptr) {
+      auto itemValue = fSubFields[0]->CaptureValue(ptr->get());
+      fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+      operator delete(ptr->release());
+   }
+   ptr->~unique_ptr();
+   if (!dtorOnly)
+      free(ptr);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RUniquePtrField::CaptureValue(void *where)
+{
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+std::vector<ROOT::Experimental::Detail::RFieldValue>
+ROOT::Experimental::RUniquePtrField::SplitValue(const Detail::RFieldValue &value) const
+{
+   std::vector<Detail::RFieldValue> result;
+   auto ptr = value.Get<std::unique_ptr<char>>();
+   if (*ptr)
+      result.emplace_back(fSubFields[0]->CaptureValue(ptr->get()));
+   return result;
+}
+
+//------------------------------------------------------------------------------
+
+#if __cplusplus >= 201703L
+ROOT::Experimental::ROptionalField::ROptionalField(std::string_view fieldName, std::string_view typeName,
+                                                   std::unique_ptr<Detail::RFieldBase> itemField)
+   : RNullableField(fieldName, typeName, std::move(itemField))
+{
+}
+
+bool *ROOT::Experimental::ROptionalField::GetEngagementPtr(void *optionalPtr) const
+{
+   return reinterpret_cast<bool *>(static_cast<unsigned char *>(optionalPtr) + fSubFields[0]->GetValueSize());
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::ROptionalField::CloneImpl(std::string_view newName) const
+{
+   auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+   return std::make_unique<ROptionalField>(newName, GetType(), std::move(newItemField));
+}
+
+void ROOT::Experimental::ROptionalField::AppendImpl(const Detail::RFieldValue &value)
+{
+   if (*GetEngagementPtr(value.GetRawPtr())) {
+      auto itemValue = fSubFields[0]->CaptureValue(value.GetRawPtr());
+      AppendValue(itemValue);
+   } else {
+      AppendNull();
+   }
+}
+
+void ROOT::Experimental::ROptionalField::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   auto optionalPtr = value->GetRawPtr();
+   auto isEngaged = GetEngagementPtr(optionalPtr);
+   const auto itemIndex = GetItemIndex(globalIndex);
+   if (itemIndex.GetIndex() == kInvalidClusterIndex) {
+      if (*isEngaged) {
+         auto itemValue = fSubFields[0]->CaptureValue(optionalPtr);
+         fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+         *isEngaged = false;
+      }
+      return;
+   }
+
+   if (!*isEngaged) {
+      fSubFields[0]->GenerateValue(optionalPtr);
+      *isEngaged = true;
+   }
+   auto itemValue = fSubFields[0]->CaptureValue(optionalPtr);
+   fSubFields[0]->Read(itemIndex, &itemValue);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::ROptionalField::GenerateValue(void *where)
+{
+   memset(where, 0, GetValueSize());
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+void ROOT::Experimental::ROptionalField::DestroyValue(const Detail::RFieldValue &value, bool dtorOnly)
+{
+   auto optionalPtr = value.GetRawPtr();
+   if (*GetEngagementPtr(optionalPtr)) {
+      auto itemValue = fSubFields[0]->CaptureValue(optionalPtr);
+      fSubFields[0]->DestroyValue(itemValue, true /* dtorOnly */);
+   }
+   if (!dtorOnly)
+      free(optionalPtr);
+}
+
+ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::ROptionalField::CaptureValue(void *where)
+{
+   return Detail::RFieldValue(true /* captureFlag */, this, where);
+}
+
+std::vector<ROOT::Experimental::Detail::RFieldValue>
+ROOT::Experimental::ROptionalField::SplitValue(const Detail::RFieldValue &value) const
+{
+   std::vector<Detail::RFieldValue> result;
+   if (*GetEngagementPtr(value.GetRawPtr()))
+      result.emplace_back(fSubFields[0]->CaptureValue(value.GetRawPtr()));
+   return result;
+}
+
+size_t ROOT::Experimental::ROptionalField::GetValueSize() const
+{
+   // The item followed by the engagement flag, padded to the alignment of the item
+   const auto alignment = fSubFields[0]->GetAlignment();
+   const auto size = fSubFields[0]->GetValueSize() + sizeof(bool);
+   return (size + alignment - 1) / alignment * alignment;
+}
+#endif
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RCollectionField::RCollectionField(
    std::string_view name,
    std::shared_ptr<RCollectionNTupleWriter> collectionNTuple,
@@ -1414,15 +1925,12 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateIndexColumn();
 }
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   GenerateIndexColumn(desc);
 }
 
 
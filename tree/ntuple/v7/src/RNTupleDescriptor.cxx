@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <utility>
 
@@ -245,6 +246,43 @@ std::uint32_t DeserializeColumnRange(const void *buffer,
    return 20;
 }
 
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   std::memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double *val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, &bits);
+   std::memcpy(val, &bits, sizeof(bits));
+   return nbytes;
+}
+
+std::uint32_t SerializeColumnStatistics(const ROOT::Experimental::RClusterDescriptor::RColumnStatistics &val,
+                                        void *buffer)
+{
+   if (buffer != nullptr) {
+      auto pos = reinterpret_cast<unsigned char *>(buffer);
+      pos += SerializeUInt64(val.fColumnId, pos);
+      pos += SerializeDouble(val.fMin, pos);
+      pos += SerializeDouble(val.fMax, pos);
+   }
+   return 24;
+}
+
+std::uint32_t DeserializeColumnStatistics(const void *buffer,
+   ROOT::Experimental::RClusterDescriptor::RColumnStatistics *statistics)
+{
+   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   bytes += DeserializeUInt64(bytes, &statistics->fColumnId);
+   bytes += DeserializeDouble(bytes, &statistics->fMin);
+   bytes += DeserializeDouble(bytes, &statistics->fMax);
+   return 24;
+}
+
 std::uint32_t SerializePageInfo(const ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo &val, void *buffer)
 {
    // To keep the cluster footers small, we don't put a frame around individual page infos.
@@ -352,6 +390,17 @@ std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescript
    pos += SerializeUInt64(val.GetNEntries(), *where);
    pos += SerializeLocator(val.GetLocator(), *where);
 
+   // Added in frame version 1; older readers skip the column statistics
+   std::vector<ROOT::Experimental::DescriptorId_t> statisticsIds;
+   for (auto columnId : val.GetColumnIds()) {
+      if (val.HasColumnStatistics(columnId))
+         statisticsIds.emplace_back(columnId);
+   }
+   std::sort(statisticsIds.begin(), statisticsIds.end());
+   pos += SerializeUInt32(statisticsIds.size(), *where);
+   for (auto columnId : statisticsIds)
+      pos += SerializeColumnStatistics(val.GetColumnStatistics(columnId), *where);
+
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
    return size;
@@ -464,7 +513,8 @@ bool ROOT::Experimental::RClusterDescriptor::operator==(const RClusterDescriptor
           fNEntries == other.fNEntries &&
           fLocator == other.fLocator &&
           fColumnRanges == other.fColumnRanges &&
-          fPageRanges == other.fPageRanges;
+          fPageRanges == other.fPageRanges &&
+          fColumnStatistics == other.fColumnStatistics;
 }
 
 
@@ -861,6 +911,17 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
       pos += DeserializeLocator(pos, &locator);
       SetClusterLocator(clusterId, locator);
 
+      // Clusters written before frame version 1 have no column statistics
+      if (pos < clusterBase + frameSize) {
+         std::uint32_t nStatistics;
+         pos += DeserializeUInt32(pos, &nStatistics);
+         for (std::uint32_t j = 0; j < nStatistics; ++j) {
+            RClusterDescriptor::RColumnStatistics statistics;
+            pos += DeserializeColumnStatistics(pos, &statistics);
+            AddClusterColumnStatistics(clusterId, statistics);
+         }
+      }
+
       pos = clusterBase + frameSize;
 
       std::uint32_t nColumns;
@@ -1010,6 +1071,12 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterPageRange(
    fDescriptor.fClusterDescriptors[clusterId].fPageRanges.emplace(pageRange.fColumnId, std::move(pageRange));
 }
 
+void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterColumnStatistics(
+   DescriptorId_t clusterId, const RClusterDescriptor::RColumnStatistics &statistics)
+{
+   fDescriptor.fClusterDescriptors[clusterId].fColumnStatistics[statistics.fColumnId] = statistics;
+}
+
 void ROOT::Experimental::RNTupleDescriptorBuilder::Reset()
 {
    fDescriptor.fName = "";
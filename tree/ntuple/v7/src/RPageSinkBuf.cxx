@@ -17,8 +17,11 @@
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 
+#include <cstring>
+
 ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink> inner)
    : RPageSink(inner->GetNTupleName(), inner->GetWriteOptions())
    , fMetrics("RPageSinkBuf")
@@ -100,6 +103,11 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
          ReleasePage(bufPage.fPage);
       }
    }
+   // The inner sink receives sealed pages, from which it cannot compute the column statistics
+   for (const auto &statistics : fOpenColumnStatistics) {
+      if (statistics.fIsValid)
+         fInnerSink->SetOpenColumnStatistics(statistics.fStatistics);
+   }
    fInnerSink->CommitCluster(nEntries);
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
@@ -121,3 +129,89 @@ void ROOT::Experimental::Detail::RPageSinkBuf::ReleasePage(RPage &page)
 {
    fInnerSink->ReleasePage(page);
 }
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::Detail::RPageSinkSlot::RPageSinkSlot(RSharedSink &shared)
+   : RPageSink(shared.fSink->GetNTupleName(), shared.fSink->GetWriteOptions()), fMetrics("RPageSinkSlot"),
+     fShared(shared)
+{
+}
+
+void ROOT::Experimental::Detail::RPageSinkSlot::CreateImpl(const RNTupleModel & /* model */)
+{
+   fSealedPages.resize(fLastColumnId);
+}
+
+void ROOT::Experimental::Detail::RPageSinkSlot::BufferSealedPage(DescriptorId_t columnId, RSealedPage &&sealedPage,
+                                                                 std::unique_ptr<unsigned char[]> buf)
+{
+   // Uncompressed, mappable pages are sealed in place: copy them since the page memory is reused by the column
+   if (sealedPage.fBuffer != buf.get()) {
+      memcpy(buf.get(), sealedPage.fBuffer, sealedPage.fSize);
+      sealedPage.fBuffer = buf.get();
+   }
+   RSealedPageBuf item;
+   item.fBuf = std::move(buf);
+   item.fSealedPage = std::move(sealedPage);
+   fSealedPages.at(columnId).emplace_back(std::move(item));
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkSlot::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   // Sealing happens in the thread that fills this slot, before taking the lock on the shared sink
+   auto buf = std::make_unique<unsigned char[]>(page.GetSize());
+   auto sealedPage =
+      SealPage(page, *columnHandle.fColumn->GetElement(), GetWriteOptions().GetCompression(), buf.get());
+   BufferSealedPage(columnHandle.fId, std::move(sealedPage), std::move(buf));
+   // we're feeding bad locators to fOpenPageRanges but it should not matter
+   // because they never get written out
+   return RClusterDescriptor::RLocator{};
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkSlot::CommitSealedPageImpl(DescriptorId_t columnId,
+                                                               const RSealedPage &sealedPage)
+{
+   auto buf = std::make_unique<unsigned char[]>(sealedPage.fSize);
+   BufferSealedPage(columnId, RSealedPage(sealedPage.fBuffer, sealedPage.fSize, sealedPage.fNElements),
+                    std::move(buf));
+   return RClusterDescriptor::RLocator{};
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkSlot::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
+{
+   {
+      std::lock_guard<std::mutex> guard(fShared.fLock);
+      for (DescriptorId_t columnId = 0; columnId < fSealedPages.size(); ++columnId) {
+         for (const auto &item : fSealedPages[columnId])
+            fShared.fSink->CommitSealedPage(columnId, item.fSealedPage);
+         if (fOpenColumnStatistics[columnId].fIsValid)
+            fShared.fSink->SetOpenColumnStatistics(fOpenColumnStatistics[columnId].fStatistics);
+      }
+      // nEntries counts the entries of this slot only, the shared sink needs the global entry count
+      fShared.fNEntries += nEntries - fPrevClusterNEntries;
+      fShared.fSink->CommitCluster(fShared.fNEntries);
+   }
+   for (auto &pages : fSealedPages)
+      pages.clear();
+   return RClusterDescriptor::RLocator{};
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkSlot::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      nElements = GetWriteOptions().GetNElementsPerPage();
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSinkSlot::ReleasePage(RPage &page)
+{
+   RPageAllocatorHeap::DeletePage(page);
+}
@@ -104,6 +104,12 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFri
             auto pageRange = c.GetPageRange(originColumnId).Clone();
             pageRange.fColumnId = virtualColumnId;
             fBuilder.AddClusterPageRange(fNextId, std::move(pageRange));
+
+            if (c.HasColumnStatistics(originColumnId)) {
+               auto statistics = c.GetColumnStatistics(originColumnId);
+               statistics.fColumnId = virtualColumnId;
+               fBuilder.AddClusterColumnStatistics(fNextId, statistics);
+            }
          }
          fIdBiMap.Insert({i, c.GetId()}, fNextId);
          fNextId++;
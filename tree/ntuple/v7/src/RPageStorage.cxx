@@ -15,6 +15,7 @@
 
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -31,6 +32,7 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <limits>
 #include <utility>
 
 
@@ -105,6 +107,16 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fId;
 }
 
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSource::LoadClusters(const std::vector<RClusterRequest> &requests)
+{
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   clusters.reserve(requests.size());
+   for (const auto &r : requests)
+      clusters.emplace_back(LoadCluster(r.fClusterId, r.fColumns));
+   return clusters;
+}
+
 void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 {
    if (fTaskScheduler)
@@ -315,14 +327,33 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
       pageRange.fColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
    }
+   fOpenColumnStatistics.resize(nColumns);
+   ResetOpenColumnStatistics();
 
    CreateImpl(model);
 }
 
 
+void ROOT::Experimental::Detail::RPageSink::ResetOpenColumnStatistics()
+{
+   const bool isEnabled = GetWriteOptions().GetHasColumnStatistics();
+   for (DescriptorId_t i = 0; i < fOpenColumnStatistics.size(); ++i) {
+      auto &s = fOpenColumnStatistics[i];
+      s.fStatistics.fColumnId = i;
+      s.fStatistics.fMin = std::numeric_limits<double>::infinity();
+      s.fStatistics.fMax = -std::numeric_limits<double>::infinity();
+      s.fIsValid = isEnabled;
+   }
+}
+
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
    fOpenColumnRanges.at(columnHandle.fId).fNElements += page.GetNElements();
+   auto &statistics = fOpenColumnStatistics.at(columnHandle.fId);
+   if (statistics.fIsValid) {
+      statistics.fIsValid = columnHandle.fColumn->ExtendValueRange(
+         page.GetBuffer(), page.GetNElements(), statistics.fStatistics.fMin, statistics.fStatistics.fMax);
+   }
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
@@ -336,6 +367,8 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
    const ROOT::Experimental::Detail::RPageStorage::RSealedPage &sealedPage)
 {
    fOpenColumnRanges.at(columnId).fNElements += sealedPage.fNElements;
+   if (sealedPage.fNElements > 0)
+      fOpenColumnStatistics.at(columnId).fIsValid = false;
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
@@ -344,6 +377,14 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
 }
 
 
+void ROOT::Experimental::Detail::RPageSink::SetOpenColumnStatistics(
+   const RClusterDescriptor::RColumnStatistics &statistics)
+{
+   auto &s = fOpenColumnStatistics.at(statistics.fColumnId);
+   s.fStatistics = statistics;
+   s.fIsValid = true;
+}
+
 void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto locator = CommitClusterImpl(nEntries);
@@ -354,6 +395,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
    fDescriptorBuilder.SetClusterLocator(fLastClusterId, locator);
    for (auto &range : fOpenColumnRanges) {
       fDescriptorBuilder.AddClusterColumnRange(fLastClusterId, range);
+      const auto &statistics = fOpenColumnStatistics[range.fColumnId];
+      if (statistics.fIsValid && range.fNElements > 0)
+         fDescriptorBuilder.AddClusterColumnStatistics(fLastClusterId, statistics.fStatistics);
       range.fFirstElementIndex += range.fNElements;
       range.fNElements = 0;
    }
@@ -363,6 +407,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       range.fColumnId = fullRange.fColumnId;
       fDescriptorBuilder.AddClusterPageRange(fLastClusterId, std::move(fullRange));
    }
+   ResetOpenColumnStatistics();
    ++fLastClusterId;
    fPrevClusterNEntries = nEntries;
 }
@@ -42,6 +42,33 @@
 #include <thread>
 #include <queue>
 
+namespace {
+
+// clang-format off
+/**
+\class ROnDiskPageMapMmap
+\brief An ROnDiskPageMap whose memory region is a mapping of a byte range of the file, unmapped on destruction
+*/
+// clang-format on
+class ROnDiskPageMapMmap : public ROOT::Experimental::Detail::ROnDiskPageMap {
+private:
+   /// The file that created the mapping, it outlives the clusters of the page source
+   ROOT::Internal::RRawFile *fFile;
+   void *fRegion;
+   std::size_t fSize;
+
+public:
+   ROnDiskPageMapMmap(ROOT::Internal::RRawFile *file, void *region, std::size_t size)
+      : fFile(file), fRegion(region), fSize(size)
+   {
+   }
+   ROnDiskPageMapMmap(const ROnDiskPageMapMmap &other) = delete;
+   ROnDiskPageMapMmap &operator=(const ROnDiskPageMapMmap &other) = delete;
+   ~ROnDiskPageMapMmap() { fFile->Unmap(fRegion, fSize); }
+};
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
    const RNTupleWriteOptions &options)
    : RPageSink(ntupleName, options)
@@ -375,7 +402,8 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RCluster>
-ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
+   DescriptorId_t clusterId, const ColumnSet_t &columns, std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
 {
    fCounters->fNClusterLoaded.Inc();
 
@@ -444,8 +472,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       std::uint64_t fOffset = 0;
       std::uint64_t fSize = 0;
    };
-   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
-
+   const auto firstRequest = readRequests.size();
    ROOT::Internal::RRawFile::RIOVec req;
    std::size_t szPayload = 0;
    std::size_t szOverhead = 0;
@@ -484,10 +511,98 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
-   for (auto &r : readRequests) {
-      r.fBuffer = buffer + reinterpret_cast<intptr_t>(r.fBuffer);
+   for (auto i = firstRequest; i < readRequests.size(); ++i) {
+      readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
+   }
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : columns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::MapSingleCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   fCounters->fNClusterLoaded.Inc();
+
+   const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
+
+   // The byte range spanned by the requested pages; the gaps in between do not cost anything in a mapping
+   std::uint64_t firstByte = std::uint64_t(-1);
+   std::uint64_t lastByte = 0;
+   std::size_t szPayload = 0;
+   std::size_t nPages = 0;
+   for (auto columnId : columns) {
+      for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+         const auto &pageLocator = pageInfo.fLocator;
+         firstByte = std::min(firstByte, std::uint64_t(pageLocator.fPosition));
+         lastByte = std::max(lastByte, std::uint64_t(pageLocator.fPosition + pageLocator.fBytesOnStorage));
+         szPayload += pageLocator.fBytesOnStorage;
+         ++nPages;
+      }
+   }
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   if (nPages > 0) {
+      std::uint64_t mapdOffset;
+      auto region = reinterpret_cast<unsigned char *>(fFile->Map(lastByte - firstByte, firstByte, mapdOffset));
+      const std::size_t mapdSize = lastByte - mapdOffset;
+      auto pageMap = std::make_unique<ROnDiskPageMapMmap>(fFile.get(), region, mapdSize);
+      for (auto columnId : columns) {
+         NTupleSize_t pageNo = 0;
+         for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+            const auto &pageLocator = pageInfo.fLocator;
+            ROnDiskPage::Key key(columnId, pageNo);
+            pageMap->Register(key, ROnDiskPage(region + (pageLocator.fPosition - mapdOffset),
+                                               pageLocator.fBytesOnStorage));
+            ++pageNo;
+         }
+      }
+      // The cluster pool loads clusters ahead of their use: let the kernel read them in the background, too
+      fFile->AdviseMap(region, mapdSize, ROOT::Internal::RRawFile::EMapAdvice::kWillNeed);
+      cluster->Adopt(std::move(pageMap));
+      fCounters->fNRead.Inc();
    }
+   fCounters->fNPageLoaded.Add(nPages);
+   fCounters->fSzReadPayload.Add(szPayload);
+   fCounters->fSzReadOverhead.Add(lastByte > firstByte ? (lastByte - firstByte - szPayload) : 0);
+
+   for (auto colId : columns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
 
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   std::vector<RClusterRequest> requests(1);
+   requests[0].fClusterId = clusterId;
+   requests[0].fColumns = columns;
+   return std::move(LoadClusters(requests)[0]);
+}
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(const std::vector<RClusterRequest> &requests)
+{
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   if (requests.empty())
+      return clusters;
+
+   if (fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap)) {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+      for (const auto &r : requests)
+         clusters.emplace_back(MapSingleCluster(r.fClusterId, r.fColumns));
+      return clusters;
+   }
+
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   for (const auto &r : requests)
+      clusters.emplace_back(PrepareSingleCluster(r.fClusterId, r.fColumns, readRequests));
+
+   // A single vector read for all the clusters: on local files with io_uring support, the requests of all the
+   // clusters are in flight at the same time
    auto nReqs = readRequests.size();
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
@@ -496,11 +611,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
 
-   auto cluster = std::make_unique<RCluster>(clusterId);
-   cluster->Adopt(std::move(pageMap));
-   for (auto colId : columns)
-      cluster->SetColumnAvailable(colId);
-   return cluster;
+   return clusters;
 }
 
 
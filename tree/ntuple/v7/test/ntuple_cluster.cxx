@@ -331,3 +331,61 @@ TEST(PageStorageFile, LoadCluster)
    ROnDiskPage::Key key(colId, 0);
    EXPECT_NE(nullptr, cluster->GetOnDiskPage(key));
 }
+
+
+TEST(PageStorageFile, LoadClusters)
+{
+   FileRaii fileGuard("test_ntuple_load_clusters.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt", 42.0);
+
+   {
+      ROOT::Experimental::RNTupleWriter ntuple(
+         std::move(modelWrite), std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(
+            "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleWriteOptions()));
+      for (unsigned i = 0; i < 3; ++i) {
+         *wrPt = float(i);
+         ntuple.Fill();
+         ntuple.CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::Detail::RPageSourceFile source(
+      "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions());
+   source.Attach();
+   source.GetMetrics().Enable();
+
+   auto ptId = source.GetDescriptor().FindFieldId("pt");
+   auto colId = source.GetDescriptor().FindColumnId(ptId, 0);
+   EXPECT_NE(ROOT::Experimental::kInvalidDescriptorId, colId);
+
+   std::vector<RPageSource::RClusterRequest> requests(3);
+   requests[0].fClusterId = 2;
+   requests[0].fColumns = {colId};
+   requests[1].fClusterId = 0;
+   requests[1].fColumns = {colId};
+   requests[2].fClusterId = 1;
+   auto clusters = source.LoadClusters(requests);
+   ASSERT_EQ(3U, clusters.size());
+
+   EXPECT_EQ(2U, clusters[0]->GetId());
+   EXPECT_EQ(0U, clusters[1]->GetId());
+   EXPECT_EQ(1U, clusters[2]->GetId());
+   EXPECT_EQ(1U, clusters[0]->GetNOnDiskPages());
+   EXPECT_EQ(1U, clusters[1]->GetNOnDiskPages());
+   EXPECT_EQ(0U, clusters[2]->GetNOnDiskPages());
+
+   // The pages of all the clusters are read with a single vector read
+   EXPECT_EQ(1, source.GetMetrics().GetCounter("RPageSourceFile.nReadV")->GetValueAsInt());
+   EXPECT_EQ(3, source.GetMetrics().GetCounter("RPageSourceFile.nClusterLoaded")->GetValueAsInt());
+
+   ROnDiskPage::Key key(colId, 0);
+   for (unsigned i = 0; i < 2; ++i) {
+      const auto clusterId = clusters[i]->GetId();
+      auto onDiskPage = clusters[i]->GetOnDiskPage(key);
+      ASSERT_NE(nullptr, onDiskPage);
+      const auto &pageInfo = source.GetDescriptor().GetClusterDescriptor(clusterId).GetPageRange(colId).fPageInfos[0];
+      EXPECT_EQ(pageInfo.fLocator.fBytesOnStorage, onDiskPage->GetSize());
+   }
+}
@@ -96,6 +96,11 @@ TEST(RNTuple, Descriptor)
    pageInfo.fLocator.fPosition = 16384;
    pageRange3.fPageInfos.emplace_back(pageInfo);
    descBuilder.AddClusterPageRange(1, std::move(pageRange3));
+   ROOT::Experimental::RClusterDescriptor::RColumnStatistics columnStatistics;
+   columnStatistics.fColumnId = 4;
+   columnStatistics.fMin = -1.5;
+   columnStatistics.fMax = 42.0;
+   descBuilder.AddClusterColumnStatistics(1, columnStatistics);
 
    const auto &reference = descBuilder.GetDescriptor();
    EXPECT_EQ("MyTuple", reference.GetName());
@@ -127,6 +132,10 @@ TEST(RNTuple, Descriptor)
    reco.SetFromHeader(headerBuffer);
    reco.AddClustersFromFooter(footerBuffer);
    EXPECT_EQ(reference, reco.GetDescriptor());
+   EXPECT_FALSE(reco.GetDescriptor().GetClusterDescriptor(0).HasColumnStatistics(4));
+   EXPECT_FALSE(reco.GetDescriptor().GetClusterDescriptor(1).HasColumnStatistics(3));
+   ASSERT_TRUE(reco.GetDescriptor().GetClusterDescriptor(1).HasColumnStatistics(4));
+   EXPECT_EQ(columnStatistics, reco.GetDescriptor().GetClusterDescriptor(1).GetColumnStatistics(4));
 
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNEntries());
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNElements(3));
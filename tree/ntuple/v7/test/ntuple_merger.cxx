@@ -2,17 +2,14 @@
 
 namespace {
 
-// Reads an integer from a little-endian 4 byte buffer
-std::int32_t ReadRawInt(const void *ptr)
+// Reads the first integer from a page of a split, zig-zag encoded 32bit integer column with nElements elements
+std::int32_t ReadRawInt(const void *ptr, std::size_t nElements)
 {
-   std::int32_t val = *reinterpret_cast<const std::int32_t *>(ptr);
-#ifndef R__BYTESWAP
-   // on big endian system
-   auto x = (val & 0x0000FFFF) << 16 | (val & 0xFFFF0000) >> 16;
-   return (x & 0x00FF00FF) << 8 | (x & 0xFF00FF00) >> 8;
-#else
-   return val;
-#endif
+   auto bytes = reinterpret_cast<const unsigned char *>(ptr);
+   std::uint32_t val = 0;
+   for (unsigned b = 0; b < 4; ++b)
+      val |= std::uint32_t(bytes[b * nElements]) << (8 * b);
+   return static_cast<std::int32_t>((val >> 1) ^ (0 - (val & 1)));
 }
 
 } // anonymous namespace
@@ -30,7 +27,7 @@ TEST(RPageStorage, ReadSealedPages)
       RNTupleWriteOptions options;
       options.SetCompression(0);
       RNTupleWriter ntuple(std::move(model),
-         std::make_unique<RPageSinkFile>("myNTuple", fileGuard.GetPath(), RNTupleWriteOptions()));
+         std::make_unique<RPageSinkFile>("myNTuple", fileGuard.GetPath(), options));
       ntuple.Fill();
       ntuple.CommitCluster();
       for (unsigned i = 0; i < 100000; ++i) {
@@ -55,7 +52,7 @@ TEST(RPageStorage, ReadSealedPages)
    source.LoadSealedPage(columnId, index, sealedPage);
    ASSERT_EQ(1U, sealedPage.fNElements);
    ASSERT_EQ(4U, sealedPage.fSize);
-   EXPECT_EQ(42, ReadRawInt(sealedPage.fBuffer));
+   EXPECT_EQ(42, ReadRawInt(sealedPage.fBuffer, sealedPage.fNElements));
 
    // Check second, big cluster
    auto clusterId = descriptor.FindClusterId(columnId, 1);
@@ -69,7 +66,7 @@ TEST(RPageStorage, ReadSealedPages)
       sealedPage.fBuffer = buffer.get();
       source.LoadSealedPage(columnId, RClusterIndex(clusterId, firstElementInPage), sealedPage);
       ASSERT_GE(sealedPage.fSize, 4U);
-      EXPECT_EQ(firstElementInPage, ReadRawInt(sealedPage.fBuffer));
+      EXPECT_EQ(firstElementInPage, ReadRawInt(sealedPage.fBuffer, sealedPage.fNElements));
       firstElementInPage += pi.fNElements;
    }
 }
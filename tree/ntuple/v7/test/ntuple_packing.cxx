@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <limits>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -32,3 +34,113 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, EColumnType::kSplitIndex> element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   ClusterSize_t offsets[] = {ClusterSize_t(3), ClusterSize_t(5), ClusterSize_t(5), ClusterSize_t(300)};
+   unsigned char packed[16];
+   element.Pack(packed, offsets, 4);
+   // The deltas {3, 2, 0, 295} are split in 4 byte streams
+   unsigned char expected[] = {3, 2, 0, 39, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+   for (unsigned i = 0; i < 16; ++i) {
+      EXPECT_EQ(expected[i], packed[i]) << "byte " << i;
+   }
+
+   ClusterSize_t unpacked[4];
+   element.Unpack(unpacked, packed, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(offsets[i], unpacked[i]);
+   }
+}
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, EColumnType::kSplitInt32> element32(nullptr);
+   std::int32_t i32[] = {0, -1, 1, -2, std::numeric_limits<std::int32_t>::max(),
+                         std::numeric_limits<std::int32_t>::min()};
+   unsigned char packed32[24];
+   element32.Pack(packed32, i32, 6);
+   // zig-zag encoding: 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3; the least significant bytes come first
+   EXPECT_EQ(0, packed32[0]);
+   EXPECT_EQ(1, packed32[1]);
+   EXPECT_EQ(2, packed32[2]);
+   EXPECT_EQ(3, packed32[3]);
+   std::int32_t unpacked32[6];
+   element32.Unpack(unpacked32, packed32, 6);
+   for (unsigned i = 0; i < 6; ++i) {
+      EXPECT_EQ(i32[i], unpacked32[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::uint64_t, EColumnType::kSplitInt64> elementU64(nullptr);
+   std::uint64_t u64[] = {0, 1, std::numeric_limits<std::uint64_t>::max(), 0x0102030405060708};
+   unsigned char packedU64[32];
+   elementU64.Pack(packedU64, u64, 4);
+   std::uint64_t unpackedU64[4];
+   elementU64.Unpack(unpackedU64, packedU64, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(u64[i], unpackedU64[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::int16_t, EColumnType::kSplitInt16> element16(nullptr);
+   std::int16_t i16[] = {-300, 300, std::numeric_limits<std::int16_t>::min()};
+   unsigned char packed16[6];
+   element16.Pack(packed16, i16, 3);
+   std::int16_t unpacked16[3];
+   element16.Unpack(unpacked16, packed16, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(i16[i], unpacked16[i]);
+   }
+
+   // 64bit integers can be read from 32bit columns
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, EColumnType::kSplitInt32> element64As32(nullptr);
+   std::int64_t i64[] = {-5, 7, -2147483648LL};
+   unsigned char packed64As32[12];
+   element64As32.Pack(packed64As32, i64, 3);
+   std::int64_t unpacked64[3];
+   element64As32.Unpack(unpacked64, packed64As32, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(i64[i], unpacked64[i]);
+   }
+}
+
+TEST(Packing, SplitColumns)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      auto fldInt = model->MakeField<std::int32_t>("int");
+      auto fldUInt = model->MakeField<std::uint64_t>("uint");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 10000; ++i) {
+         fldJets->resize(i % 7);
+         *fldInt = i - 5000;
+         *fldUInt = i;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto columnType = [&desc](const std::string &fieldName) {
+      auto columnId = desc.FindColumnId(desc.FindFieldId(fieldName), 0);
+      return desc.GetColumnDescriptor(columnId).GetModel().GetType();
+   };
+   EXPECT_EQ(EColumnType::kSplitIndex, columnType("jets"));
+   EXPECT_EQ(EColumnType::kSplitInt32, columnType("int"));
+   EXPECT_EQ(EColumnType::kSplitInt64, columnType("uint"));
+
+   auto viewJets = ntuple->GetView<std::vector<float>>("jets");
+   auto viewInt = ntuple->GetView<std::int32_t>("int");
+   auto viewUInt = ntuple->GetView<std::uint64_t>("uint");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(i % 7, viewJets(i).size());
+      EXPECT_EQ(static_cast<std::int32_t>(i) - 5000, viewInt(i));
+      EXPECT_EQ(i, viewUInt(i));
+   }
+}
@@ -35,3 +35,63 @@ TEST(RNTuple, RDF)
    EXPECT_EQ(2U, *rdf.Min("__rdf_sizeof_jets"));
    EXPECT_EQ(3U, *rdf.Min("__rdf_sizeof_klass.v1"));
 }
+
+TEST(RNTuple, RDFSnapshot)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot.root");
+
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fAutoFlush = 10;
+   auto df = ROOT::RDataFrame(100)
+                .Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                .Define("v", [](ULong64_t e) { return ROOT::RVec<int>(e % 3, int(e)); }, {"rdfentry_"})
+                .Define("s", [](ULong64_t e) { return std::to_string(e); }, {"rdfentry_"});
+   auto out = df.Snapshot<float, ROOT::RVec<int>, std::string>("ntpl", fileGuard.GetPath(), {"x", "v", "s"}, opts);
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(100U, ntuple->GetNEntries());
+   EXPECT_EQ(10U, ntuple->GetDescriptor().GetNClusters());
+
+   // RVec columns are written as std::vector fields
+   auto viewV = ntuple->GetView<std::vector<int>>("v");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(std::vector<int>(i % 3, int(i)), viewV(i));
+   }
+
+   EXPECT_EQ(100ULL, *out->Count());
+   EXPECT_FLOAT_EQ(99.f, *out->Max<float>("x"));
+   EXPECT_EQ(100U, out->Take<std::string>("s")->size());
+   auto vs = out->Take<std::vector<int>>("v");
+   auto xs = out->Take<float>("x");
+   ASSERT_EQ(100U, vs->size());
+   for (std::size_t i = 0; i < vs->size(); ++i) {
+      const auto e = static_cast<std::size_t>((*xs)[i]);
+      EXPECT_EQ(std::vector<int>(e % 3, int(e)), (*vs)[i]);
+   }
+}
+
+#ifdef R__USE_IMT
+TEST(RNTuple, RDFSnapshotMT)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot_mt.root");
+
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fAutoFlush = 1000;
+   auto out = ROOT::RDataFrame(100000)
+                 .Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Define("v", [](ULong64_t e) { return std::vector<float>(e % 4, 1.f); }, {"rdfentry_"})
+                 .Snapshot("ntpl", fileGuard.GetPath(), {"x", "v"}, opts);
+   ROOT::DisableImplicitMT();
+
+   // entries are shuffled, but all of them must be there
+   EXPECT_EQ(100000ULL, *out->Count());
+   EXPECT_DOUBLE_EQ(99999. * 100000. / 2., *out->Sum<double>("x"));
+   EXPECT_DOUBLE_EQ(150000., *out->Define("n", [](const std::vector<float> &v) { return v.size(); }, {"v"}).Sum("n"));
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(100000U, ntuple->GetNEntries());
+}
+#endif // R__USE_IMT
@@ -71,6 +71,103 @@ TEST(RNTuple, Extended)
    EXPECT_EQ(chksumRead, chksumWrite);
 }
 
+TEST(RNTuple, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrVector = model->MakeField<std::vector<float>>("vector");
+   auto wrPt = model->MakeField<float>("pt");
+
+   constexpr unsigned int nEvents = 10000;
+   for (auto compression : {0, 505}) {
+      {
+         RNTupleWriteOptions options;
+         options.SetCompression(compression);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+         for (unsigned int i = 0; i < nEvents; ++i) {
+            wrVector->assign(i % 5, i);
+            *wrPt = i;
+            ntuple->Fill();
+            if (i % 1000 == 0)
+               ntuple->CommitCluster();
+         }
+      }
+      model = RNTupleModel::Create();
+      wrVector = model->MakeField<std::vector<float>>("vector");
+      wrPt = model->MakeField<float>("pt");
+
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath(), options);
+      auto viewVector = ntuple->GetView<std::vector<float>>("vector");
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(float(i), viewPt(i));
+         EXPECT_EQ(std::vector<float>(i % 5, i), viewVector(i));
+      }
+   }
+}
+
+TEST(RNTuple, ColumnStatistics)
+{
+   FileRaii fileGuard("test_ntuple_column_statistics.root");
+
+   for (bool useBufferedWrite : {false, true}) {
+      {
+         auto model = RNTupleModel::Create();
+         auto wrPt = model->MakeField<float>("pt");
+         auto wrCharge = model->MakeField<std::int32_t>("charge");
+         auto wrTag = model->MakeField<std::string>("tag", "xyz");
+         RNTupleWriteOptions options;
+         options.SetUseBufferedWrite(useBufferedWrite);
+         options.SetHasColumnStatistics(true);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+         for (int i = 0; i < 10; ++i) {
+            *wrPt = 2.5 * i;
+            *wrCharge = (i % 2) ? -i : i;
+            ntuple->Fill();
+            if (i == 4)
+               ntuple->CommitCluster();
+         }
+      }
+
+      auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+      const auto &desc = ntuple->GetDescriptor();
+      const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+      const auto chargeColumnId = desc.FindColumnId(desc.FindFieldId("charge"), 0);
+      const auto tagIndexColumnId = desc.FindColumnId(desc.FindFieldId("tag"), 0);
+      const auto tagCharsColumnId = desc.FindColumnId(desc.FindFieldId("tag"), 1);
+      ASSERT_EQ(2U, desc.GetNClusters());
+
+      const auto &cluster0 = desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 0));
+      const auto &cluster1 = desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 9));
+      ASSERT_TRUE(cluster0.HasColumnStatistics(ptColumnId));
+      EXPECT_EQ(0.0, cluster0.GetColumnStatistics(ptColumnId).fMin);
+      EXPECT_EQ(10.0, cluster0.GetColumnStatistics(ptColumnId).fMax);
+      ASSERT_TRUE(cluster1.HasColumnStatistics(ptColumnId));
+      EXPECT_EQ(12.5, cluster1.GetColumnStatistics(ptColumnId).fMin);
+      EXPECT_EQ(22.5, cluster1.GetColumnStatistics(ptColumnId).fMax);
+      ASSERT_TRUE(cluster1.HasColumnStatistics(chargeColumnId));
+      EXPECT_EQ(-9.0, cluster1.GetColumnStatistics(chargeColumnId).fMin);
+      EXPECT_EQ(8.0, cluster1.GetColumnStatistics(chargeColumnId).fMax);
+      // No statistics for offsets and characters
+      EXPECT_FALSE(cluster0.HasColumnStatistics(tagIndexColumnId));
+      EXPECT_FALSE(cluster0.HasColumnStatistics(tagCharsColumnId));
+   }
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt", 1.0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      ntuple->Fill();
+   }
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   EXPECT_FALSE(desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 0)).HasColumnStatistics(ptColumnId));
+}
+
 TEST(RPageSinkBuf, Basics)
 {
    struct TestModel {
@@ -132,6 +132,59 @@ TEST(RNTuple, BulkViewCollection)
    }
 }
 
+TEST(RNTuple, BulkRead)
+{
+   FileRaii fileGuard("test_ntuple_bulk_read.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldTag = model->MakeField<std::string>("tag");
+   auto eltsPerPage = 1'000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetNElementsPerPage(eltsPerPage);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         *fieldTag = std::to_string(i);
+         ntuple->Fill();
+         if (i == 4'321)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTag = ntuple->GetView<std::string>("tag");
+
+   // Spans several pages and a cluster boundary
+   const NTupleSize_t first = 3'500;
+   const NTupleSize_t count = 2'000;
+   std::vector<float> pts(count);
+   viewPt.ReadV(first, count, pts.data());
+   for (NTupleSize_t i = 0; i < count; i++) {
+      EXPECT_EQ(static_cast<float>(first + i), pts[i]);
+   }
+
+   std::vector<std::string> tags(count);
+   viewTag.ReadV(first, count, tags.data());
+   for (NTupleSize_t i = 0; i < count; i++) {
+      EXPECT_EQ(std::to_string(first + i), tags[i]);
+   }
+
+   NTupleSize_t nChunks = 0;
+   NTupleSize_t nextIndex = first;
+   viewPt.MapRange(first, count, [&](NTupleSize_t firstIndex, const float *values, NTupleSize_t nItems) {
+      EXPECT_EQ(nextIndex, firstIndex);
+      for (NTupleSize_t i = 0; i < nItems; i++) {
+         EXPECT_EQ(static_cast<float>(firstIndex + i), values[i]);
+      }
+      nextIndex += nItems;
+      nChunks++;
+   });
+   EXPECT_EQ(first + count, nextIndex);
+   EXPECT_LT(1U, nChunks);
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
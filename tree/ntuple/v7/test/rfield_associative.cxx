@@ -0,0 +1,121 @@
+#include "ntuple_test.hxx"
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+TEST(RNTuple, StdPair)
+{
+   auto field = RField<std::pair<std::int64_t, float>>("pairField");
+   EXPECT_STREQ("std::pair<std::int64_t,float>", field.GetType().c_str());
+   EXPECT_EQ(sizeof(std::pair<std::int64_t, float>), field.GetValueSize());
+   EXPECT_EQ(alignof(std::pair<std::int64_t, float>), field.GetAlignment());
+   auto otherField = RFieldBase::Create("test", "std::pair<int64_t, float>").Unwrap();
+   EXPECT_STREQ(field.GetType().c_str(), otherField->GetType().c_str());
+   EXPECT_EQ(field.GetValueSize(), otherField->GetValueSize());
+
+   FileRaii fileGuard("test_ntuple_rfield_stdpair.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto pairField = model->MakeField<std::pair<double, std::string>>("myPair", 6.0, "pair");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "pair_ntuple", fileGuard.GetPath());
+      writer->Fill();
+      pairField->first = 7.0;
+      pairField->second = "another";
+      writer->Fill();
+   }
+   auto ntuple = RNTupleReader::Open("pair_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(2U, ntuple->GetNEntries());
+   auto viewPair = ntuple->GetView<std::pair<double, std::string>>("myPair");
+   EXPECT_EQ(std::make_pair(6.0, std::string("pair")), viewPair(0));
+   EXPECT_EQ(std::make_pair(7.0, std::string("another")), viewPair(1));
+}
+
+TEST(RNTuple, StdSet)
+{
+   EXPECT_STREQ("std::set<std::int32_t>", RField<std::set<int>>::TypeName().c_str());
+   auto otherField = RFieldBase::Create("test", "set<int>").Unwrap();
+   EXPECT_STREQ("std::set<std::int32_t>", otherField->GetType().c_str());
+   EXPECT_EQ(sizeof(std::set<int>), otherField->GetValueSize());
+
+   FileRaii fileGuard("test_ntuple_rfield_stdset.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto setField = model->MakeField<std::set<float>>("mySet");
+      auto stringSetField = model->MakeField<std::unordered_set<std::string>>("myStringSet");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "set_ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         setField->clear();
+         for (int j = 0; j < i % 5; ++j)
+            setField->insert(static_cast<float>(i - j));
+         *stringSetField = {std::to_string(i), "common"};
+         writer->Fill();
+         if (i == 50)
+            writer->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("set_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(100U, ntuple->GetNEntries());
+   auto viewSet = ntuple->GetView<std::set<float>>("mySet");
+   auto viewStringSet = ntuple->GetView<std::unordered_set<std::string>>("myStringSet");
+   for (auto i : ntuple->GetEntryRange()) {
+      std::set<float> expected;
+      for (int j = 0; j < static_cast<int>(i % 5); ++j)
+         expected.insert(static_cast<float>(static_cast<int>(i) - j));
+      EXPECT_EQ(expected, viewSet(i));
+      EXPECT_EQ(std::unordered_set<std::string>({std::to_string(i), "common"}), viewStringSet(i));
+   }
+
+   // The item values are accessible as a collection
+   auto viewSetCollection = ntuple->GetViewCollection("mySet");
+   EXPECT_EQ(4U, viewSetCollection(4));
+}
+
+TEST(RNTuple, StdMap)
+{
+   EXPECT_STREQ("std::map<std::string,std::vector<float>>",
+                (RField<std::map<std::string, std::vector<float>>>::TypeName().c_str()));
+   auto otherField = RFieldBase::Create("test", "map<string, vector<float>>").Unwrap();
+   EXPECT_STREQ("std::map<std::string,std::vector<float>>", otherField->GetType().c_str());
+   auto unorderedField = RFieldBase::Create("test", "std::unordered_map<int,double>").Unwrap();
+   EXPECT_STREQ("std::unordered_map<std::int32_t,double>", unorderedField->GetType().c_str());
+
+   FileRaii fileGuard("test_ntuple_rfield_stdmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto mapField = model->MakeField<std::map<std::string, std::vector<float>>>("myMap");
+      auto unorderedMapField = model->MakeField<std::unordered_map<std::int64_t, double>>("myUnorderedMap");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "map_ntuple", fileGuard.GetPath());
+      (*mapField)["a"] = {1.0, 2.0};
+      (*mapField)["b"] = {};
+      (*unorderedMapField)[1] = 1.5;
+      (*unorderedMapField)[-2] = 2.5;
+      writer->Fill();
+      mapField->clear();
+      unorderedMapField->clear();
+      writer->Fill();
+      (*mapField)["c"] = {3.0};
+      (*unorderedMapField)[3] = 3.5;
+      writer->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("map_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(3U, ntuple->GetNEntries());
+   auto viewMap = ntuple->GetView<std::map<std::string, std::vector<float>>>("myMap");
+   auto viewUnorderedMap = ntuple->GetView<std::unordered_map<std::int64_t, double>>("myUnorderedMap");
+   EXPECT_EQ((std::map<std::string, std::vector<float>>{{"a", {1.0, 2.0}}, {"b", {}}}), viewMap(0));
+   EXPECT_EQ((std::unordered_map<std::int64_t, double>{{1, 1.5}, {-2, 2.5}}), viewUnorderedMap(0));
+   EXPECT_TRUE(viewMap(1).empty());
+   EXPECT_TRUE(viewUnorderedMap(1).empty());
+   EXPECT_EQ((std::map<std::string, std::vector<float>>{{"c", {3.0}}}), viewMap(2));
+   EXPECT_EQ((std::unordered_map<std::int64_t, double>{{3, 3.5}}), viewUnorderedMap(2));
+
+   // Reading through a model that is reconstructed from the descriptor
+   auto model = ntuple->GetModel();
+   auto mapPtr = model->GetDefaultEntry()->Get<std::map<std::string, std::vector<float>>>("myMap");
+   ntuple->LoadEntry(2);
+   EXPECT_EQ(1U, mapPtr->size());
+   EXPECT_EQ(std::vector<float>{3.0}, mapPtr->at("c"));
+}
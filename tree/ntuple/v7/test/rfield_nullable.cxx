@@ -0,0 +1,97 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTuple, UniquePtr)
+{
+   EXPECT_STREQ("std::unique_ptr<std::string>", RField<std::unique_ptr<std::string>>::TypeName().c_str());
+   auto otherField = RFieldBase::Create("test", "unique_ptr<std::vector<int>>").Unwrap();
+   EXPECT_STREQ("std::unique_ptr<std::vector<std::int32_t>>", otherField->GetType().c_str());
+   EXPECT_EQ(sizeof(std::unique_ptr<char>), otherField->GetValueSize());
+   auto value = otherField->GenerateValue();
+   otherField->DestroyValue(value);
+
+   FileRaii fileGuard("test_ntuple_rfield_uniqueptr.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrField = model->MakeField<std::unique_ptr<float>>("myPtr");
+      auto stringPtrField = model->MakeField<std::unique_ptr<std::string>>("myStringPtr");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "uniqueptr_ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 10; ++i) {
+         *ptrField = (i % 3 == 0) ? nullptr : std::make_unique<float>(i);
+         *stringPtrField = (i % 2 == 0) ? std::make_unique<std::string>(std::to_string(i)) : nullptr;
+         writer->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("uniqueptr_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(10U, ntuple->GetNEntries());
+   auto model = ntuple->GetModel();
+   auto ptr = model->GetDefaultEntry()->Get<std::unique_ptr<float>>("myPtr");
+   auto stringPtr = model->GetDefaultEntry()->Get<std::unique_ptr<std::string>>("myStringPtr");
+   for (auto i : ntuple->GetEntryRange()) {
+      ntuple->LoadEntry(i);
+      if (i % 3 == 0) {
+         EXPECT_EQ(nullptr, *ptr);
+      } else {
+         ASSERT_NE(nullptr, *ptr);
+         EXPECT_EQ(static_cast<float>(i), **ptr);
+      }
+      if (i % 2 == 0) {
+         ASSERT_NE(nullptr, *stringPtr);
+         EXPECT_EQ(std::to_string(i), **stringPtr);
+      } else {
+         EXPECT_EQ(nullptr, *stringPtr);
+      }
+   }
+
+   // Only non-null values are stored in the item field
+   auto viewItems = ntuple->GetViewCollection("myStringPtr");
+   EXPECT_EQ(1U, viewItems(0));
+   EXPECT_EQ(0U, viewItems(1));
+}
+
+#if __cplusplus >= 201703L
+TEST(RNTuple, Optional)
+{
+   EXPECT_STREQ("std::optional<double>", RField<std::optional<double>>::TypeName().c_str());
+   auto otherField = RFieldBase::Create("test", "optional<std::int32_t>").Unwrap();
+   EXPECT_STREQ("std::optional<std::int32_t>", otherField->GetType().c_str());
+   EXPECT_EQ(sizeof(std::optional<std::int32_t>), otherField->GetValueSize());
+   EXPECT_EQ(sizeof(std::optional<char>), RField<std::optional<char>>("c").GetValueSize());
+   EXPECT_EQ(sizeof(std::optional<double>), RField<std::optional<double>>("d").GetValueSize());
+
+   FileRaii fileGuard("test_ntuple_rfield_optional.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto optField = model->MakeField<std::optional<double>>("myOpt");
+      auto vecOptField = model->MakeField<std::optional<std::vector<int>>>("myVecOpt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "optional_ntuple", fileGuard.GetPath());
+      *optField = 1.0;
+      writer->Fill();
+      optField->reset();
+      *vecOptField = std::vector<int>{1, 2, 3};
+      writer->Fill();
+      *optField = 3.0;
+      vecOptField->reset();
+      writer->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("optional_ntuple", fileGuard.GetPath());
+   EXPECT_EQ(3U, ntuple->GetNEntries());
+   auto model = ntuple->GetModel();
+   auto opt = model->GetDefaultEntry()->Get<std::optional<double>>("myOpt");
+   auto vecOpt = model->GetDefaultEntry()->Get<std::optional<std::vector<int>>>("myVecOpt");
+   ntuple->LoadEntry(0);
+   EXPECT_EQ(1.0, opt->value());
+   EXPECT_FALSE(vecOpt->has_value());
+   ntuple->LoadEntry(1);
+   EXPECT_FALSE(opt->has_value());
+   EXPECT_EQ(std::vector<int>({1, 2, 3}), vecOpt->value());
+   ntuple->LoadEntry(2);
+   EXPECT_EQ(3.0, opt->value());
+   EXPECT_FALSE(vecOpt->has_value());
+
+   auto viewOpt = ntuple->GetView<std::optional<double>>("myOpt");
+   EXPECT_FALSE(viewOpt(1).has_value());
+   EXPECT_EQ(3.0, viewOpt(2).value());
+}
+#endif // __cplusplus >= 201703L
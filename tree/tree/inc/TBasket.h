@@ -33,6 +33,7 @@ class TBranch;
 
 class TBasket : public TKey {
 friend class TBranch;
+friend class TBranchElement;
 
 private:
    TBasket(const TBasket&);            ///< TBasket objects are not copiable.
@@ -143,6 +144,7 @@ public:
    Bool_t          GetResetAllocationCount() const { return fResetAllocation; }
 
    Int_t           LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree = 0);
+   Int_t           LoadBasketBuffersFromMemory(const char *buffer, Int_t len, TFile *file);
    Long64_t        CopyTo(TFile *to);
 
            void    SetBranch(TBranch *branch) { fBranch = branch; }
@@ -152,6 +154,8 @@ public:
    inline  void    Update(Int_t newlast) { Update(newlast,newlast); };
    virtual void    Update(Int_t newlast, Int_t skipped);
    virtual Int_t   WriteBuffer();
+           Int_t   CompressBuffer(TFile *file);
+           Int_t   WriteCompressedBuffer(TFile *file, Int_t nout);
 
    ClassDef(TBasket, 3); // the TBranch buffers
 };
@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -50,6 +52,7 @@ class TBulkBranchRead;
 }
 namespace Internal {
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
+class TAsyncBasketWriter; ///< Compresses full baskets in the background during TTree::Fill.
 }
 }
 
@@ -73,7 +76,9 @@ public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   Int_t GetBulkCollectionEntries(Long64_t evt, TBuffer &user_buf, TBuffer &offsets_buf);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsBulkCollectionRead() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -95,6 +100,7 @@ protected:
    friend class TTree;
    friend class TBranchElement;
    friend class ROOT::Experimental::Internal::TBulkBranchRead;
+   friend class ROOT::Internal::TAsyncBasketWriter;
 
    /// TBranch status bits
    enum EStatusBits {
@@ -137,12 +143,20 @@ protected:
    Int_t      *fBasketBytes;      ///<[fMaxBaskets] Length of baskets on file
    Long64_t   *fBasketEntry;      ///<[fMaxBaskets] Table of first entry in each basket
    Long64_t   *fBasketSeek;       ///<[fMaxBaskets] Addresses of baskets on file
+   Double_t   *fBasketMin;        ///<[fMaxBaskets] Minimum value in each basket, if recorded (see SetBasketMinMax)
+   Double_t   *fBasketMax;        ///<[fMaxBaskets] Maximum value in each basket, if recorded (see SetBasketMinMax)
    TTree      *fTree;             ///<! Pointer to Tree header
    TBranch    *fMother;           ///<! Pointer to top-level parent branch in the tree.
    TBranch    *fParent;           ///<! Pointer to parent branch.
    char       *fAddress;          ///<! Address of 1st leaf (variable or object)
    TDirectory *fDirectory;        ///<! Pointer to directory where this branch buffers are stored
    TString     fFileName;         ///<  Name of file where buffers are stored ("" if in same file as Tree header)
+   std::vector<char> fCompressionDict; ///<  ZSTD dictionary used to compress the baskets, empty if none
+   void       *fDecompressionDict; ///<! fCompressionDict digested for decompression, owned by the branch
+   Int_t       fDictTrainingBaskets; ///<! Number of baskets still to be sampled before training the dictionary
+   Int_t       fDictMaxSize;      ///<! Maximum size of the dictionary to train
+   std::vector<char> fDictSamples; ///<! Uncompressed content of the sampled baskets
+   std::vector<size_t> fDictSampleSizes; ///<! Sizes of the sampled baskets
    TBuffer    *fEntryBuffer;      ///<! Buffer used to directly pass the content without streaming
    TBuffer    *fTransientBuffer;  ///<! Pointer to the current transient buffer.
    TList      *fBrowsables;       ///<! List of TVirtualBranchBrowsables used for Browse()
@@ -171,6 +185,7 @@ protected:
    Int_t    WriteBasket(TBasket* basket, Int_t where) { return WriteBasketImpl(basket, where, nullptr); }
 
    TString  GetRealFileName() const;
+   void     UpdateDecompressionDictionary();
 
    virtual void SetAddressImpl(void *addr, Bool_t /* implied */) { SetAddress(addr); }
 
@@ -180,8 +195,12 @@ private:
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   virtual Int_t GetBulkCollectionEntries(Long64_t, TBuffer&, TBuffer&) { return -1; }
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   Int_t    WriteBasketAsync(TBasket* basket, ROOT::Internal::TAsyncBasketWriter &writer);
+   TBasket *FinishAsyncWrite(TBasket* basket, Int_t where, Int_t nout);
+   void     UpdateEntryOffsetLen(Int_t nevbuf);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -193,6 +212,7 @@ public:
 
    virtual void      AddBasket(TBasket &b, Bool_t ondisk, Long64_t startEntry);
    virtual void      AddLastBasket(Long64_t startEntry);
+           void      AddCompressionDictionarySample(const char *buffer, Int_t size);
            Int_t     BackFill();
    virtual void      Browse(TBrowser *b);
    virtual void      DeleteBaskets(Option_t* option="");
@@ -210,6 +230,7 @@ public:
            Int_t    *GetBasketBytes() const {return fBasketBytes;}
            Long64_t *GetBasketEntry() const {return fBasketEntry;}
    virtual Long64_t  GetBasketSeek(Int_t basket) const;
+           Bool_t    GetBasketMinMax(Int_t basket, Double_t &min, Double_t &max) const;
    virtual Int_t     GetBasketSize() const {return fBasketSize;}
            ROOT::Experimental::Internal::TBulkBranchRead &GetBulkRead() { return fBulk; }
    virtual TList    *GetBrowsables();
@@ -217,6 +238,8 @@ public:
            Int_t     GetCompressionAlgorithm() const;
            Int_t     GetCompressionLevel() const;
            Int_t     GetCompressionSettings() const;
+   const std::vector<char> &GetCompressionDictionary() const { return fCompressionDict; }
+   const void       *GetDecompressionDictionary() const { return fDecompressionDict; }
    TDirectory       *GetDirectory() const {return fDirectory;}
    virtual Int_t     GetEntry(Long64_t entry=0, Int_t getall = 0);
    virtual Int_t     GetEntryExport(Long64_t entry, Int_t getall, TClonesArray *list, Int_t n);
@@ -267,10 +290,13 @@ public:
    virtual void      SetObject(void *objadd);
    virtual void      SetAutoDelete(Bool_t autodel=kTRUE);
    virtual void      SetBasketSize(Int_t buffsize);
+           Bool_t    SetBasketMinMax(Bool_t record = kTRUE);
    virtual void      SetBufferAddress(TBuffer *entryBuffer);
    void              SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
    void              SetCompressionLevel(Int_t level = ROOT::RCompressionSetting::ELevel::kUseMin);
    void              SetCompressionSettings(Int_t settings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
+   void              SetCompressionDictionary(Int_t nTrainingBaskets = 10, Int_t maxDictSize = 32768);
+   void              SetCompressionDictionary(const std::vector<char> &dict);
    virtual void      SetEntries(Long64_t entries);
    virtual void      SetEntryOffsetLen(Int_t len, Bool_t updateSubBranches = kFALSE);
    virtual void      SetFirstEntry( Long64_t entry );
@@ -283,12 +309,13 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree;}
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+   virtual Bool_t    SupportsBulkCollectionRead() const { return kFALSE; }
    virtual void      UpdateAddress() {;}
    virtual void      UpdateFile();
 
    static  void      ResetCount();
 
-   ClassDef(TBranch, 13); // Branch descriptor
+   ClassDef(TBranch, 15); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -316,7 +343,9 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetBulkCollectionEntries(Long64_t evt, TBuffer& user_buf, TBuffer& offsets_buf) { return fParent.GetBulkCollectionEntries(evt, user_buf, offsets_buf); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkCollectionRead() const { return fParent.SupportsBulkCollectionRead(); }
 
 }  // Internal
 }  // Experimental
@@ -118,6 +118,21 @@ public:
       return kTRUE;
    }
 
+   /// Return true if some baskets are marked as loaded and none of
+   /// the baskets are marked as used.
+   Bool_t NoneUsed() const
+   {
+      Bool_t loaded = kFALSE;
+      auto len = fInfo.GetNbits() / kSize + 1;
+      for (UInt_t b = 0; b < len; ++b) {
+         if (fInfo[kSize * b + kUsed])
+            return kFALSE;
+         if (fInfo[kSize * b + kLoaded])
+            loaded = kTRUE;
+      }
+      return loaded;
+   }
+
    /// Return a set of unused basket, let's not re-read them.
    void GetUnused(std::vector<Int_t> &unused)
    {
@@ -230,6 +230,7 @@ public:
    inline  void             SetParentClass(TClass* clparent);
    virtual void             SetParentName(const char* name) { fParentName = name; }
    virtual void             SetTargetClass(const char *name);
+   virtual Bool_t           SupportsBulkCollectionRead() const;
    virtual void             SetupAddresses();
    virtual void             SetType(Int_t btype) { fType = btype; }
    virtual void             UpdateFile();
@@ -251,6 +252,7 @@ public:
 
 private:
    virtual Int_t            FillImpl(ROOT::Internal::TBranchIMTHelper *);
+   virtual Int_t            GetBulkCollectionEntries(Long64_t entry, TBuffer &user_buf, TBuffer &offsets_buf);
 
    ClassDef(TBranchElement,10)  // Branch in case of an object
 };
@@ -138,6 +138,7 @@ public:
    virtual void      ResetBranchAddresses();
    virtual void      SavePrimitive (std::ostream &out, Option_t *option="");
    virtual Long64_t  Scan(const char *varexp="", const char *selection="", Option_t *option="", Long64_t nentries=kMaxEntries, Long64_t firstentry=0); // *MENU*
+   virtual TEntryList *SelectBaskets(const char *branchname, Double_t min, Double_t max);
    virtual void      SetAutoDelete(Bool_t autodel=kTRUE);
    virtual Int_t     SetBranchAddress(const char *bname,void *add, TBranch **ptr = 0);
    virtual Int_t     SetBranchAddress(const char *bname,void *add, TBranch **ptr, TClass *realClass, EDataType datatype, Bool_t isptr);
@@ -76,6 +76,15 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Internal {
+class TAsyncBasketWriter;
+/// Number of baskets handed, in this process, to the asynchronous writers of the trees (see TTree::SetAsyncBasketWrite).
+/// Used by the tests to check that the baskets were compressed in the background.
+ULong64_t GetTAsyncBasketWriterNSubmittedBaskets();
+}
+}
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -156,10 +165,12 @@ private:
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   ROOT::Internal::TAsyncBasketWriter *fAsyncBasketWriter{nullptr}; ///<! Background compression of the full baskets, see SetAsyncBasketWrite
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
+   void             FlushAsyncBaskets() const;
    void             MarkEventCluster();
 
 protected:
@@ -424,6 +435,7 @@ public:
    virtual void            DirectoryAutoAdd(TDirectory *);
    Int_t                   Debug() const { return fDebug; }
    virtual void            Delete(Option_t* option = ""); // *MENU*
+   void                    DiscardAsyncBaskets(const TBranch *branch);
    virtual void            Draw(Option_t* opt) { Draw(opt, "", "", kMaxEntries, 0); }
    virtual Long64_t        Draw(const char* varexp, const TCut& selection, Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0);
    virtual Long64_t        Draw(const char* varexp, const char* selection, Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
@@ -439,6 +451,7 @@ public:
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t               GetAllocationTime() const { return fAllocationTime; }
 #endif
+           Bool_t          GetAsyncBasketWrite() const { return fAsyncBasketWriter != nullptr; }
    virtual Long64_t        GetAutoFlush() const {return fAutoFlush;}
    virtual Long64_t        GetAutoSave()  const {return fAutoSave;}
    virtual TBranch        *GetBranch(const char* name);
@@ -573,7 +586,9 @@ public:
    virtual void            ResetBranchAddress(TBranch *);
    virtual void            ResetBranchAddresses();
    virtual Long64_t        Scan(const char* varexp = "", const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
+   virtual TEntryList     *SelectBaskets(const char *branchname, Double_t min, Double_t max);
    virtual Bool_t          SetAlias(const char* aliasName, const char* aliasFormula);
+           void            SetAsyncBasketWrite(Bool_t enable = kTRUE, Long64_t maxbytes = 0);
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
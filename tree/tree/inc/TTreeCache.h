@@ -23,6 +23,7 @@
 
 #include "TFileCacheRead.h"
 
+#include <unordered_map>
 #include <vector>
 
 class TTree;
@@ -104,6 +105,17 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   // These members are only used when the adaptive mode is enabled (see SetAdaptive).
+   Bool_t   fAdaptive{kFALSE};        ///<! true if the branches and size of the cache follow the observed reads
+   Int_t    fAdaptiveMinSize{0};      ///<! lower bound of the adaptive buffer size
+   Int_t    fAdaptiveMaxSize{0};      ///<! upper bound of the adaptive buffer size
+   Long64_t fLastTransferEnd{-1};     ///<! time (ns) at which the last transfer of the cache content ended
+   std::unordered_map<TBranch *, Int_t> fUnusedFills; ///<! number of consecutive fills whose baskets were not used, per branch
+
+   // Helpers of the adaptive mode.
+   void     AdaptBufferSize(Long64_t transferStart, Long64_t transferEnd); ///< Resize the cache based on the time spent waiting for the transfer.
+   void     AdaptBranches();                     ///< Drop the branches whose cached baskets are not used anymore.
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -124,6 +136,9 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    Bool_t   ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   // Helper of the adaptive mode.
+   void     LearnMissedBranch(Long64_t pos, Int_t len); ///< Add the branch a cache miss belongs to.
+
 public:
 
    TTreeCache();
@@ -147,6 +162,7 @@ public:
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
    TTree               *GetTree() const {return fTree;}
+   Bool_t               IsAdaptive() const { return fAdaptive; }
    Bool_t               IsAutoCreated() const {return fAutoCreated;}
    virtual Bool_t       IsEnabled() const {return fEnabled;}
    virtual Bool_t       IsLearning() const {return fIsLearning;}
@@ -161,6 +177,7 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   void                 SetAdaptive(Bool_t adaptive = kTRUE, Int_t maxsize = 0);
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    virtual Int_t        SetBufferSize(Int_t buffersize);
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
@@ -58,6 +58,7 @@ class TTreeCloner {
    Int_t           fCacheSize;   ///< Requested size of the file cache
    TFileCacheRead *fFileCache;   ///< File Cache used to reduce the number of individual reads
    TFileCacheRead *fPrevCache;   ///< Cache that set before the TTreeCloner ctor for the 'from' TTree if any.
+   Bool_t          fPipeline;    ///< True if the reading of the input baskets overlaps with the writing of the output (option "parallel")
 
    enum ECloneMethod {
       kDefault             = 0,
@@ -87,6 +88,8 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+   UInt_t NextPipelineChunk(UInt_t from, Long64_t maxSize) const;
+   void WriteBasketsPipelined();
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -126,4 +129,12 @@ public:
    ClassDef(TTreeCloner,0); // helper used for the fast cloning of TTrees.
 };
 
+namespace ROOT {
+namespace Internal {
+/// Number of baskets copied, in this process, by the pipelined transfer of TTreeCloner (option "parallel").
+/// Used by the tests to check that the pipelined transfer took place.
+ULong64_t GetTTreeClonerNPipelinedBaskets();
+} // namespace Internal
+} // namespace ROOT
+
 #endif
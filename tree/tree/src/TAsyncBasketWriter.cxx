@@ -0,0 +1,186 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TAsyncBasketWriter.h"
+
+#include "TBasket.h"
+#include "TBranch.h"
+#include "TBuffer.h"
+#include "TTree.h"
+
+namespace {
+/// Number of baskets handed to a TAsyncBasketWriter in this process.
+std::atomic<ULong64_t> gNSubmittedBaskets{0};
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// The baskets still in flight are not written: they stay in memory, owned by
+/// their branch, as if the tree had not been flushed.
+
+TAsyncBasketWriter::~TAsyncBasketWriter()
+{
+   Discard();
+   for (auto &spare : fSpareBaskets)
+      delete spare.second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the completion of all compression tasks.
+
+void TAsyncBasketWriter::WaitAll()
+{
+#ifdef R__USE_IMT
+   fGroup.Wait();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if a basket of this branch is being compressed or waits to be
+/// written.
+
+Bool_t TAsyncBasketWriter::IsPending(const TBranch *branch) const
+{
+   for (const auto &p : fPending) {
+      if (p->fBranch == branch)
+         return kTRUE;
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start the compression of the full basket `where` of the branch.
+///
+/// If the previous basket of the branch or too many baskets are still in
+/// flight, first wait for them to be written.
+
+void TAsyncBasketWriter::Submit(TBranch *branch, TBasket *basket, Int_t where, TFile *file)
+{
+   if (IsPending(branch)) {
+      Commit(kFALSE);
+      if (IsPending(branch))
+         Commit(kTRUE);
+   }
+   const Int_t size = basket->GetBufferRef()->BufferSize();
+   if (fMaxBytes > 0 && fPendingBytes + size > fMaxBytes) {
+      Commit(kFALSE);
+      if (fPendingBytes + size > fMaxBytes)
+         Commit(kTRUE);
+   }
+
+   fPending.emplace_back(new TPendingBasket(branch, basket, file, where, size));
+   fPendingBytes += size;
+   ++gNSubmittedBaskets;
+   TPendingBasket *p = fPending.back().get();
+   auto compress = [p]() {
+      p->fNout = p->fBasket->CompressBuffer(p->fFile);
+      p->fCompressed = true;
+   };
+#ifdef R__USE_IMT
+   fGroup.Run(compress);
+#else
+   compress();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a basket of the branch that was written and can be filled again, or
+/// nullptr if there is none.
+
+TBasket *TAsyncBasketWriter::TakeSpareBasket(TBranch *branch)
+{
+   auto it = fSpareBaskets.find(branch);
+   if (it == fSpareBaskets.end())
+      return nullptr;
+   TBasket *basket = it->second;
+   fSpareBaskets.erase(it);
+   return basket;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the compressed baskets to the file, in submission order, stopping at
+/// the first basket still being compressed unless `wait` is true.
+///
+/// Returns the number of baskets that could not be written.
+
+Int_t TAsyncBasketWriter::Commit(Bool_t wait)
+{
+   if (fPending.empty())
+      return 0;
+   if (wait)
+      WaitAll();
+
+   Int_t nerrors = 0;
+   while (!fPending.empty() && fPending.front()->fCompressed) {
+      TPendingBasket &p = *fPending.front();
+      const Int_t nout = p.fNout < 0 ? -1 : p.fBasket->WriteCompressedBuffer(p.fFile, p.fNout);
+      if (nout < 0)
+         ++nerrors;
+      if (TBasket *spare = p.fBranch->FinishAsyncWrite(p.fBasket, p.fWhere, nout)) {
+         auto &slot = fSpareBaskets[p.fBranch];
+         delete slot;
+         slot = spare;
+      }
+      fPendingBytes -= p.fSize;
+      fPending.pop_front();
+   }
+   return nerrors;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the compression tasks and forget about the baskets in flight
+/// without writing them.
+
+void TAsyncBasketWriter::Discard()
+{
+   WaitAll();
+   fPending.clear();
+   fPendingBytes = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget about the baskets of the branch, which is being reset or deleted:
+/// its baskets in flight are not written (the branch owns and deletes them)
+/// and its spare basket is deleted, so that it is not handed to another
+/// branch later allocated at the same address.
+
+void TAsyncBasketWriter::Discard(const TBranch *branch)
+{
+   if (IsPending(branch)) {
+      WaitAll();
+      for (auto it = fPending.begin(); it != fPending.end();) {
+         if ((*it)->fBranch == branch) {
+            fPendingBytes -= (*it)->fSize;
+            it = fPending.erase(it);
+         } else {
+            ++it;
+         }
+      }
+   }
+   auto spare = fSpareBaskets.find(branch);
+   if (spare != fSpareBaskets.end()) {
+      delete spare->second;
+      fSpareBaskets.erase(spare);
+   }
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of baskets handed to the asynchronous writers of the
+/// trees, in this process (see TTree::SetAsyncBasketWrite).
+
+ULong64_t ROOT::Internal::GetTAsyncBasketWriterNSubmittedBaskets()
+{
+   return gNSubmittedBaskets;
+}
@@ -0,0 +1,91 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TAsyncBasketWriter
+#define ROOT_TAsyncBasketWriter
+
+#include "RtypesCore.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+class TBasket;
+class TBranch;
+class TFile;
+
+/** \class ROOT::Internal::TAsyncBasketWriter
+ Compresses the full baskets of a TTree in background tasks while TTree::Fill
+ continues with fresh baskets (see TTree::SetAsyncBasketWrite).
+
+ The compressed baskets are written to the file by the filling thread, in the
+ order in which they were submitted, so that the allocation of their position
+ in the file does not depend on the scheduling of the tasks.
+ At most one basket per branch is in flight (the branches use a single
+ compression buffer), optionally with a limit on the total size of the baskets
+ in flight.
+*/
+
+namespace ROOT {
+namespace Internal {
+
+class TAsyncBasketWriter {
+
+   struct TPendingBasket {
+      TBranch *fBranch;
+      TBasket *fBasket;
+      TFile   *fFile;
+      Int_t    fWhere;                 ///< Index of the basket in its branch
+      Int_t    fSize;                  ///< Size of the buffer of the basket
+      Int_t    fNout{0};               ///< Result of TBasket::CompressBuffer
+      std::atomic<bool> fCompressed{false};
+
+      TPendingBasket(TBranch *branch, TBasket *basket, TFile *file, Int_t where, Int_t size)
+         : fBranch(branch), fBasket(basket), fFile(file), fWhere(where), fSize(size)
+      {
+      }
+   };
+
+   Long64_t fMaxBytes{0};     ///< Maximum total size of the baskets in flight, 0 for no limit.
+   Long64_t fPendingBytes{0}; ///< Total size of the baskets in flight.
+   std::deque<std::unique_ptr<TPendingBasket>> fPending;     ///< Baskets in flight, in submission order.
+   std::unordered_map<const TBranch *, TBasket *> fSpareBaskets; ///< Written baskets, ready to be filled again.
+#ifdef R__USE_IMT
+   ROOT::Experimental::TTaskGroup fGroup;
+#endif
+
+   void WaitAll();
+
+public:
+   explicit TAsyncBasketWriter(Long64_t maxbytes) : fMaxBytes(maxbytes) {}
+   TAsyncBasketWriter(const TAsyncBasketWriter &) = delete;
+   TAsyncBasketWriter &operator=(const TAsyncBasketWriter &) = delete;
+   ~TAsyncBasketWriter();
+
+   Long64_t GetMaxBytes() const { return fMaxBytes; }
+   Bool_t   IsEmpty() const { return fPending.empty(); }
+   Bool_t   IsPending(const TBranch *branch) const;
+
+   void     Submit(TBranch *branch, TBasket *basket, Int_t where, TFile *file);
+   TBasket *TakeSpareBasket(TBranch *branch);
+   Int_t    Commit(Bool_t wait);
+   void     Discard();
+   void     Discard(const TBranch *branch);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
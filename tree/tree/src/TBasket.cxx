@@ -303,6 +303,42 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Load basket buffers without unziping from the raw bytes of the basket
+/// (key and compressed payload) that were already read into memory.
+/// This function is called by TTreeCloner when the reading of the input
+/// baskets is overlapped with the writing of the output baskets.
+/// The function returns 0 in case of success, 1 in case of error.
+
+Int_t TBasket::LoadBasketBuffersFromMemory(const char *buffer, Int_t len, TFile *file)
+{
+   if (!buffer || len <= 0)
+      return 1;
+
+   if (fBufferRef) {
+      // Reuse the buffer if it exist.
+      fBufferRef->Reset();
+
+      // We use this buffer both for reading and writing, we need to
+      // make sure it is properly sized for writing.
+      fBufferRef->SetWriteMode();
+      if (fBufferRef->BufferSize() < len) {
+         fBufferRef->Expand(len);
+      }
+      fBufferRef->SetReadMode();
+   } else {
+      fBufferRef = new TBufferFile(TBuffer::kRead, len);
+   }
+   fBufferRef->SetParent(file);
+   memcpy(fBufferRef->Buffer(), buffer, len);
+
+   fBufferRef->SetReadMode();
+   fBufferRef->SetBufferOffset(0);
+   Streamer(*fBufferRef);
+
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Remove the first dentries of this basket, moving entries at
 /// dentries to the start of the buffer.
@@ -618,7 +654,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
             goto AfterBuffer;
          }
 
-         R__unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
+         R__unzipDict(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout,
+                      fBranch->GetDecompressionDictionary());
          if (!nout) break;
          noutot += nout;
          nintot += nin;
@@ -1139,16 +1176,13 @@ Int_t TBasket::WriteBuffer()
    }
    fMotherDir = file; // fBranch->GetDirectory();
 
-   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
-   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
-   //
-   // The only parallelism we'd like to exploit (right now!) is the compression
-   // step - everything else should be serialized at the TFile level.
+   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
+      // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+      // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
 #ifdef R__USE_IMT
-   std::unique_lock<std::mutex> sentry(file->fWriteMutex);
+      std::lock_guard<std::mutex> sentry(file->fWriteMutex);
 #endif  // R__USE_IMT
 
-   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
       // Read the basket information that was saved inside the buffer.
       Bool_t writing = fBufferRef->IsWriting();
       fBufferRef->SetReadMode();
@@ -1170,6 +1204,28 @@ Int_t TBasket::WriteBuffer()
       return nBytes>0 ? fKeylen+nout : -1;
    }
 
+   fCycle = fBranch->GetWriteBasket();
+
+   // The only parallelism we'd like to exploit (right now!) is the compression
+   // step, which does not interact with the file; everything else is serialized
+   // at the TFile level by WriteCompressedBuffer.
+   Int_t nout = CompressBuffer(file);
+   if (nout < 0)
+      return -1;
+   return WriteCompressedBuffer(file, nout);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// First step of WriteBuffer: store the entry offsets at the end of the buffer
+/// and compress it with the settings of the branch (or of the file).
+///
+/// This does not modify the file: several baskets (of different branches) can
+/// be compressed at the same time.
+/// Returns the number of bytes of the (possibly compressed) payload, to be
+/// passed to WriteCompressedBuffer, or -1 in case of error.
+
+Int_t TBasket::CompressBuffer(TFile *file)
+{
    // Transfer fEntryOffset table at the end of fBuffer.
    fLast = fBufferRef->Length();
    Int_t *entryOffset = GetEntryOffset();
@@ -1208,8 +1264,6 @@ Int_t TBasket::WriteBuffer()
 
    fObjlen = fBufferRef->Length() - fKeylen;
 
-   fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
@@ -1217,6 +1271,7 @@ Int_t TBasket::WriteBuffer()
    if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
       cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(file->GetCompressionAlgorithm());
    if (cxlevel > 0) {
+      const std::vector<char> &dict = fBranch->GetCompressionDictionary();
       Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
       Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
       InitializeCompressedBuffer(buflen, file);
@@ -1233,59 +1288,67 @@ Int_t TBasket::WriteBuffer()
       for (Int_t i = 0; i < nbuffers; ++i) {
          if (i == nbuffers - 1) bufmax = fObjlen - nzip;
          else bufmax = kMAXZIPBUF;
+         // Possibly trains the branch's compression dictionary, which is then already used for this basket
+         if (i == 0)
+            fBranch->AddCompressionDictionarySample(objbuf, fObjlen);
          // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
          // for a given TFile: that's because the compression buffer when we use IMT is no longer
          // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-#ifdef R__USE_IMT
-         sentry.lock();
-#endif  // R__USE_IMT
+         R__zipMultipleAlgorithmDict(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm, dict.data(),
+                                     dict.size());
 
          // test if buffer has really been compressed. In case of small buffers
          // when the buffer contains random data, it may happen that the compressed
          // buffer is larger than the input. In this case, we write the original uncompressed buffer
          if (nout == 0 || nout >= fObjlen) {
-            nout = fObjlen;
             // We used to delete fBuffer here, we no longer want to since
             // the buffer (held by fCompressedBufferRef) might be re-used later.
             fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
-            if ((nout+fKeylen)>buflen) {
+            if ((fObjlen+fKeylen)>buflen) {
                Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
-                  (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
+                  (fObjlen+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
             }
-            goto WriteFile;
+            return fObjlen;
          }
          bufcur += nout;
          noutot += nout;
          objbuf += kMAXZIPBUF;
          nzip   += kMAXZIPBUF;
       }
-      nout = noutot;
-      Create(noutot,file);
-      fBufferRef->SetBufferOffset(0);
+      return noutot;
+   }
 
-      Streamer(*fBufferRef);         //write key itself again
-      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
-   } else {
-      fBuffer = fBufferRef->Buffer();
-      Create(fObjlen,file);
-      fBufferRef->SetBufferOffset(0);
+   fBuffer = fBufferRef->Buffer();
+   return fObjlen;
+}
 
-      Streamer(*fBufferRef);         //write key itself again
-      nout = fObjlen;
+////////////////////////////////////////////////////////////////////////////////
+/// Second step of WriteBuffer: allocate the key of the basket in the file for
+/// a payload of nout bytes (as returned by CompressBuffer) and write it.
+///
+/// The function returns the number of bytes written, or -1 in case of error.
+
+Int_t TBasket::WriteCompressedBuffer(TFile *file, Int_t nout)
+{
+   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
+#ifdef R__USE_IMT
+   std::lock_guard<std::mutex> sentry(file->fWriteMutex);
+#endif  // R__USE_IMT
+
+   fHeaderOnly = kTRUE;
+   Create(nout,file);
+   fBufferRef->SetBufferOffset(0);
+
+   Streamer(*fBufferRef);         //write key itself again
+   if (fBuffer != fBufferRef->Buffer()) {
+      // The payload is in the compressed buffer, the key must precede it.
+      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
    }
 
-WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
    fHeaderOnly = kFALSE;
    return nBytes>0 ? fKeylen+nout : -1;
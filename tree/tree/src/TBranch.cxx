@@ -15,8 +15,10 @@
 
 #include "Bytes.h"
 #include "Compression.h"
+#include "RZip.h"
 #include "TBasket.h"
 #include "TBranchBrowsable.h"
+#include "TBranchElement.h"
 #include "TBrowser.h"
 #include "TBuffer.h"
 #include "TClass.h"
@@ -46,17 +48,21 @@
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
+#include "TVirtualStreamerInfo.h"
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#include "TAsyncBasketWriter.h"
 #include "TBranchIMTHelper.h"
 
 #include "ROOT/TIOFeatures.hxx"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <cstdio>
+#include <limits>
 
 
 Int_t TBranch::fgCount = 0;
@@ -113,12 +119,17 @@ TBranch::TBranch()
 , fBasketBytes(0)
 , fBasketEntry(0)
 , fBasketSeek(0)
+, fBasketMin(nullptr)
+, fBasketMax(nullptr)
 , fTree(0)
 , fMother(0)
 , fParent(0)
 , fAddress(0)
 , fDirectory(0)
 , fFileName("")
+, fDecompressionDict(nullptr)
+, fDictTrainingBaskets(0)
+, fDictMaxSize(0)
 , fEntryBuffer(0)
 , fTransientBuffer(0)
 , fBrowsables(0)
@@ -226,12 +237,17 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fBasketBytes(0)
 , fBasketEntry(0)
 , fBasketSeek(0)
+, fBasketMin(nullptr)
+, fBasketMax(nullptr)
 , fTree(tree)
 , fMother(0)
 , fParent(0)
 , fAddress((char *)address)
 , fDirectory(fTree->GetDirectory())
 , fFileName("")
+, fDecompressionDict(nullptr)
+, fDictTrainingBaskets(0)
+, fDictMaxSize(0)
 , fEntryBuffer(0)
 , fTransientBuffer(0)
 , fBrowsables(0)
@@ -280,12 +296,17 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fBasketBytes(0)
 , fBasketEntry(0)
 , fBasketSeek(0)
+, fBasketMin(nullptr)
+, fBasketMax(nullptr)
 , fTree(parent ? parent->GetTree() : 0)
 , fMother(parent ? parent->GetMother() : 0)
 , fParent(parent)
 , fAddress((char *)address)
 , fDirectory(fTree ? fTree->GetDirectory() : 0)
 , fFileName("")
+, fDecompressionDict(nullptr)
+, fDictTrainingBaskets(0)
+, fDictMaxSize(0)
 , fEntryBuffer(0)
 , fTransientBuffer(0)
 , fBrowsables(0)
@@ -452,18 +473,28 @@ TBranch::~TBranch()
    delete fBrowsables;
    fBrowsables = 0;
 
+   R__deleteZSTDDDict(fDecompressionDict);
+   fDecompressionDict = nullptr;
+
    // Note: We do *not* have ownership of the buffer.
    fEntryBuffer = 0;
 
    delete [] fBasketSeek;
    fBasketSeek  = 0;
 
+   delete [] fBasketMin;
+   fBasketMin = nullptr;
+   delete [] fBasketMax;
+   fBasketMax = nullptr;
+
    delete [] fBasketEntry;
    fBasketEntry = 0;
 
    delete [] fBasketBytes;
    fBasketBytes = 0;
 
+   if (fTree)
+      fTree->DiscardAsyncBaskets(this);
    fBaskets.Delete();
    fNBaskets = 0;
    fCurrentBasket = 0;
@@ -577,10 +608,19 @@ void TBranch::AddBasket(TBasket& b, Bool_t ondisk, Long64_t startEntry)
             fBasketEntry[j] = fBasketEntry[j-1];
             fBasketBytes[j] = fBasketBytes[j-1];
             fBasketSeek[j]  = fBasketSeek[j-1];
+            if (fBasketMin) {
+               fBasketMin[j] = fBasketMin[j-1];
+               fBasketMax[j] = fBasketMax[j-1];
+            }
          }
       }
    }
    fBasketEntry[where] = startEntry;
+   if (fBasketMin) {
+      // The values in a basket coming from elsewhere are unknown.
+      fBasketMin[where] = -std::numeric_limits<Double_t>::infinity();
+      fBasketMax[where] = std::numeric_limits<Double_t>::infinity();
+   }
 
    TBasket *existing = (TBasket*)fBaskets.At(fWriteBasket);
    if (existing && existing->GetNevBuf()) {
@@ -610,6 +650,39 @@ void TBranch::AddBasket(TBasket& b, Bool_t ondisk, Long64_t startEntry)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the uncompressed content of a basket to the samples used to train the
+/// compression dictionary, see SetCompressionDictionary(). Called by
+/// TBasket::WriteBuffer before compressing the basket. Once enough baskets are
+/// sampled, the dictionary is trained: it is used for this basket and all the
+/// following ones.
+
+void TBranch::AddCompressionDictionarySample(const char *buffer, Int_t size)
+{
+   if (fDictTrainingBaskets <= 0 || size <= 0)
+      return;
+
+   fDictSamples.insert(fDictSamples.end(), buffer, buffer + size);
+   fDictSampleSizes.emplace_back(size);
+   if (--fDictTrainingBaskets > 0)
+      return;
+
+   std::vector<char> dict(fDictMaxSize);
+   Int_t dictSize = R__trainZSTDDict(dict.data(), fDictMaxSize, fDictSamples.data(), fDictSampleSizes.data(),
+                                     fDictSampleSizes.size());
+   if (dictSize > 0) {
+      dict.resize(dictSize);
+      fCompressionDict = std::move(dict);
+      UpdateDecompressionDictionary();
+   } else {
+      Warning("AddCompressionDictionarySample",
+              "Training the compression dictionary of branch %s failed, its baskets are compressed without dictionary",
+              GetName());
+   }
+   std::vector<char>().swap(fDictSamples);
+   std::vector<size_t>().swap(fDictSampleSizes);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add the start entry of the write basket (not yet created)
 
@@ -828,6 +901,10 @@ void TBranch::ExpandBasketArrays()
                                                 newsize*sizeof(Long64_t),fMaxBaskets*sizeof(Long64_t));
    fBasketSeek   = (Long64_t*)TStorage::ReAlloc(fBasketSeek,
                                                 newsize*sizeof(Long64_t),fMaxBaskets*sizeof(Long64_t));
+   if (fBasketMin) {
+      fBasketMin = (Double_t*)TStorage::ReAlloc(fBasketMin, newsize*sizeof(Double_t), fMaxBaskets*sizeof(Double_t));
+      fBasketMax = (Double_t*)TStorage::ReAlloc(fBasketMax, newsize*sizeof(Double_t), fMaxBaskets*sizeof(Double_t));
+   }
 
    fMaxBaskets   = newsize;
 
@@ -837,6 +914,10 @@ void TBranch::ExpandBasketArrays()
       fBasketBytes[i] = 0;
       fBasketEntry[i] = 0;
       fBasketSeek[i]  = 0;
+      if (fBasketMin) {
+         fBasketMin[i] = -std::numeric_limits<Double_t>::infinity();
+         fBasketMax[i] = std::numeric_limits<Double_t>::infinity();
+      }
    }
 }
 
@@ -889,6 +970,16 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
       ++fEntries;
       ++fEntryNumber;
       (this->*fFillLeaves)(*buf);
+      if (R__unlikely(fBasketMin)) {
+         Double_t value = static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetValue(0);
+         if (basket->GetNevBuf() == 1) {
+            fBasketMin[fWriteBasket] = value;
+            fBasketMax[fWriteBasket] = value;
+         } else {
+            if (value < fBasketMin[fWriteBasket]) fBasketMin[fWriteBasket] = value;
+            if (value > fBasketMax[fWriteBasket]) fBasketMax[fWriteBasket] = value;
+         }
+      }
       if (buf->GetMapCount()) {
          // The map is used.
          ResetBit(TBranch::kDoNotUseBufferMap);
@@ -920,7 +1011,10 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
    if (noFlushAtCluster && !fTree->TestBit(TTree::kCircular) &&
        ((fSkipZip && (lnew >= TBuffer::kMinimalSize)) || (buf->TestBit(TBufferFile::kNotDecompressed)) ||
         ((lnew + (2 * nsize) + nbytes) >= fBasketSize))) {
-      Int_t nout = WriteBasketImpl(basket, fWriteBasket, imtHelper);
+      ROOT::Internal::TAsyncBasketWriter *asyncWriter = imtHelper ? imtHelper->GetAsyncWriter() : nullptr;
+      Int_t nout = (asyncWriter && basket->IsA() == TBasket::Class() && !buf->TestBit(TBufferFile::kNotDecompressed))
+                      ? WriteBasketAsync(basket, *asyncWriter)
+                      : WriteBasketImpl(basket, fWriteBasket, imtHelper);
       if (nout < 0) Error("TBranch::Fill", "Failed to write out basket.\n");
       return (nout >= 0) ? nbytes : -1;
    }
@@ -1303,6 +1397,22 @@ Long64_t TBranch::GetBasketSeek(Int_t basketnumber) const
    return fBasketSeek[basketnumber];
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Get the range of the values stored in a basket, see SetBasketMinMax().
+///
+/// Returns kFALSE if the range was not recorded for this branch or if the
+/// basket number is invalid. A basket whose values are unknown, e.g. because
+/// it was copied from another file by a fast merge, has the range
+/// [-inf, +inf].
+
+Bool_t TBranch::GetBasketMinMax(Int_t basketnumber, Double_t &min, Double_t &max) const
+{
+   if (!fBasketMin || basketnumber < 0 || basketnumber > fWriteBasket) return kFALSE;
+   min = fBasketMin[basketnumber];
+   max = fBasketMax[basketnumber];
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns (and, if 0, creates) browsable objects for this branch
 /// See TVirtualBranchBrowsable::FillListOfBrowsables.
@@ -2450,6 +2560,16 @@ void TBranch::Refresh(TBranch* b)
       fBasketEntry[i] = b->fBasketEntry[i];
       fBasketSeek[i]  = b->fBasketSeek[i];
    }
+   delete [] fBasketMin;
+   delete [] fBasketMax;
+   fBasketMin = nullptr;
+   fBasketMax = nullptr;
+   if (b->fBasketMin) {
+      fBasketMin = new Double_t[fMaxBaskets];
+      fBasketMax = new Double_t[fMaxBaskets];
+      std::copy(b->fBasketMin, b->fBasketMin + fMaxBaskets, fBasketMin);
+      std::copy(b->fBasketMax, b->fBasketMax + fMaxBaskets, fBasketMax);
+   }
    fBaskets.Delete();
    Int_t nbaskets = b->fBaskets.GetSize();
    fBaskets.Expand(nbaskets);
@@ -2502,6 +2622,8 @@ void TBranch::Reset(Option_t*)
       }
    }
 
+   if (fTree)
+      fTree->DiscardAsyncBaskets(this);
    fBaskets.Delete();
    fNBaskets = 0;
 }
@@ -2543,6 +2665,8 @@ void TBranch::ResetAfterMerge(TFileMergeInfo *)
       }
    }
 
+   if (fTree)
+      fTree->DiscardAsyncBaskets(this);
    TBasket *reusebasket = (TBasket*)fBaskets[fWriteBasket];
    if (reusebasket) {
       fBaskets[fWriteBasket] = 0;
@@ -2639,6 +2763,53 @@ void TBranch::SetAutoDelete(Bool_t autodel)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Record (or stop recording) the minimum and maximum value of each basket.
+///
+/// The ranges are stored with the branch, next to the basket addresses; they
+/// allow readers to skip the baskets that cannot satisfy a cut on this branch
+/// without reading them, see TTree::SelectBaskets(). This is most effective
+/// for sorted or clustered quantities such as run numbers or time stamps.
+///
+/// Only branches holding a single numerical value per entry are supported
+/// (e.g. "run/i", or a split data member of a basic type); the values are
+/// converted to Double_t, so 64 bits integers above 2^53 are rounded.
+/// The baskets filled before this call get an unknown range.
+///
+/// Returns kFALSE if the branch does not support recording the ranges.
+
+Bool_t TBranch::SetBasketMinMax(Bool_t record)
+{
+   if (!record) {
+      delete [] fBasketMin;
+      delete [] fBasketMax;
+      fBasketMin = nullptr;
+      fBasketMax = nullptr;
+      return kTRUE;
+   }
+   if (fBasketMin) return kTRUE;
+
+   TLeaf *leaf = fNleaves == 1 ? static_cast<TLeaf*>(fLeaves.UncheckedAt(0)) : nullptr;
+   Bool_t supported = leaf && !fBranches.GetEntriesFast() && !leaf->GetLeafCount() && leaf->GetLenStatic() == 1 &&
+                      leaf->GetLenType() > 0 && !leaf->InheritsFrom(TLeafC::Class()) &&
+                      !leaf->InheritsFrom(TLeafObject::Class());
+   if (supported && InheritsFrom(TBranchElement::Class())) {
+      auto element = static_cast<TBranchElement*>(this);
+      supported = element->GetType() == 0 && element->GetStreamerType() > 0 &&
+                  element->GetStreamerType() < TVirtualStreamerInfo::kOffsetL;
+   }
+   if (!supported) {
+      Error("SetBasketMinMax", "Branch %s does not hold a single numerical value per entry.", GetName());
+      return kFALSE;
+   }
+
+   fBasketMin = new Double_t[fMaxBaskets];
+   fBasketMax = new Double_t[fMaxBaskets];
+   std::fill(fBasketMin, fBasketMin + fMaxBaskets, -std::numeric_limits<Double_t>::infinity());
+   std::fill(fBasketMax, fBasketMax + fMaxBaskets, std::numeric_limits<Double_t>::infinity());
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the basket size
 /// The function makes sure that the basket size is greater than fEntryOffsetlen
@@ -2730,6 +2901,66 @@ void TBranch::SetCompressionSettings(Int_t settings)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the baskets of this branch and of its sub-branches with a ZSTD
+/// dictionary trained on the branch's own data.
+///
+/// The first nTrainingBaskets baskets are sampled; the dictionary, of at most
+/// maxDictSize bytes, is trained before the last sampled basket is compressed
+/// and used from then on. The baskets written before are compressed without
+/// dictionary. The dictionary is stored with the branch and registered for
+/// decompression when the tree is read back.
+///
+/// Dictionaries considerably improve the compression ratio and speed of small
+/// baskets, whose content is too short to build up a useful history. They are
+/// only used if the compression algorithm of the baskets is ZSTD.
+/// A branch that already has a dictionary keeps it.
+
+void TBranch::SetCompressionDictionary(Int_t nTrainingBaskets, Int_t maxDictSize)
+{
+   if (fCompressionDict.empty()) {
+      fDictTrainingBaskets = nTrainingBaskets;
+      fDictMaxSize = maxDictSize;
+   }
+
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i=0;i<nb;i++) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->SetCompressionDictionary(nTrainingBaskets, maxDictSize);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the following baskets of this branch with the given ZSTD
+/// dictionary, e.g. one trained with R__trainZSTDDict on representative data.
+/// Unlike SetCompressionDictionary(Int_t, Int_t), the sub-branches are not
+/// affected. A branch that already has a dictionary keeps it: its baskets
+/// could not be read otherwise.
+
+void TBranch::SetCompressionDictionary(const std::vector<char> &dict)
+{
+   if (!fCompressionDict.empty()) {
+      Error("SetCompressionDictionary", "Branch %s already has a compression dictionary", GetName());
+      return;
+   }
+   fCompressionDict = dict;
+   fDictTrainingBaskets = 0;
+   UpdateDecompressionDictionary();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Digest fCompressionDict for the decompression of the baskets, see
+/// TBasket::ReadBasketBuffers. The digested dictionary belongs to the branch,
+/// so that branches with different dictionaries never mix them up.
+
+void TBranch::UpdateDecompressionDictionary()
+{
+   R__deleteZSTDDDict(fDecompressionDict);
+   fDecompressionDict = fCompressionDict.empty()
+                           ? nullptr
+                           : R__createZSTDDDict(fCompressionDict.data(), fCompressionDict.size());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Update the default value for the branch's fEntryOffsetLen if and only if
 /// it was already non zero (and the new value is not zero)
@@ -2887,6 +3118,7 @@ void TBranch::Streamer(TBuffer& b)
       Version_t v = b.ReadVersion(&R__s, &R__c);
       if (v > 9) {
          b.ReadClassBuffer(TBranch::Class(), this, v, R__s, R__c);
+         UpdateDecompressionDictionary();
 
          if (fWriteBasket>=fBaskets.GetSize()) {
             fBaskets.Expand(fWriteBasket+1);
@@ -3118,14 +3350,7 @@ void TBranch::Streamer(TBuffer& b)
 
 Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *imtHelper)
 {
-   Int_t nevbuf = basket->GetNevBuf();
-   if (fEntryOffsetLen > 10 &&  (4*nevbuf) < fEntryOffsetLen ) {
-      // Make sure that the fEntryOffset array does not stay large unnecessarily.
-      fEntryOffsetLen = nevbuf < 3 ? 10 : 4*nevbuf; // assume some fluctuations.
-   } else if (fEntryOffsetLen && nevbuf > fEntryOffsetLen) {
-      // Increase the array ...
-      fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
-   }
+   UpdateEntryOffsetLen(basket->GetNevBuf());
 
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
@@ -3190,6 +3415,93 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the current (full) basket to the asynchronous writer of the tree and
+/// continue filling a new basket, see TTree::SetAsyncBasketWrite.
+///
+/// The basket stays in fBaskets until it is written, then FinishAsyncWrite
+/// updates the branch. Returns 0, the number of bytes written so far.
+
+Int_t TBranch::WriteBasketAsync(TBasket* basket, ROOT::Internal::TAsyncBasketWriter &writer)
+{
+   constexpr Int_t kWrite = 1;
+
+   TFile *file = GetFile(kWrite);
+   if (!file || !file->IsWritable()) {
+      return WriteBasketImpl(basket, fWriteBasket, nullptr);
+   }
+
+   UpdateEntryOffsetLen(basket->GetNevBuf());
+
+   basket->fMotherDir = file;
+   basket->fCycle = fWriteBasket;
+   writer.Submit(this, basket, fWriteBasket, file);
+
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+   if (TBasket *spare = writer.TakeSpareBasket(this)) {
+      ++fNBaskets;
+      fBaskets.AddAtAndExpand(spare, fWriteBasket);
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record that the basket `where`, handed to the asynchronous writer by
+/// WriteBasketAsync, was written to the file (nout is the number of bytes
+/// written, or -1 in case of error).
+///
+/// Returns the basket, reset and ready to be filled again, or nullptr if it
+/// could not be written (it then stays in memory).
+
+TBasket *TBranch::FinishAsyncWrite(TBasket* basket, Int_t where, Int_t nout)
+{
+   if (nout <= 0) {
+      Error("FinishAsyncWrite", "Failed to write out basket %d.", where);
+      return nullptr;
+   }
+
+   fBasketBytes[where] = basket->GetNbytes();
+   fBasketSeek[where]  = basket->GetSeekKey();
+   Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+   fZipBytes += nout;
+   fTotBytes += addbytes;
+   fTree->AddTotBytes(addbytes);
+   fTree->AddZipBytes(nout);
+
+   fBaskets[where] = 0;
+   --fNBaskets;
+   if (basket == fCurrentBasket) {
+      fCurrentBasket    = 0;
+      fFirstBasketEntry = -1;
+      fNextBasketEntry  = -1;
+   }
+   basket->WriteReset();
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+   fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+   fTree->AddAllocationCount(basket->GetResetAllocationCount());
+   return basket;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adapt the length of the entry offset array of the next baskets to the
+/// number of entries of the basket being written.
+
+void TBranch::UpdateEntryOffsetLen(Int_t nevbuf)
+{
+   if (fEntryOffsetLen > 10 &&  (4*nevbuf) < fEntryOffsetLen ) {
+      // Make sure that the fEntryOffset array does not stay large unnecessarily.
+      fEntryOffsetLen = nevbuf < 3 ? 10 : 4*nevbuf; // assume some fluctuations.
+   } else if (fEntryOffsetLen && nevbuf > fEntryOffsetLen) {
+      // Increase the array ...
+      fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
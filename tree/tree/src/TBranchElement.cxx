@@ -18,6 +18,7 @@ A Branch for the case of an object.
 #include "TBranchElement.h"
 
 #include "TBasket.h"
+#include "Bytes.h"
 #include "TBranchObject.h"
 #include "TBranchRef.h"
 #include "TBrowser.h"
@@ -2764,6 +2765,189 @@ Int_t TBranchElement::GetExpectedType(TClass *&expectedClass,EDataType &expected
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch holds a std::vector of a fundamental type that
+/// can be read with GetBulkCollectionEntries.
+///
+/// This is the case for non-split top-level std::vector<T> branches and for
+/// std::vector<T> data members of split objects, where T is a numerical type;
+/// the bulk read may still fail depending on the content of the
+/// baskets (for example if the collection was streamed member-wise).
+
+Bool_t TBranchElement::SupportsBulkCollectionRead() const
+{
+   if (fNleaves != 1 || fType != 0 || fBranches.GetEntriesFast() != 0)
+      return kFALSE;
+   if (fID != -1 && fStreamerType != TVirtualStreamerInfo::kSTL)
+      return kFALSE;
+
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   if (const_cast<TBranchElement *>(this)->GetExpectedType(cl, type) || !cl)
+      return kFALSE;
+   TVirtualCollectionProxy *proxy = cl->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->HasPointers() || proxy->GetValueClass())
+      return kFALSE;
+
+   switch (proxy->GetType()) {
+   case kChar_t:
+   case kUChar_t:
+   case kShort_t:
+   case kUShort_t:
+   case kInt_t:
+   case kUInt_t:
+   case kFloat_t:
+   case kLong64_t:
+   case kULong64_t:
+   case kDouble_t: return kTRUE;
+   default: return kFALSE;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the entries of the basket starting at `entry` into user_buf, for
+/// a branch holding a std::vector of a fundamental type.
+///
+/// Returns -1 in case of failure; on success, returns the number N of entries
+/// read.  The elements of all N collections are then stored contiguously, in
+/// host byte order, at the beginning of user_buf.Buffer(); offsets_buf holds
+/// N+1 Int_t such that the elements of the i-th entry are at indices
+/// [offsets[i], offsets[i+1]).  As with GetBulkEntries, the basket buffer is
+/// handed over to user_buf whenever possible, so that the elements are
+/// decoded in place without an additional copy.
+///
+/// The same restrictions as for GetBulkEntries apply: `entry` must be the
+/// first entry of a basket and the basket must not have displacements.
+
+Int_t TBranchElement::GetBulkCollectionEntries(Long64_t entry, TBuffer &user_buf, TBuffer &offsets_buf)
+{
+   if (R__unlikely(!SupportsBulkCollectionRead()))
+      return -1;
+
+   TClass *cl = nullptr;
+   EDataType type = kOther_t;
+   GetExpectedType(cl, type);
+   const EDataType valueType = EDataType(cl->GetCollectionProxy()->GetType());
+   const Int_t valueSize = TDataType::GetDataType(valueType)->Size();
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   if (R__unlikely(TestBit(kDoNotProcess)))
+      return -1;
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0))
+      return -1;
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first))
+      return -1;
+
+   basket->PrepareBasket(entry);
+   TBuffer *buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkCollectionEntries", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkCollectionEntries", "Basket has displacement.\n");
+      return -1;
+   }
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffset)) {
+      Error("GetBulkCollectionEntries", "Basket has no entry offsets.\n");
+      return -1;
+   }
+
+   const Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+   const Int_t offsetsLen = (N + 1) * sizeof(Int_t);
+   if (offsets_buf.BufferSize() < offsetsLen)
+      offsets_buf.AutoExpand(offsetsLen);
+   Int_t *offsets = reinterpret_cast<Int_t *>(offsets_buf.Buffer());
+
+   // Each entry is made of a byte count, the collection version (possibly followed by a
+   // checksum), the number of elements and the big-endian elements themselves. Check the
+   // layout of all the entries before modifying anything, so that a failure leaves the
+   // basket intact.
+   const UInt_t kByteCountMask = 0x40000000;  // OR the byte count with this
+   const Int_t last = basket->GetLast();
+   offsets[0] = 0;
+   for (Int_t i = 0; i < N; ++i) {
+      const Int_t begin = entryOffset[i];
+      const Int_t end = (i + 1 < N) ? entryOffset[i + 1] : last;
+      if (R__unlikely(end - begin < 10)) {
+         Error("GetBulkCollectionEntries", "Entry %lld is too short for a collection.\n", first + i);
+         return -1;
+      }
+      char *cursor = buf->Buffer() + begin;
+      UInt_t byteCount;
+      Version_t version;
+      Int_t n;
+      frombuf(cursor, &byteCount);
+      frombuf(cursor, &version);
+      if (version == 0) {
+         // Foreign class: the version is followed by the checksum.
+         cursor += sizeof(UInt_t);
+      }
+      frombuf(cursor, &n);
+      const Int_t header = cursor - (buf->Buffer() + begin);
+      if (R__unlikely(!(byteCount & kByteCountMask) || (version & TBufferFile::kStreamedMemberWise) || n < 0 ||
+                      Int_t(byteCount & ~kByteCountMask) + Int_t(sizeof(UInt_t)) != end - begin ||
+                      header + n * valueSize != end - begin)) {
+         Error("GetBulkCollectionEntries", "Unexpected layout for entry %lld.\n", first + i);
+         return -1;
+      }
+      offsets[i + 1] = offsets[i] + n;
+   }
+
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket]) {
+         // It is backed, so we can be destructive
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy, we can't return it as is to the user, just make a copy.
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   // Compact the elements of all the entries at the beginning of the buffer: they are at
+   // the end of each entry. The destination never overtakes the source, since at least
+   // the per-entry header is dropped.
+   char *data = user_buf.Buffer();
+   for (Int_t i = 0; i < N; ++i) {
+      const Int_t end = (i + 1 < N) ? entryOffset[i + 1] : last;
+      const Int_t n = offsets[i + 1] - offsets[i];
+      memmove(data + offsets[i] * valueSize, data + end - n * valueSize, n * valueSize);
+   }
+   const Int_t nElements = offsets[N];
+   offsets_buf.SetBufferOffset(0);
+
+   user_buf.SetBufferOffset(0);
+   if (valueSize > 1)
+      user_buf.ByteSwapBuffer(nElements, valueType);
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the 'full' name of the branch.  In particular prefix  the mother's name
 /// when it does not end in a trailing dot and thus is not part of the branch name
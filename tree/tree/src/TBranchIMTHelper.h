@@ -25,6 +25,8 @@
 namespace ROOT {
 namespace Internal {
 
+class TAsyncBasketWriter;
+
 class TBranchIMTHelper {
 
 #ifdef R__USE_IMT
@@ -57,9 +59,14 @@ public:
    Long64_t GetNbytes() { return fBytes; }
    Long64_t GetNerrors() {  return fNerrors; }
 
+   /// The writer to which full baskets are handed during TTree::Fill, if any (see TTree::SetAsyncBasketWrite).
+   TAsyncBasketWriter *GetAsyncWriter() const { return fAsyncWriter; }
+   void SetAsyncWriter(TAsyncBasketWriter *writer) { fAsyncWriter = writer; }
+
 private:
    std::atomic<Long64_t> fBytes{0};   ///< Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; ///< Total error count of all tasks done by this helper.
+   TAsyncBasketWriter   *fAsyncWriter{nullptr}; ///< Asynchronous writer of the full baskets, not owned.
 #ifdef R__USE_IMT
    std::unique_ptr<TaskGroup_t> fGroup;
 #endif
@@ -2415,6 +2415,16 @@ Long64_t TChain::Scan(const char* varexp, const char* selection, Option_t* optio
    return TTree::Scan(varexp, selection, option, nentries, firstentry);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Not supported for chains: the basket ranges are local to each tree, call
+/// TTree::SelectBaskets on the trees of the chain instead.
+
+TEntryList *TChain::SelectBaskets(const char *, Double_t, Double_t)
+{
+   Error("SelectBaskets", "Not supported for TChain, call it on each of its trees.");
+   return nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the global branch kAutoDelete bit.
 ///
@@ -113,6 +113,13 @@ TLeafElement::GetDeserializeType() const
    if (R__unlikely(fDeserializeTypeCache.load(std::memory_order_relaxed) != DeserializeType::kInvalid))
       return fDeserializeTypeCache;
 
+   // Variable size arrays (`//[fN]`) are prefixed by a flag byte in each entry
+   // and their length depends on another branch; leave them to the regular IO.
+   if (fLeafCount || (fType > TVirtualStreamerInfo::kOffsetP && fType < TVirtualStreamerInfo::kObject)) {
+      fDeserializeTypeCache.store(DeserializeType::kExternal, std::memory_order_relaxed);
+      return DeserializeType::kExternal;
+   }
+
    TClass *clptr = nullptr;
    EDataType type = EDataType::kOther_t;
    if (fBranch->GetExpectedType(clptr, type)) {  // Returns non-zero in case of failure
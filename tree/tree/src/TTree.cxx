@@ -427,6 +427,7 @@ End_Macro
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#include "TAsyncBasketWriter.h"
 #include "TBranchIMTHelper.h"
 #include "TNotifyLink.h"
 
@@ -957,6 +958,9 @@ TTree::~TTree()
          CopyAddresses(clone,kTRUE);
       }
    }
+   // The baskets still being compressed belong to our branches.
+   delete fAsyncBasketWriter;
+   fAsyncBasketWriter = nullptr;
    // Get rid of our branches, note that this will also release
    // any memory allocated by TBranchElement::SetAddress().
    fBranches.Delete();
@@ -3483,6 +3487,12 @@ namespace {
 ///
 /// See TTree::CloneTree for a detailed explanation of the semantics of these 3 options.
 ///
+/// When 'fast' is specified and implicit multi-threading is enabled, 'option' can also
+/// contain 'parallel': the raw baskets of the input are then read in a task while the
+/// previously read ones are written to the output file (see TTreeCloner). Without 'fast',
+/// the baskets are unzipped and recompressed by several threads as soon as implicit
+/// multi-threading is enabled (see TTree::GetEntry and TTree::Fill).
+///
 /// If the tree or any of the underlying tree of the chain has an index, that index and any
 /// index in the subsequent underlying TTree objects will be merged.
 ///
@@ -3775,6 +3785,17 @@ void TTree::Delete(Option_t* option /* = "" */)
    delete this;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Forget about the baskets of the branch handed to the asynchronous writer
+/// (see SetAsyncBasketWrite) without writing them. Called by the branch when
+/// it is reset or deleted.
+
+void TTree::DiscardAsyncBaskets(const TBranch *branch)
+{
+   if (fAsyncBasketWriter)
+      fAsyncBasketWriter->Discard(branch);
+}
+
  ///////////////////////////////////////////////////////////////////////////////
  /// Called by TKey and TObject::Clone to automatically add us to a directory
  /// when we are read from a file.
@@ -4477,6 +4498,7 @@ Long64_t TTree::Draw(const char* varexp, const char* selection, Option_t* option
 
 void TTree::DropBaskets()
 {
+   FlushAsyncBaskets();
    TBranch* branch = 0;
    Int_t nb = fBranches.GetEntriesFast();
    for (Int_t i = 0; i < nb; ++i) {
@@ -4583,6 +4605,10 @@ Int_t TTree::Fill()
       fIMTFlush = true;
       fIMTZipBytes.store(0);
       fIMTTotBytes.store(0);
+      imtHelper.SetAsyncWriter(fAsyncBasketWriter);
+   } else if (fAsyncBasketWriter) {
+      // The full baskets are written synchronously, after the ones in flight.
+      nerror += fAsyncBasketWriter->Commit(kTRUE);
    }
 #endif
 
@@ -4622,6 +4648,9 @@ Int_t TTree::Fill()
 #ifdef R__USE_IMT
    if (fIMTFlush) {
       imtHelper.Wait();
+      // Write the baskets whose compression is already done, without waiting for the others.
+      if (fAsyncBasketWriter)
+         nerror += fAsyncBasketWriter->Commit(kFALSE);
       fIMTFlush = false;
       const_cast<TTree *>(this)->AddTotBytes(fIMTTotBytes);
       const_cast<TTree *>(this)->AddZipBytes(fIMTZipBytes);
@@ -5090,6 +5119,18 @@ Int_t TTree::FlushBaskets(Bool_t create_cluster) const
     return retval;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write the baskets handed to the asynchronous writer (see
+/// SetAsyncBasketWrite), waiting for their compression if needed.
+
+void TTree::FlushAsyncBaskets() const
+{
+   if (fAsyncBasketWriter && !fAsyncBasketWriter->IsEmpty()) {
+      if (fAsyncBasketWriter->Commit(kTRUE))
+         Error("FlushAsyncBaskets", "Failed to write out some baskets of tree %s.", GetName());
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal implementation of the FlushBaskets algorithm.
 /// Unlike the public interface, this does NOT create an explicit event cluster
@@ -5101,6 +5142,7 @@ Int_t TTree::FlushBaskets(Bool_t create_cluster) const
 Int_t TTree::FlushBasketsImpl() const
 {
    if (!fDirectory) return 0;
+   FlushAsyncBaskets();
    Int_t nbytes = 0;
    Int_t nerror = 0;
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
@@ -6424,6 +6466,10 @@ Long64_t TTree::LoadTree(Long64_t entry)
       return -1;
    }
 
+   // The baskets being compressed cannot be read.
+   if (R__unlikely(fAsyncBasketWriter))
+      FlushAsyncBaskets();
+
    // create cache if wanted
    if (fCacheDoAutoInit && entry >=0)
       SetCacheSizeAux();
@@ -7951,6 +7997,9 @@ void TTree::Reset(Option_t* option)
    delete fTreeIndex;
    fTreeIndex = 0;
 
+   if (fAsyncBasketWriter)
+      fAsyncBasketWriter->Discard();
+
    Int_t nb = fBranches.GetEntriesFast();
    for (Int_t i = 0; i < nb; ++i)  {
       TBranch* branch = (TBranch*) fBranches.UncheckedAt(i);
@@ -8035,6 +8084,54 @@ Long64_t TTree::Scan(const char* varexp, const char* selection, Option_t* option
    return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Select the entries of the baskets of a branch that may hold values in [min, max].
+///
+/// The range of the values of each basket must have been recorded when the
+/// tree was filled, see TBranch::SetBasketMinMax. The entries of the baskets
+/// whose range does not overlap [min, max] are not part of the returned
+/// TEntryList, which is owned by the caller (and attached to the current
+/// directory, like all TEntryLists). Setting it on the tree with
+/// SetEntryList (or passing it to TTreeReader) skips these baskets without
+/// reading or decompressing them, e.g.:
+/// ~~~{.cpp}
+///    tree->GetBranch("run")->SetBasketMinMax(); // before filling the tree
+///    ...
+///    tree->SetEntryList(tree->SelectBaskets("run", 1000, 1010));
+///    tree->Draw("x", "run >= 1000 && run <= 1010");
+///    ROOT::RDataFrame df(*tree); // also uses the entry list of the tree
+/// ~~~
+/// The selection is at basket granularity: the cut itself must still be applied.
+/// Returns nullptr if the branch does not exist or has no recorded ranges.
+
+TEntryList *TTree::SelectBaskets(const char *branchname, Double_t min, Double_t max)
+{
+   TBranch *branch = GetBranch(branchname);
+   if (!branch) {
+      Error("SelectBaskets", "Unknown branch %s", branchname);
+      return nullptr;
+   }
+   Double_t basketMin, basketMax;
+   if (!branch->GetBasketMinMax(0, basketMin, basketMax)) {
+      Error("SelectBaskets", "The ranges of the baskets of branch %s were not recorded, see TBranch::SetBasketMinMax",
+            branchname);
+      return nullptr;
+   }
+
+   TEntryList *list = new TEntryList(TString::Format("%s_baskets", branchname), "Entries of the selected baskets", this);
+   const Long64_t *basketEntry = branch->GetBasketEntry();
+   const Int_t lastBasket = branch->GetWriteBasket();
+   for (Int_t i = 0; i <= lastBasket; ++i) {
+      const Long64_t first = basketEntry[i];
+      const Long64_t last = (i < lastBasket) ? basketEntry[i + 1] : branch->GetEntries();
+      if (first >= last) continue;
+      branch->GetBasketMinMax(i, basketMin, basketMax);
+      if (basketMax < min || basketMin > max) continue;
+      for (Long64_t entry = first; entry < last; ++entry) list->Enter(entry);
+   }
+   return list;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a tree variable alias.
 ///
@@ -8090,6 +8187,45 @@ Bool_t TTree::SetAlias(const char* aliasName, const char* aliasFormula)
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the asynchronous writing of the baskets during Fill.
+///
+/// When enabled, and if implicit multi-threading is enabled (see
+/// ROOT::EnableImplicitMT and SetImplicitMT), a basket that becomes full
+/// during Fill is compressed in a background task while Fill continues with a
+/// fresh basket of the branch. The compressed baskets are then written to the
+/// file by the filling thread, during the following calls to Fill, in the
+/// order in which they became full: the layout of the file does not depend on
+/// the scheduling of the tasks. This removes the compression of the baskets
+/// from the latency of Fill.
+///
+/// At most one basket per branch is in flight: Fill waits for the previous
+/// basket of a branch to be written before handing the next one over, so that
+/// the memory used by the baskets is at most doubled. If maxbytes is
+/// positive, Fill also waits when the total size of the baskets in flight
+/// would exceed maxbytes.
+///
+/// All the baskets in flight are written by FlushBaskets (and hence by
+/// AutoSave and Write) and before reading entries. Objects other than the
+/// baskets of this tree should not be written to the file from other threads
+/// while the tree is being filled.
+///
+/// Baskets flushed at cluster boundaries (FlushBaskets, and all the baskets
+/// with kOnlyFlushAtCluster) are compressed as before.
+
+void TTree::SetAsyncBasketWrite(Bool_t enable, Long64_t maxbytes)
+{
+#ifdef R__USE_IMT
+   FlushAsyncBaskets();
+   delete fAsyncBasketWriter;
+   fAsyncBasketWriter = enable ? new ROOT::Internal::TAsyncBasketWriter(maxbytes) : nullptr;
+#else
+   if (enable)
+      Warning("SetAsyncBasketWrite", "ROOT was built without multi-threading support, baskets are written synchronously.");
+   (void)maxbytes;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This function may be called at the start of a program to change
 /// the default value for fAutoFlush.
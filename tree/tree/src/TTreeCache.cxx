@@ -129,6 +129,25 @@ Additionally, on the first miss of an event, we must iterate through all the
 This can be potentially a CPU-expensive operation compared to, e.g., the
 latency of a SSD.  This is why the miss cache is currently disabled by default.
 
+\anchor adaptive
+## Adaptive mode
+
+In adaptive mode (see the SetAdaptive method, or set `TTreeCache.Adaptive: 1`
+in the `.rootrc`) the cache keeps adjusting itself after the learning phase:
+
+- A branch that causes a cache miss is added to the cache, so that its
+  baskets are prefetched from the next cache fill on.
+- A branch whose cached baskets were not used during three consecutive cache
+  fills is removed from the cache (unless the branches were set manually).
+- The size of the cache follows the time spent waiting for the data compared
+  to the time spent processing it: when waiting takes more than 10% of the
+  time, the size is doubled, up to a maximum, so that each fill spans more
+  clusters and the latency of the storage is paid less often; when waiting
+  takes less than 1% of the time the size is halved, down to the size the
+  cache had when the adaptive mode was enabled.
+  This applies to synchronous reads; with asynchronous prefetching
+  (`TFile.AsyncPrefetching`), the next fill is already read in the background.
+
 \anchor examples
 ## Example usages of TTreeCache
 
@@ -299,6 +318,8 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include <algorithm>
+#include <chrono>
 #include <limits.h>
 
 Int_t TTreeCache::fgLearnEntries = 100;
@@ -322,6 +343,8 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntriesFast();
    fBranches = new TObjArray(nleaves);
+   if (gEnv->GetValue("TTreeCache.Adaptive", 0))
+      SetAdaptive();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -668,6 +691,106 @@ Int_t TTreeCache::DropBranch(const char *bname, Bool_t subbranches /*= kFALSE*/)
    return res;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable / disable the adaptive mode, see \ref adaptive.
+///
+/// The current size of the cache is the smallest size used by the adaptive
+/// mode; maxsize is the largest one (by default, 8 times the current size).
+
+void TTreeCache::SetAdaptive(Bool_t adaptive, Int_t maxsize)
+{
+   if (fAdaptive)
+      fBufferSizeMin = fAdaptiveMinSize; // back to the size set by the user
+   fAdaptive = adaptive;
+   fAdaptiveMinSize = fBufferSizeMin;
+   fAdaptiveMaxSize = (maxsize > fBufferSizeMin) ? maxsize : 8 * fBufferSizeMin;
+   fLastTransferEnd = -1;
+   fUnusedFills.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Adjust the size of the next cache fills given the duration of the transfer
+/// of the current one and the time elapsed since the end of the previous
+/// transfer, i.e. the time spent processing the entries of the previous fill.
+
+void TTreeCache::AdaptBufferSize(Long64_t transferStart, Long64_t transferEnd)
+{
+   const Long64_t processing = transferStart - fLastTransferEnd;
+   const Long64_t transfer = transferEnd - transferStart;
+   const bool first = fLastTransferEnd < 0;
+   fLastTransferEnd = transferEnd;
+   if (first || processing + transfer <= 0)
+      return;
+
+   const Double_t stall = Double_t(transfer) / (processing + transfer);
+   Int_t size = fBufferSizeMin;
+   if (stall > 0.1) {
+      size = std::min(fAdaptiveMaxSize, 2 * fBufferSizeMin);
+   } else if (stall < 0.01) {
+      size = std::max(fAdaptiveMinSize, fBufferSizeMin / 2);
+   }
+   if (size != fBufferSizeMin) {
+      if (gDebug > 0)
+         Info("AdaptBufferSize", "Waited for %.1f%% of the time, changing the cache size from %d to %d bytes",
+              100 * stall, fBufferSizeMin, size);
+      // The buffer itself grows as needed when the next fill is larger.
+      fBufferSizeMin = size;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove from the cache the branches whose cached baskets were not used
+/// during the last three fills. Called when moving to a new set of clusters,
+/// before the usage information of the baskets is reset.
+
+void TTreeCache::AdaptBranches()
+{
+   static constexpr Int_t kMaxUnusedFills = 3;
+
+   std::vector<TBranch *> unused;
+   for (Int_t i = 0; i < fNbranches; ++i) {
+      TBranch *b = (TBranch *)fBranches->UncheckedAt(i);
+      if (!b)
+         continue;
+      if (!b->fCacheInfo.NoneUsed()) {
+         fUnusedFills.erase(b);
+      } else if (++fUnusedFills[b] >= kMaxUnusedFills) {
+         unused.push_back(b);
+      }
+   }
+   for (auto b : unused) {
+      if (gDebug > 0)
+         Info("AdaptBranches", "Removing branch %s, its baskets were not used", b->GetName());
+      fBranches->Remove(b);
+      fBranches->Compress();
+      --fNbranches;
+      delete fBrNames->Remove(fBrNames->FindObject(b->GetName()));
+      fUnusedFills.erase(b);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add to the cache the branch that requested a basket missing from the cache.
+/// Its baskets are prefetched from the next cache fill on.
+
+void TTreeCache::LearnMissedBranch(Long64_t pos, Int_t len)
+{
+   const Long64_t entry = fTree->GetReadEntry();
+   TObjArray *leaves = fTree->GetTree()->GetListOfLeaves();
+   for (Int_t i = 0; i < leaves->GetEntriesFast(); ++i) {
+      TBranch *b = static_cast<TLeaf *>(leaves->UncheckedAt(i))->GetBranch();
+      IOPos iopos = FindBranchBasketPos(*b, entry);
+      if (iopos.fPos != pos || iopos.fLen != len)
+         continue;
+      if (!fBranches->FindObject(b)) {
+         if (gDebug > 0)
+            Info("LearnMissedBranch", "Adding branch %s after a cache miss at entry %lld", b->GetName(), entry);
+         AddBranch(b);
+      }
+      return;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Start of methods for the miss cache.
 ////////////////////////////////////////////////////////////////////////////////
@@ -1277,6 +1400,10 @@ Bool_t TTreeCache::FillBuffer()
       }
    }
 
+   if (resetBranchInfo && fAdaptive && !fIsLearning && !fIsManual) {
+      AdaptBranches();
+   }
+
    if (resetBranchInfo) {
       // We earlier thought we were onto the next set of clusters.
       if (fCurrentClusterStart != -1 || fNextClusterStart != -1) {
@@ -1939,7 +2066,15 @@ Int_t TTreeCache::ReadBufferNormal(char *buf, Long64_t pos, Int_t len){
    //not found in cache. Do we need to fill the cache?
    Bool_t bufferFilled = FillBuffer();
    if (bufferFilled) {
+      // The first read after the fill transfers the content of the cache.
+      const auto now = []() {
+         return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+      };
+      const Long64_t transferStart = fAdaptive ? now() : 0;
       Int_t res = TFileCacheRead::ReadBuffer(buf,pos,len);
+      if (fAdaptive && !fIsLearning)
+         AdaptBufferSize(transferStart, now());
 
       if (res == 1)
          fNReadOk++;
@@ -1957,6 +2092,10 @@ Int_t TTreeCache::ReadBufferNormal(char *buf, Long64_t pos, Int_t len){
       return 1;
    }
 
+   if (fAdaptive && !fIsLearning) {
+      LearnMissedBranch(pos, len);
+   }
+
    fNReadMiss++;
    auto perfStats = GetTree()->GetPerfStats();
    if (perfStats)
@@ -1992,6 +2131,8 @@ Int_t TTreeCache::ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len)
       fNReadMiss++;
       counter++;
       if (counter>1) {
+        if (fAdaptive && !fIsLearning)
+           LearnMissedBranch(pos, len);
         return 0;
       }
    }
@@ -2198,6 +2339,8 @@ void TTreeCache::UpdateBranches(TTree *tree)
 {
 
    fTree = tree;
+   fUnusedFills.clear();
+   fLastTransferEnd = -1;
 
    fEntryMin  = 0;
    fEntryMax  = fTree->GetEntries();
@@ -37,6 +37,7 @@ A TTreeCache which exploits parallelized decompression of its own content.
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
+extern "C" unsigned R__getZSTDDictID(int srcsize, const unsigned char *src);
 
 TTreeCacheUnzip::EParUnzipMode TTreeCacheUnzip::fgParallel = TTreeCacheUnzip::kDisable;
 
@@ -911,6 +912,14 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
             return uzlen;
          }
 
+         // Only the branch knows the dictionary its baskets are compressed with: such baskets are
+         // left to TBasket::ReadBasketBuffers.
+         if (R__getZSTDDictID(nin, bufcur) != 0) {
+            if(alloc) delete [] *dest;
+            *dest = 0;
+            return -1;
+         }
+
          R__unzip(&nin, bufcur, &nbuf, objbuf, &nout);
 
          if (gDebug > 2)
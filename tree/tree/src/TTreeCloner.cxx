@@ -34,9 +34,21 @@ Class implementing or helping  the various TTree cloning method
 #include "TLeafC.h"
 #include "TFileCacheRead.h"
 #include "TTreeCache.h"
+#include "TROOT.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
 #include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace {
+/// Number of baskets copied by TTreeCloner::WriteBasketsPipelined in this process.
+std::atomic<ULong64_t> gNPipelinedBaskets{0};
+} // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -100,6 +112,13 @@ Bool_t TTreeCloner::CompareEntry::operator()(UInt_t i1, UInt_t i2)
 /// This means that on the file the baskets will be in the order
 /// in which they will be needed when reading the whole tree
 /// sequentially.
+///
+/// If 'method' also contains "parallel" and implicit multi-threading
+/// is enabled (see ROOT::EnableImplicitMT), the raw bytes of the next
+/// group of baskets are read from the input file in a task while the
+/// current group is written to the output file. The baskets are still
+/// written in the order requested above, so the output file is
+/// identical to the one produced without this option.
 
 TTreeCloner::TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t options) :
    TTreeCloner(from, to, to ? to->GetDirectory() : nullptr, method, options)
@@ -147,7 +166,8 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    fToStartEntries(0),
    fCacheSize(0LL),
    fFileCache(nullptr),
-   fPrevCache(nullptr)
+   fPrevCache(nullptr),
+   fPipeline(kFALSE)
 {
    TString opt(method);
    opt.ToLower();
@@ -161,6 +181,9 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
       //::Info("TTreeCloner::TTreeCloner","use: kSortBasketsByOffset");
       fCloneMethod = TTreeCloner::kSortBasketsByOffset;
    }
+#ifdef R__USE_IMT
+   fPipeline = opt.Contains("parallel") && ROOT::IsImplicitMTEnabled();
+#endif
    if (fToTree) fToStartEntries = fToTree->GetEntries();
 
    if (fFromTree == nullptr) {
@@ -212,6 +235,23 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    if (fIsValid && (!(fOptions & kNoFileCache))) {
       fCacheSize = fFromTree->GetCacheAutoSize();
    }
+
+   if (fPipeline && fIsValid) {
+      // The reading task must be the only user of the input file while the
+      // baskets are transferred, hence all the baskets have to come from a
+      // single file, different from the output file.
+      TFile *fromfile = fFromTree->GetCurrentFile();
+      if (IsInPlace() || !fromfile || fromfile == fToFile) {
+         fPipeline = kFALSE;
+      }
+      for (Int_t i = 0; fPipeline && i < fFromBranches.GetEntriesFast(); ++i) {
+         TBranch *frombr = (TBranch *)fFromBranches.UncheckedAt(i);
+         if (frombr->GetFile(0) != fromfile)
+            fPipeline = kFALSE;
+      }
+   } else {
+      fPipeline = kFALSE;
+   }
 }
 
 
@@ -280,6 +320,22 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
    // Since this is called from the constructor, this can not be a virtual function
 
    UInt_t numBaskets = 0;
+   // The baskets are copied as they are: they can only be read with the dictionary they were compressed with.
+   if (!from->fCompressionDict.empty() && from->fCompressionDict != to->fCompressionDict) {
+      if (to->fCompressionDict.empty() && to->GetEntries() == 0) {
+         to->fCompressionDict = from->fCompressionDict;
+         to->fDictTrainingBaskets = 0;
+         to->UpdateDecompressionDictionary();
+      } else {
+         fWarningMsg.Form("The export branch and the import branch (%s) do not use the same compression dictionary.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         return 0;
+      }
+   }
    if (from->InheritsFrom(TBranchClones::Class())) {
       TBranchClones *fromclones = (TBranchClones*) from;
       TBranchClones *toclones = (TBranchClones*) to;
@@ -595,7 +651,8 @@ void TTreeCloner::CopyProcessIds()
 
 void TTreeCloner::CreateCache()
 {
-   if (fCacheSize && fFromTree->GetCurrentFile()) {
+   // The pipelined transfer reads the baskets with its own buffers.
+   if (fCacheSize && !fPipeline && fFromTree->GetCurrentFile()) {
       TFile *f = fFromTree->GetCurrentFile();
       auto prev = fFromTree->GetReadCache(f);
       if (fFileCache && prev == fFileCache) {
@@ -724,6 +781,11 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 
 void TTreeCloner::WriteBaskets()
 {
+   if (fPipeline) {
+      WriteBasketsPipelined();
+      return;
+   }
+
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -776,3 +838,151 @@ void TTreeCloner::WriteBaskets()
    }
    delete basket;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the end of the group of baskets that starts at 'from' and is read in
+/// one go by the pipelined transfer.
+///
+/// \param from index of the first element of fBasketIndex in the group
+/// \param maxSize maximum number of bytes to be read for the group; a single
+///        larger basket forms a group on its own.
+/// \return The index of the first element of fBasketIndex after the group
+
+UInt_t TTreeCloner::NextPipelineChunk(UInt_t from, Long64_t maxSize) const
+{
+   Long64_t size = 0;
+   UInt_t j = from;
+   for (; j < fMaxBaskets; ++j) {
+      TBranch *frombr = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+      Int_t index = fBasketNum[fBasketIndex[j]];
+      if (frombr->GetBasketSeek(index) == 0)
+         continue;
+      Int_t len = frombr->GetBasketBytes()[index];
+      if (size > 0 && size + len > maxSize)
+         break;
+      size += len;
+   }
+   return j;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the basket from the input file to the output file, overlapping
+/// the reading of the next group of baskets with the writing of the current
+/// one.
+///
+/// The input file is only accessed by the reading task, with one vectored
+/// read per group, and the output file only by the calling thread, which
+/// writes the baskets in the order given by fBasketIndex.
+
+void TTreeCloner::WriteBasketsPipelined()
+{
+#ifdef R__USE_IMT
+   TFile *fromfile = fFromTree->GetCurrentFile();
+   TBasket *basket = new TBasket();
+
+   // The size of the key is not known for baskets written by old versions of
+   // ROOT, fetch it before any reading task is started.
+   for (UInt_t j = 0; j < fMaxBaskets; ++j) {
+      TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+      Int_t index = fBasketNum[fBasketIndex[j]];
+      Long64_t pos = from->GetBasketSeek(index);
+      if (pos != 0 && from->GetBasketBytes()[index] == 0) {
+         from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+      }
+   }
+
+   struct RChunk {
+      std::vector<char> fBuffer;
+      std::vector<Long64_t> fOffsets; ///< Offset in fBuffer of each basket of the group, -1 for in-memory baskets
+      Bool_t fError = kFALSE;
+   };
+   RChunk chunks[2];
+
+   auto readChunk = [this, fromfile](RChunk &chunk, UInt_t begin, UInt_t end) {
+      // TFile::ReadBuffers expects the requests ordered by position.
+      std::vector<UInt_t> order;
+      std::vector<Long64_t> pos;
+      std::vector<Int_t> len;
+      chunk.fOffsets.assign(end - begin, -1);
+      for (UInt_t j = begin; j < end; ++j) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+         if (from->GetBasketSeek(index) != 0)
+            order.push_back(j);
+      }
+      std::sort(order.begin(), order.end(), [this](UInt_t j1, UInt_t j2) {
+         return fBasketSeek[fBasketIndex[j1]] < fBasketSeek[fBasketIndex[j2]];
+      });
+      Long64_t size = 0;
+      for (auto j : order) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+         pos.push_back(from->GetBasketSeek(index));
+         len.push_back(from->GetBasketBytes()[index]);
+         chunk.fOffsets[j - begin] = size;
+         size += len.back();
+      }
+      chunk.fBuffer.resize(size);
+      chunk.fError = !pos.empty() && fromfile->ReadBuffers(chunk.fBuffer.data(), pos.data(), len.data(), (Int_t)pos.size());
+   };
+
+   const Long64_t chunkSize = fCacheSize > 0 ? fCacheSize : 10 * 1024 * 1024;
+   ROOT::Experimental::TTaskGroup reader;
+   UInt_t begin = 0;
+   UInt_t end = NextPipelineChunk(begin, chunkSize);
+   UInt_t current = 0;
+   readChunk(chunks[current], begin, end);
+   while (begin < end) {
+      const UInt_t nextBegin = end;
+      const UInt_t nextEnd = NextPipelineChunk(nextBegin, chunkSize);
+      if (nextBegin < nextEnd) {
+         RChunk &next = chunks[1 - current];
+         reader.Run([&readChunk, &next, nextBegin, nextEnd]() { readChunk(next, nextBegin, nextEnd); });
+      }
+
+      const RChunk &chunk = chunks[current];
+      if (chunk.fError) {
+         Error("TTreeCloner::WriteBaskets", "Could not read the baskets of %s from %s", fFromTree->GetName(), fromfile->GetName());
+         reader.Wait();
+         break;
+      }
+      for (UInt_t j = begin; j < end; ++j) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         TBranch *to = (TBranch *)fToBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+
+         if (chunk.fOffsets[j - begin] >= 0) {
+            Int_t len = from->GetBasketBytes()[index];
+            basket->LoadBasketBuffersFromMemory(chunk.fBuffer.data() + chunk.fOffsets[j - begin], len, fromfile);
+            basket->IncrementPidOffset(fPidOffset);
+            basket->CopyTo(fToFile);
+            to->AddBasket(*basket, kTRUE, fToStartEntries + from->GetBasketEntry()[index]);
+            ++gNPipelinedBaskets;
+         } else {
+            TBasket *frombasket = from->GetBasket(index);
+            if (frombasket && frombasket->GetNevBuf() > 0) {
+               TBasket *tobasket = (TBasket *)frombasket->Clone();
+               tobasket->SetBranch(to);
+               to->AddBasket(*tobasket, kFALSE, fToStartEntries + from->GetBasketEntry()[index]);
+               to->FlushOneBasket(to->GetWriteBasket());
+            }
+         }
+      }
+
+      reader.Wait();
+      begin = nextBegin;
+      end = nextEnd;
+      current = 1 - current;
+   }
+   delete basket;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of baskets copied, in this process, by the pipelined
+/// transfer of the option "parallel" (see TTreeCloner::WriteBasketsPipelined).
+
+ULong64_t ROOT::Internal::GetTTreeClonerNPipelinedBaskets()
+{
+   return gNPipelinedBaskets;
+}
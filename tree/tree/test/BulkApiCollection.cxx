@@ -0,0 +1,125 @@
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TFile.h"
+#include "TTree.h"
+
+#include "VectorStruct.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+class BulkApiCollectionTest : public ::testing::Test {
+public:
+   static constexpr Long64_t fEventCount = 10000;
+   const std::string fFileName = "BulkApiCollectionTest.root";
+
+protected:
+   virtual void SetUp()
+   {
+      std::unique_ptr<TFile> hfile(TFile::Open(fFileName.c_str(), "recreate"));
+      auto tree = new TTree("T", "A ROOT tree of vectors.");
+      tree->SetBit(TTree::kOnlyFlushAtCluster);
+      tree->SetAutoFlush(1000);
+      std::vector<float> vf;
+      std::vector<double> vd;
+      std::vector<int> vi;
+      float f = 0;
+      VectorStruct s;
+      auto sPtr = &s;
+      tree->Branch("myVecFloat", &vf);
+      tree->Branch("myVecDouble", &vd);
+      tree->Branch("myVecInt", &vi);
+      tree->Branch("myFloat", &f);
+      // split: the vectors are the data member branches myStruct.vf and myStruct.vi
+      tree->Branch("myStruct.", &sPtr, 32000, 99);
+      for (Long64_t ev = 0; ev < fEventCount; ev++) {
+         vf.clear();
+         vd.clear();
+         vi.clear();
+         // Include empty collections.
+         for (Long64_t i = 0; i < ev % 5; i++) {
+            vf.push_back(ev + 0.5f * i);
+            vd.push_back(ev - 0.25 * i);
+            vi.push_back(ev * 10 + i);
+         }
+         f = ev;
+         s.f = f;
+         s.vf = vf;
+         s.vi = vi;
+         tree->Fill();
+      }
+      hfile->Write();
+   }
+};
+
+template <typename T>
+void CheckRead(TTree *tree, const char *branchName, T (*expected)(Long64_t, Long64_t))
+{
+   TBranch *branch = tree->GetBranch(branchName);
+   ASSERT_TRUE(branch);
+   ASSERT_TRUE(branch->GetBulkRead().SupportsBulkCollectionRead());
+
+   TBufferFile valuesBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile offsetsBuf(TBuffer::kWrite, 1024);
+   Long64_t evt = 0;
+   const Long64_t events = tree->GetEntries();
+   while (evt < events) {
+      auto count = branch->GetBulkRead().GetBulkCollectionEntries(evt, valuesBuf, offsetsBuf);
+      ASSERT_GT(count, 0);
+      auto values = reinterpret_cast<const T *>(valuesBuf.GetCurrent());
+      auto offsets = reinterpret_cast<const Int_t *>(offsetsBuf.Buffer());
+      EXPECT_EQ(offsets[0], 0);
+      for (Int_t idx = 0; idx < count; idx++, evt++) {
+         ASSERT_EQ(offsets[idx + 1] - offsets[idx], evt % 5) << "entry " << evt;
+         for (Long64_t i = 0; i < evt % 5; i++)
+            EXPECT_EQ(values[offsets[idx] + i], expected(evt, i)) << "entry " << evt;
+      }
+   }
+   EXPECT_EQ(evt, events);
+}
+
+TEST_F(BulkApiCollectionTest, VectorRead)
+{
+   std::unique_ptr<TFile> hfile(TFile::Open(fFileName.c_str()));
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+
+   CheckRead<float>(tree, "myVecFloat", [](Long64_t ev, Long64_t i) { return ev + 0.5f * i; });
+   CheckRead<double>(tree, "myVecDouble", [](Long64_t ev, Long64_t i) { return ev - 0.25 * i; });
+   CheckRead<int>(tree, "myVecInt", [](Long64_t ev, Long64_t i) { return int(ev * 10 + i); });
+}
+
+TEST_F(BulkApiCollectionTest, SplitMemberRead)
+{
+   std::unique_ptr<TFile> hfile(TFile::Open(fFileName.c_str()));
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+
+   CheckRead<float>(tree, "myStruct.vf", [](Long64_t ev, Long64_t i) { return ev + 0.5f * i; });
+   CheckRead<int>(tree, "myStruct.vi", [](Long64_t ev, Long64_t i) { return int(ev * 10 + i); });
+   // a data member that is not a collection
+   TBranch *branch = tree->GetBranch("myStruct.f");
+   ASSERT_TRUE(branch);
+   EXPECT_FALSE(branch->GetBulkRead().SupportsBulkCollectionRead());
+}
+
+TEST_F(BulkApiCollectionTest, Unsupported)
+{
+   std::unique_ptr<TFile> hfile(TFile::Open(fFileName.c_str()));
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+
+   TBranch *branch = tree->GetBranch("myFloat");
+   ASSERT_TRUE(branch);
+   EXPECT_FALSE(branch->GetBulkRead().SupportsBulkCollectionRead());
+   TBufferFile valuesBuf(TBuffer::kWrite, 1024);
+   TBufferFile offsetsBuf(TBuffer::kWrite, 1024);
+   EXPECT_EQ(branch->GetBulkRead().GetBulkCollectionEntries(0, valuesBuf, offsetsBuf), -1);
+
+   // Reads must start at the beginning of a basket.
+   branch = tree->GetBranch("myVecFloat");
+   ASSERT_TRUE(branch);
+   EXPECT_EQ(branch->GetBulkRead().GetBulkCollectionEntries(1, valuesBuf, offsetsBuf), -1);
+}
@@ -5,6 +5,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +30,67 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+struct IMTRAII {
+   IMTRAII() { ROOT::EnableImplicitMT(); }
+   ~IMTRAII() { ROOT::DisableImplicitMT(); }
+};
+
+TEST(TTreeImplicitMT, asyncBasketWrite)
+{
+   IMTRAII _;
+   const auto ofileName = "asyncBasketWriteMT.root";
+   const int nEntries = 100000;
+   const auto nSubmittedBefore = ROOT::Internal::GetTAsyncBasketWriterNSubmittedBaskets();
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAsyncBasketWrite(kTRUE, 1000000);
+      EXPECT_TRUE(t.GetAsyncBasketWrite());
+      int i = 0;
+      std::vector<double> v;
+      t.Branch("i", &i, 4000);
+      t.Branch("v", &v, 4000);
+      for (i = 0; i < nEntries; ++i) {
+         v.assign(i % 7, i * 0.5);
+         EXPECT_GE(t.Fill(), 0);
+         if (i == nEntries / 2) {
+            // Reading entries while filling writes the baskets in flight.
+            int iread = -1;
+            t.SetBranchAddress("i", &iread);
+            t.GetEntry(10);
+            EXPECT_EQ(iread, 10);
+            t.SetBranchAddress("i", &i);
+         }
+      }
+      t.Write();
+   }
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      ASSERT_EQ(t->GetEntries(), nEntries);
+      const ULong64_t nBaskets = t->GetBranch("i")->GetWriteBasket() + t->GetBranch("v")->GetWriteBasket();
+      EXPECT_GT(t->GetBranch("i")->GetWriteBasket(), 10);
+      // All the full baskets went through the asynchronous writer, only the last basket of each branch was written
+      // synchronously by the final FlushBaskets.
+      const auto nSubmitted = ROOT::Internal::GetTAsyncBasketWriterNSubmittedBaskets() - nSubmittedBefore;
+      EXPECT_GE(nSubmitted, nBaskets - 2u);
+      EXPECT_LE(nSubmitted, nBaskets);
+      int i = -1;
+      std::vector<double> *v = nullptr;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("v", &v);
+      for (int entry = 0; entry < nEntries; ++entry) {
+         t->GetEntry(entry);
+         ASSERT_EQ(i, entry);
+         ASSERT_EQ(v->size(), entry % 7u);
+         for (auto x : *v)
+            ASSERT_EQ(x, entry * 0.5);
+      }
+      t->ResetBranchAddresses();
+      delete v;
+   }
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
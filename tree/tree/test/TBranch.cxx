@@ -1,10 +1,19 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TBranch.h"
+#include "RZip.h"
+#include "TEntryList.h"
 #include "TRandom.h"
+#include "TString.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
 class TBranchTest : public ::testing::Test {
 protected:
    virtual void SetUp()
@@ -229,4 +238,161 @@ TEST_F(TBranchTest, branchInheritsCompression)
 {
    for(int mode = 4; mode >= 0; --mode)
       ASSERT_TRUE(nocomp(mode)) << "Failed for mode: " << mode;
-}
\ No newline at end of file
+}
+
+TEST(TBranch, CompressionDictionary)
+{
+   const char *filename = "TBranchTestCompressionDictionary.root";
+   const Int_t nEntries = 20000;
+   {
+      // ZSTD, level 5
+      TFile f(filename, "RECREATE", "", 505);
+      TTree t("t", "t");
+      TString label;
+      Int_t index = 0;
+      t.Branch("label", &label, 1000);
+      t.Branch("index", &index, 1000);
+      t.GetBranch("label")->SetCompressionDictionary(20, 4096);
+      for (index = 0; index < nEntries; ++index) {
+         label.Form("particle_%s_%d_status_%d", (index % 3 == 0) ? "muon" : "electron", index % 17, index % 5);
+         t.Fill();
+      }
+      EXPECT_FALSE(t.GetBranch("label")->GetCompressionDictionary().empty());
+      EXPECT_TRUE(t.GetBranch("index")->GetCompressionDictionary().empty());
+      t.Write();
+   }
+
+   TFile f(filename);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   EXPECT_FALSE(t->GetBranch("label")->GetCompressionDictionary().empty());
+   TString *label = nullptr;
+   Int_t index = -1;
+   t->SetBranchAddress("label", &label);
+   t->SetBranchAddress("index", &index);
+   ASSERT_EQ(nEntries, t->GetEntries());
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      ASSERT_GT(t->GetEntry(i), 0);
+      EXPECT_EQ(i, index);
+      TString expected;
+      expected.Form("particle_%s_%d_status_%d", (i % 3 == 0) ? "muon" : "electron", int(i % 17), int(i % 5));
+      EXPECT_EQ(expected, *label);
+   }
+   t->ResetBranchAddresses();
+   delete label;
+   gSystem->Unlink(filename);
+}
+
+TEST(TBranch, BasketMinMax)
+{
+   const char *filename = "TBranchTestBasketMinMax.root";
+   const Int_t nEntries = 10000;
+   {
+      TFile f(filename, "RECREATE");
+      TTree t("t", "t");
+      Int_t run = 0;
+      Float_t x = 0;
+      t.Branch("run", &run, 1000);
+      t.Branch("x", &x);
+      EXPECT_TRUE(t.GetBranch("run")->SetBasketMinMax());
+      for (Int_t i = 0; i < nEntries; ++i) {
+         run = i / 100;
+         x = i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(filename);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   TBranch *br = t->GetBranch("run");
+   ASSERT_GT(br->GetWriteBasket(), 10);
+   Double_t min, max;
+   EXPECT_FALSE(t->GetBranch("x")->GetBasketMinMax(0, min, max));
+   for (Int_t i = 0; i < br->GetWriteBasket(); ++i) {
+      ASSERT_TRUE(br->GetBasketMinMax(i, min, max));
+      EXPECT_EQ(br->GetBasketEntry()[i] / 100, min);
+      EXPECT_EQ((br->GetBasketEntry()[i + 1] - 1) / 100, max);
+   }
+
+   std::unique_ptr<TEntryList> list(t->SelectBaskets("run", 42, 43));
+   ASSERT_NE(nullptr, list);
+   // All the entries of runs 42 and 43 are selected, along with the rest of their baskets.
+   for (Long64_t entry = 4200; entry < 4400; ++entry)
+      EXPECT_TRUE(list->Contains(entry));
+   EXPECT_LT(list->GetN(), nEntries / 10);
+   EXPECT_FALSE(list->Contains(0));
+   EXPECT_FALSE(list->Contains(nEntries - 1));
+
+   t->SetEntryList(list.get());
+   EXPECT_EQ(200, t->Draw("x", "run >= 42 && run <= 43", "goff"));
+   t->SetEntryList(nullptr);
+   gSystem->Unlink(filename);
+}
+
+// Two branches whose dictionaries have the same ID must each be read back with their own dictionary
+TEST(TBranch, CompressionDictionaryIdClash)
+{
+   auto formatLabel = [](const char *kind, Long64_t i) {
+      return TString::Format(kind[0] == 'm' ? "muon_%d_status_%d_charge" : "jet_%d_energy_%d_eta_phi", int(i % 17),
+                             int(i % 5));
+   };
+   auto trainDictionary = [&](const char *kind) {
+      std::string samples;
+      std::vector<size_t> sizes;
+      for (Long64_t i = 0; i < 2000; ++i) {
+         const TString label = formatLabel(kind, i);
+         samples.append(label.Data(), label.Length());
+         sizes.push_back(label.Length());
+      }
+      std::vector<char> dict(4096);
+      dict.resize(R__trainZSTDDict(dict.data(), dict.size(), samples.data(), sizes.data(), sizes.size()));
+      return dict;
+   };
+   const auto muonDict = trainDictionary("muon");
+   auto jetDict = trainDictionary("jet");
+   ASSERT_GT(muonDict.size(), 8u);
+   ASSERT_GT(jetDict.size(), 8u);
+   // The dictionary ID is stored after the 4 bytes of the magic number
+   std::copy(muonDict.begin() + 4, muonDict.begin() + 8, jetDict.begin() + 4);
+   ASSERT_NE(muonDict, jetDict);
+
+   const char *filename = "TBranchTestCompressionDictionaryIdClash.root";
+   const Int_t nEntries = 5000;
+   {
+      // ZSTD, level 5
+      TFile f(filename, "RECREATE", "", 505);
+      TTree t("t", "t");
+      TString muon, jet;
+      t.Branch("muon", &muon, 1000);
+      t.Branch("jet", &jet, 1000);
+      t.GetBranch("muon")->SetCompressionDictionary(muonDict);
+      t.GetBranch("jet")->SetCompressionDictionary(jetDict);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         muon = formatLabel("muon", i);
+         jet = formatLabel("jet", i);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(filename);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   EXPECT_EQ(jetDict, t->GetBranch("jet")->GetCompressionDictionary());
+   TString *muon = nullptr;
+   TString *jet = nullptr;
+   t->SetBranchAddress("muon", &muon);
+   t->SetBranchAddress("jet", &jet);
+   ASSERT_EQ(nEntries, t->GetEntries());
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      ASSERT_GT(t->GetEntry(i), 0);
+      EXPECT_EQ(formatLabel("muon", i), *muon);
+      EXPECT_EQ(formatLabel("jet", i), *jet);
+   }
+   t->ResetBranchAddresses();
+   delete muon;
+   delete jet;
+   gSystem->Unlink(filename);
+}
@@ -0,0 +1,174 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(TTreeCache, AdaptiveAddsMissedBranch)
+{
+   const char *fname = "TTreeCacheAdaptive.root";
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      int a = 0, b = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.SetAutoFlush(1000);
+      for (int i = 0; i < 10000; ++i) {
+         a = i;
+         b = 2 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname));
+   auto t = f->Get<TTree>("t");
+   ASSERT_TRUE(t);
+   t->SetCacheSize(10000000);
+   t->SetCacheLearnEntries(1);
+   auto cache = dynamic_cast<TTreeCache *>(f->GetCacheRead(t));
+   ASSERT_TRUE(cache);
+   cache->SetAdaptive();
+   EXPECT_TRUE(cache->IsAdaptive());
+
+   int a = -1, b = -1;
+   t->SetBranchAddress("a", &a);
+   t->SetBranchAddress("b", &b);
+   auto ba = t->GetBranch("a");
+   auto bb = t->GetBranch("b");
+
+   // Only "a" is used during the learning phase.
+   for (Long64_t i = 0; i < 2000; ++i) {
+      t->LoadTree(i);
+      ba->GetEntry(i);
+      EXPECT_EQ(a, i);
+   }
+   EXPECT_FALSE(cache->IsLearning());
+   EXPECT_EQ(cache->GetCachedBranches()->FindObject(bb), nullptr);
+
+   // Reading "b" now misses the cache: the branch is added to it.
+   t->LoadTree(2500);
+   bb->GetEntry(2500);
+   EXPECT_EQ(b, 5000);
+   EXPECT_NE(cache->GetCachedBranches()->FindObject(bb), nullptr);
+
+   for (Long64_t i = 2501; i < 10000; ++i) {
+      t->LoadTree(i);
+      ba->GetEntry(i);
+      bb->GetEntry(i);
+      EXPECT_EQ(a, i);
+      EXPECT_EQ(b, 2 * i);
+   }
+   t->ResetBranchAddresses();
+   f.reset();
+   gSystem->Unlink(fname);
+}
+
+TEST(TTreeCache, AdaptiveRemovesUnusedBranch)
+{
+   const char *fname = "TTreeCacheAdaptiveRemove.root";
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      int a = 0, b = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.SetAutoFlush(1000);
+      for (int i = 0; i < 10000; ++i) {
+         a = i;
+         b = 2 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname));
+   auto t = f->Get<TTree>("t");
+   ASSERT_TRUE(t);
+   // small enough for every fill of the cache to hold a single cluster
+   t->SetCacheSize(1000);
+   t->SetCacheLearnEntries(10);
+   auto cache = dynamic_cast<TTreeCache *>(f->GetCacheRead(t));
+   ASSERT_TRUE(cache);
+   cache->SetAdaptive();
+
+   int a = -1, b = -1;
+   t->SetBranchAddress("a", &a);
+   t->SetBranchAddress("b", &b);
+   auto ba = t->GetBranch("a");
+   auto bb = t->GetBranch("b");
+
+   // Both branches are used during the learning phase and in the first cluster.
+   for (Long64_t i = 0; i < 1000; ++i) {
+      t->LoadTree(i);
+      ba->GetEntry(i);
+      bb->GetEntry(i);
+   }
+   EXPECT_FALSE(cache->IsLearning());
+   EXPECT_NE(cache->GetCachedBranches()->FindObject(bb), nullptr);
+
+   // "b" is not read anymore: after three fills whose baskets of "b" were not used, it is removed from the cache.
+   for (Long64_t i = 1000; i < 10000; ++i) {
+      t->LoadTree(i);
+      ba->GetEntry(i);
+      EXPECT_EQ(a, i);
+   }
+   EXPECT_NE(cache->GetCachedBranches()->FindObject(ba), nullptr);
+   EXPECT_EQ(cache->GetCachedBranches()->FindObject(bb), nullptr);
+   t->ResetBranchAddresses();
+   f.reset();
+   gSystem->Unlink(fname);
+}
+
+// Exposes the resizing of the adaptive cache, which otherwise depends on the timing of the reads.
+class TTreeCacheAdaptiveResize : public TTreeCache {
+public:
+   TTreeCacheAdaptiveResize(TTree *tree, Int_t size) : TTreeCache(tree, size) {}
+   using TTreeCache::AdaptBufferSize;
+   Int_t GetFillSize() const { return fBufferSizeMin; }
+};
+
+TEST(TTreeCache, AdaptiveResizesBuffer)
+{
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   int a = 0;
+   t.Branch("a", &a);
+   TTreeCacheAdaptiveResize cache(&t, 10000);
+   cache.SetAdaptive(kTRUE, 40000);
+   EXPECT_EQ(cache.GetFillSize(), 10000);
+
+   // The first transfer has no processing time to compare with
+   cache.AdaptBufferSize(0, 10);
+   EXPECT_EQ(cache.GetFillSize(), 10000);
+
+   // Waiting for half of the time: the cache grows, up to the maximum size
+   cache.AdaptBufferSize(20, 30);
+   EXPECT_EQ(cache.GetFillSize(), 20000);
+   cache.AdaptBufferSize(40, 50);
+   EXPECT_EQ(cache.GetFillSize(), 40000);
+   cache.AdaptBufferSize(60, 70);
+   EXPECT_EQ(cache.GetFillSize(), 40000);
+
+   // Waiting for 5% of the time: the size is right
+   cache.AdaptBufferSize(165, 170);
+   EXPECT_EQ(cache.GetFillSize(), 40000);
+
+   // Hardly waiting: the cache shrinks, down to the size set by the user
+   cache.AdaptBufferSize(1000170, 1000171);
+   EXPECT_EQ(cache.GetFillSize(), 20000);
+   cache.AdaptBufferSize(2000171, 2000172);
+   EXPECT_EQ(cache.GetFillSize(), 10000);
+   cache.AdaptBufferSize(3000172, 3000173);
+   EXPECT_EQ(cache.GetFillSize(), 10000);
+
+   // Leaving the adaptive mode restores the size set by the user
+   cache.AdaptBufferSize(3000180, 3000190);
+   EXPECT_EQ(cache.GetFillSize(), 20000);
+   cache.SetAdaptive(kFALSE);
+   EXPECT_EQ(cache.GetFillSize(), 10000);
+}
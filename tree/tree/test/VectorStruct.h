@@ -0,0 +1,13 @@
+#include <vector>
+
+/**
+ * The VectorStruct has no purpose except to provide
+ * inputs to the test cases.
+ */
+
+class VectorStruct {
+public:
+   float              f;
+   std::vector<float> vf;
+   std::vector<int>   vi;
+};